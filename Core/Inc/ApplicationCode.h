@@ -8,6 +8,7 @@
 #include "stm32f4xx_hal.h"
 
 #include <stdio.h>
+#include <string.h>
 #include <stdbool.h>
 #include <inttypes.h>
 
@@ -15,33 +16,45 @@
 #include "RNG.h"
 #include "LCD_Driver.h"
 #include "Timer.h"
+#include "GameEngine.h"
+#include "Replay.h"
+#include "ScoreStore.h"
+#include "FlashPort.h"
+#include "TileAtlas.h"
+#include "BoardView.h"
+#include "Overlay.h"
+#include "ScreenImage.h"
+#include "Placement.h"
+#include "Finesse.h"
+#include "PerfectClear.h"
+#include "Bot.h"
+#include "BoardEval.h"
+#include "Snapshot.h"
 
-#define FRAMERATE 1000 // 1 FPS
+//#define BAG_SEED 0x1234ABCD // uncomment for a repeatable piece order instead of a seed from the hardware RNG
 
-// defne grid
-#define GRID_WIDTH  12
-#define GRID_HEIGHT 16
-#define CELL_SIZE	20
-#define BLOCK_SIZE 4 	// Blocks are 4x4 matrices
+//#define SCAN_CHASE // uncomment to draw the playfield behind or ahead of the LTDC beam, no tearing
 
-#define EMPTY_CELL  0 // Represent an empty cell with 0
+//#define PLACEMENT_BENCH // uncomment to time the placement search for every next block, printed at game over
 
-#define RANDOM_BLOCK 0
-#define I_BLOCK		1
-#define O_BLOCK		2
-#define T_BLOCK		3
-#define S_BLOCK		4
-#define Z_BLOCK		5
-#define J_BLOCK		6
-#define L_BLOCK		7
+//#define PC_TRAINING // uncomment to look for a perfect clear with the pieces on screen for every new block, printed
+#define PC_BUDGET_MS  40	// longest a perfect clear search may hold up the game
+#define PC_TABLE_SIZE 1024	// states without a clear remembered per search, 8 bytes each (power of 2)
 
-#define MOVE_DOWN  0
-#define MOVE_LEFT  1
-#define MOVE_RIGHT 2
-#define MOVE_UP    3
+//#define BOT_HINTS // uncomment to print where the bot would drop every new block, table hit or search, and how long it took
+//#define BOT_PLAY // uncomment to let the bot play, its moves go through the input queue and the replay
 
-#define ROTATE_LEFT  0
-#define ROTATE_RIGHT 1
+//#define PRACTICE_REWIND // uncomment for practice games that go back a few blocks on a top out, not saved or ranked
+#define PRACTICE_HISTORY 8	// blocks a rewind goes back, a snapshot each
+#define PRACTICE_REWINDS 3	// per game, the top out after the last one ends it
+
+//#define EVAL_BENCH // uncomment to time the board evaluator kernels on every new board, printed at game over
+
+#define REPLAY_FILE_PREFIX "replay_" // replays are saved over semihosting as replay_<seed>.trp
+
+#define CELL_SIZE	ATLAS_TILE_SIZE
+
+#define INPUT_QUEUE_SIZE 16 // inputs waiting for the main loop (power of 2)
 
 #ifndef INC_APPLICATIONCODE_H_
 #define INC_APPLICATIONCODE_H_
@@ -53,19 +66,10 @@ void displayMainMenu(void);
 void startGame(void);
 void updateGameScreen(void);
 void displayResultsScreen(void);
+void ApplicationIdle(void);
 
-void InitGameGrid(void);
 void DrawGameGrid(void);
 
-void GenerateBlock(uint8_t blockNum);
-bool MoveCurrentBlock(uint8_t direction);
-bool RotateCurrentBlock(uint8_t direction);
-
-void PlaceCurrentBlock(void);
-uint8_t ClearCompleteLines(void);
-void CheckGameEnd(void);
-
-void arrangeBlocks(void);
 void HandleTouch(void);
 
 #endif /* INC_APPLICATIONCODE_H_ */
@@ -0,0 +1,75 @@
+/*
+ * BoardEval.h
+ *
+ *  Created on: Dec 24, 2024
+ *      Author: Will Fraser
+ */
+
+#ifndef INC_BOARDEVAL_H_
+#define INC_BOARDEVAL_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "GameEngine.h"
+
+/*
+ * Heuristic features of many boards at once. A batch is kept a row at a time: row y
+ * of every board next to each other, so one load takes the same row of several boards
+ * and every feature is a sum over the rows of a popcount of some mask of that row and
+ * the columns covered above it,
+ *  - height: covered cells, the sum of the column heights,
+ *  - holes: covered cells that are empty,
+ *  - bumpiness: covered cells whose right neighbour is not covered or the other way,
+ *    the sum of the height steps between columns, as column cover only ever grows,
+ *  - transitions: filled to empty and empty to filled along the row, walls filled.
+ * Eval_Scalar is the reference. Eval_Sse and Eval_Avx2 do 8 and 16 boards a step on
+ * the host, Eval_Dsp 2 boards a step in a 32 bit register on the Cortex-M4 with byte
+ * lane adds, each where the compiler has the instructions for it. Eval_Batch is the
+ * fastest one the build has.
+ */
+
+#define EVAL_BATCH 16			// boards per batch, a multiple of 16 for the widest kernel
+
+#if defined(__ARM_FEATURE_DSP) || defined(EVAL_DSP_EMULATED)
+#define EVAL_HAS_DSP
+#endif
+#if defined(__SSSE3__)
+#define EVAL_HAS_SSE
+#endif
+#if defined(__AVX2__)
+#define EVAL_HAS_AVX2
+#endif
+
+typedef struct {
+	uint16_t rows[GRID_ROWS][EVAL_BATCH];	// rows[y][board], the engine's gridRows
+} EvalBatch;
+
+typedef struct {
+	uint16_t height[EVAL_BATCH];
+	uint16_t holes[EVAL_BATCH];
+	uint16_t bumpiness[EVAL_BATCH];
+	uint16_t transitions[EVAL_BATCH];
+} EvalFeatures;
+
+typedef struct {
+	int16_t height, holes, bumpiness, transitions;
+} EvalWeights;
+
+void Eval_Scalar(const EvalBatch *batch, EvalFeatures *features);
+#ifdef EVAL_HAS_SSE
+void Eval_Sse(const EvalBatch *batch, EvalFeatures *features);
+#endif
+#ifdef EVAL_HAS_AVX2
+void Eval_Avx2(const EvalBatch *batch, EvalFeatures *features);
+#endif
+#ifdef EVAL_HAS_DSP
+void Eval_Dsp(const EvalBatch *batch, EvalFeatures *features);
+#endif
+void Eval_Batch(const EvalBatch *batch, EvalFeatures *features);
+
+void Eval_SetBoard(EvalBatch *batch, uint8_t board, const uint16_t *gridRows);
+void Eval_Scores(const EvalFeatures *features, const EvalWeights *weights, uint8_t count,
+		int32_t *scores);
+
+#endif /* INC_BOARDEVAL_H_ */
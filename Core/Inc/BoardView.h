@@ -0,0 +1,21 @@
+/*
+ * BoardView.h
+ *
+ *  Created on: Dec 13, 2024
+ *      Author: Will Fraser
+ */
+
+#ifndef INC_BOARDVIEW_H_
+#define INC_BOARDVIEW_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "GameEngine.h"
+#include "TileAtlas.h"
+#include "ScanSync.h"
+
+void Board_Invalidate(void);
+void Board_Draw(GameState *game, uint16_t reservedTop, bool ghost);
+
+#endif /* INC_BOARDVIEW_H_ */
@@ -0,0 +1,75 @@
+/*
+ * Bot.h
+ *
+ *  Created on: Dec 23, 2024
+ *      Author: Will Fraser
+ */
+
+#ifndef INC_BOT_H_
+#define INC_BOT_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "GameEngine.h"
+#include "Placement.h"
+#include "BoardEval.h"
+
+//#define BOT_TABLE // uncomment to look new blocks up in the generated table before searching, about 11 KB of flash
+
+/*
+ * Where to drop a block. The search scores every rotation and column a block can be
+ * dropped straight down at from its spawn: holes, stack height, bumpiness and lines
+ * cleared of the board after it locks. The boards are scored EVAL_BATCH at a time.
+ *
+ * With BOT_TABLE the same choice is also kept in flash for the surfaces that come up
+ * most in play, keyed by the block and the steps between neighbouring column tops
+ * (bucketed to -2..2), so a block on one of those is a hash lookup. BotTable.c holds
+ * that table and is generated by Tools/BotTableGen from games the search plays, do not
+ * edit it by hand. A surface that is not in the table, or a table entry that cannot be
+ * dropped on this board, falls back to the search. The generator also plays the table
+ * against the search alone: so far every size of it clears fewer lines, so it is off.
+ *
+ * The table is a perfect hash: a key's bucket picks a displacement, the displacement
+ * picks its slot, and every slot is a 16 bit entry with a fingerprint of the key to
+ * tell misses apart, the rotation and the box column.
+ */
+
+#define BOT_STEP_LIMIT  2								// column top steps are clamped to +-2
+#define BOT_STEP_VALUES (2 * BOT_STEP_LIMIT + 1)
+
+#define BOT_ENTRY(fingerprint, rotation, x) \
+	((uint16_t) ((fingerprint) << 8 | (rotation) << 4 | ((x) + PLACEMENT_X_BIAS)))
+#define BOT_ENTRY_FINGERPRINT(entry) ((entry) >> 8)
+#define BOT_ENTRY_ROTATION(entry)    (((entry) >> 4) & 3)
+#define BOT_ENTRY_X(entry)           ((int8_t) ((entry) & 0xF) - PLACEMENT_X_BIAS)
+
+// Seeds of the three hashes of a key, the displacement is added to BOT_SEED_SLOT
+#define BOT_SEED_BUCKET      0
+#define BOT_SEED_FINGERPRINT 1
+#define BOT_SEED_SLOT        2
+
+typedef struct {
+	const uint16_t *displace;		// per bucket
+	const uint16_t *entries;		// per slot, BOT_ENTRY
+	uint16_t buckets;
+	uint16_t slots;
+} BotTable;
+
+#ifdef BOT_TABLE
+extern const BotTable botTable;
+#endif
+
+uint32_t Bot_Hash(uint32_t key, uint32_t seed);
+uint32_t Bot_SurfaceKey(const uint16_t *gridRows, uint8_t blockNum);
+
+bool Bot_Drop(const uint16_t *gridRows, uint8_t blockNum, uint8_t rotation, int8_t x,
+		Placement *placement);
+bool Bot_Search(const uint16_t *gridRows, uint8_t blockNum, Placement *best);
+bool Bot_Lookup(const BotTable *table, const uint16_t *gridRows, uint8_t blockNum,
+		Placement *best);
+bool Bot_Choose(const BotTable *table, const uint16_t *gridRows, uint8_t blockNum,
+		Placement *best, bool *hit);
+uint8_t Bot_Lock(uint16_t *gridRows, uint8_t blockNum, const Placement *placement);
+
+#endif /* INC_BOT_H_ */
@@ -0,0 +1,63 @@
+/*
+ * Finesse.h
+ *
+ *  Created on: Dec 21, 2024
+ *      Author: Will Fraser
+ */
+
+#ifndef INC_FINESSE_H_
+#define INC_FINESSE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "GameEngine.h"
+
+/*
+ * Fewest touches to put a block where it was dropped. With one move or turn per touch
+ * a block can only get to a column and rotation by the touches in between, so for every
+ * rotation and box column the shortest sequence from the spawn is found once by a search
+ * over (x, rotation) with the engine's own moves, rotations with the same cells sharing
+ * the shortest of them. FinesseTables.c holds the result in flash and is generated by
+ * Tools/FinesseGen, do not edit it by hand. Blocks moved after they were below the top
+ * of the stack (tucks and spins) are not judged, they could not have been dropped there.
+ */
+
+#define FINESSE_X_BIAS      (BLOCK_SIZE - 1)					// box column x is entry x + FINESSE_X_BIAS
+#define FINESSE_COLUMNS     (GRID_WIDTH + FINESSE_X_BIAS)		// box columns -3..11
+#define FINESSE_ROTATIONS   4
+#define FINESSE_MAX_PRESSES 14
+
+// A sequence is packed in 32 bits: the touch count in bits 0-3, then 2 bits per touch
+// from bit 4, each an INPUT_MOVE_LEFT..INPUT_ROTATE_RIGHT
+#define FINESSE_UNREACHABLE   0xF
+#define FINESSE_PRESSES(path) ((path) & 0xF)
+#define FINESSE_INPUT(path, i) (((path) >> (4 + 2 * (i))) & 3)
+
+extern const uint16_t finesseBoxes[7][FINESSE_ROTATIONS];	// 4x4 box per rotation, bit y * 4 + x
+extern const uint32_t finessePaths[7][FINESSE_ROTATIONS][FINESSE_COLUMNS];
+
+// Touches on the block in play, kept next to a game by whoever feeds it inputs
+typedef struct {
+	uint32_t piece;					// Engine_PiecesPlaced when the block was spawned
+	uint8_t blockNum;
+	uint8_t rotation;				// of the box as it is now
+	int8_t x;
+	int8_t spawnY;
+	uint8_t presses;				// moves and turns since the spawn, blocked ones included
+	bool tucked;					// moved where a straight drop could not reach
+
+	// the last judged block and totals for the game
+	uint8_t lastPresses;
+	uint8_t lastOptimal;
+	uint32_t judged;
+	uint32_t faults;
+	uint32_t extraPresses;
+} FinesseTracker;
+
+void Finesse_Reset(FinesseTracker *tracker, const GameState *game);
+bool Finesse_Input(FinesseTracker *tracker, const GameState *game, uint8_t input);
+bool Finesse_Update(FinesseTracker *tracker, const GameState *game);
+uint32_t Finesse_Path(uint8_t blockNum, uint8_t rotation, int8_t x);
+
+#endif /* INC_FINESSE_H_ */
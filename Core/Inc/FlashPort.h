@@ -0,0 +1,23 @@
+/*
+ * FlashPort.h
+ *
+ *  Created on: Dec 10, 2024
+ *      Author: Will Fraser
+ */
+
+#ifndef INC_FLASHPORT_H_
+#define INC_FLASHPORT_H_
+
+#include "stm32f4xx_hal.h"
+#include "ScoreStore.h"
+
+// Last two 128K sectors of bank 2, kept out of the FLASH region in STM32F429ZITX_FLASH.ld
+#define STORE_SECTOR_A      FLASH_SECTOR_22
+#define STORE_SECTOR_B      FLASH_SECTOR_23
+#define STORE_SECTOR_A_ADDR 0x081C0000
+#define STORE_SECTOR_B_ADDR 0x081E0000
+#define STORE_SECTOR_SIZE   (128 * 1024)
+
+extern const FlashPort scoreFlash;
+
+#endif /* INC_FLASHPORT_H_ */
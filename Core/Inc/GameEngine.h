@@ -0,0 +1,164 @@
+/*
+ * GameEngine.h
+ *
+ *  Created on: Dec 8, 2024
+ *      Author: Will Fraser
+ */
+
+#ifndef INC_GAMEENGINE_H_
+#define INC_GAMEENGINE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "PieceBag.h"
+
+#define FRAMERATE 1000 			// 1 FPS, gravity interval in ms
+#define SOFT_DROP_INTERVAL 50	// gravity interval in ms while the user button is held
+
+// defne grid
+#define GRID_WIDTH  12
+#define GRID_HEIGHT 16	// visible rows
+#define GRID_HIDDEN_ROWS 2	// buffer rows above the visible ones, blocks spawn into them
+#define GRID_ROWS   (GRID_HIDDEN_ROWS + GRID_HEIGHT)	// rows the engine keeps, row 0 is hidden
+#define BLOCK_SIZE 4 	// Blocks are 4x4 matrices
+#define SPAWN_X    4	// column the 4x4 block box spawns at
+
+#define EMPTY_CELL  0 // Represent an empty cell with 0
+
+#define RANDOM_BLOCK 0
+#define I_BLOCK		1
+#define O_BLOCK		2
+#define T_BLOCK		3
+#define S_BLOCK		4
+#define Z_BLOCK		5
+#define J_BLOCK		6
+#define L_BLOCK		7
+
+#define NO_BLOCK    0	// empty hold slot
+
+#define MOVE_DOWN  0
+#define MOVE_LEFT  1
+#define MOVE_RIGHT 2
+#define MOVE_UP    3
+
+#define ROTATE_LEFT  0
+#define ROTATE_RIGHT 1
+
+#define PREVIEW_COUNT 5	// depth of the next piece queue
+
+// Player inputs, the only way a running game changes besides gravity
+#define INPUT_MOVE_LEFT    0
+#define INPUT_MOVE_RIGHT   1
+#define INPUT_ROTATE_LEFT  2
+#define INPUT_ROTATE_RIGHT 3
+#define INPUT_HOLD         4
+#define INPUT_DROP_PRESS   5
+#define INPUT_DROP_RELEASE 6
+
+// Engine_TakeChanges flags
+#define ENGINE_CHANGED_GRID  (1 << 0)
+#define ENGINE_CHANGED_QUEUE (1 << 1)
+
+// Engine_TakeClearedRows when more than one clear happened since it was last called
+#define ENGINE_CLEARS_UNKNOWN 0xFFFF
+
+// define block struct to store shape info for each block
+typedef struct {
+	uint8_t shape[BLOCK_SIZE][BLOCK_SIZE]; // 4x4 matrix for block shape
+} TetrisBlock;
+
+extern const TetrisBlock tetrisBlocks[7];
+
+// A piece waiting in the queue, spawn state is precomputed so spawning is a fixed cost
+typedef struct {
+	uint8_t blockNum;						// I_BLOCK..L_BLOCK
+	uint16_t spawnRows[BLOCK_SIZE];			// row masks of the shape at SPAWN_X, bit x = column x
+	bool spawnBlocked;						// spawn rows overlap the stack, a block out
+	bool dropBlocked;						// no room to drop one row into view after spawning
+} QueuedPiece;
+
+/*
+ * Shape of the stack, kept up to date as blocks are placed and rows cleared rather
+ * than worked out from the grid: placing touches only the block's cells and a clear
+ * only moves the counts, so full rows, topping out and board evaluation are lookups.
+ */
+typedef struct {
+	uint8_t columnHeights[GRID_WIDTH];		// filled height from the floor to the top cell, 0 empty
+	uint8_t rowFill[GRID_ROWS];			// filled cells per row, GRID_WIDTH is a full row
+	uint8_t holes;							// empty cells under the top cell of their column
+	uint8_t stackHeight;					// tallest column
+} BoardFeatures;
+
+/*
+ * Everything one game is made of. The engine keeps nothing else between calls, so
+ * any number of games can run side by side, each through its own GameState; the
+ * host tools run thousands of them for replay checks and search. A game is only
+ * changed through the functions below, rendering reads it through the Engine_ views.
+ */
+typedef struct {
+	uint8_t gameGrid[GRID_ROWS][GRID_WIDTH]; 		// placed blocks, block number per cell
+	uint8_t currentBlock[GRID_ROWS][GRID_WIDTH]; 	// current block array
+	int8_t currentBlockX;							// top left of the 4x4 box, can sit off the grid
+	int8_t currentBlockY;
+	uint8_t currentBlockNum;
+	uint16_t gridRows[GRID_ROWS];					// occupancy mask of gameGrid per row
+	BoardFeatures features;							// of gameGrid, see above
+	uint64_t rowHashes[GRID_ROWS];					// Zobrist keys of the cells in each row
+	uint64_t zobrist;								// of gameGrid, see Engine_Zobrist
+	uint16_t score[4];								// singles, doubles, triples, tetrises
+	uint32_t piecesPlaced;							// locked into the stack this game
+
+	// Next piece queue and hold slot
+	PieceBag pieceBag;								// 7-bag randomizer
+	QueuedPiece nextQueue[PREVIEW_COUNT];			// ring buffer, nextHead is the next piece
+	uint8_t nextHead;
+	uint8_t holdBlock;
+	bool holdUsed;									// only one hold per piece
+
+	// Game clock, everything is driven by the times passed in so a game can be replayed exactly
+	uint32_t engineTime;							// time of the last processed event
+	uint32_t nextGravity;
+	uint32_t endTime;
+	bool softDrop;
+	bool gameOver;
+	uint8_t changes;								// ENGINE_CHANGED_* since last taken
+	uint32_t clearedRows;							// rows removed by the last clear, bit y = row y
+} GameState;
+
+// Game flow, times are ms since the start of the game
+void Engine_NewGame(GameState *game, uint32_t seed);
+void Engine_Advance(GameState *game, uint32_t now);
+void Engine_Input(GameState *game, uint8_t input, uint32_t now);
+bool Engine_IsOver(const GameState *game);
+uint32_t Engine_Elapsed(const GameState *game);
+uint8_t Engine_TakeChanges(GameState *game);
+uint16_t Engine_TakeClearedRows(GameState *game);
+
+// Read-only view for rendering and verification, rows are visible rows, the hidden ones are not shown
+uint8_t Engine_CellAt(const GameState *game, uint8_t x, uint8_t y);
+uint8_t Engine_PeekNext(const GameState *game, uint8_t index);
+uint8_t Engine_GetHold(const GameState *game);
+uint8_t Engine_GhostDrop(const GameState *game);
+uint8_t Engine_GhostAt(const GameState *game, uint8_t x, uint8_t y, uint8_t drop);
+const uint16_t* Engine_GetScore(const GameState *game);
+uint32_t Engine_PiecesPlaced(const GameState *game);
+const BoardFeatures* Engine_GetFeatures(const GameState *game);
+uint32_t Engine_BoardHash(const GameState *game);
+uint64_t Engine_Zobrist(const GameState *game);
+uint64_t Engine_PositionHash(const GameState *game);
+uint16_t Engine_CurrentBox(const GameState *game);
+void Engine_Rebuild(GameState *game);
+
+// Block and grid operations, also used directly to script the menu board in Tools/ScreenGen
+void InitGameGrid(GameState *game);
+void GenerateBlock(GameState *game, uint8_t blockNum);
+void HoldCurrentBlock(GameState *game);
+bool MoveCurrentBlock(GameState *game, uint8_t direction);
+bool RotateCurrentBlock(GameState *game, uint8_t direction);
+
+void PlaceCurrentBlock(GameState *game);
+uint8_t ClearCompleteLines(GameState *game);
+void CheckGameEnd(GameState *game, uint32_t blockRows);
+
+#endif /* INC_GAMEENGINE_H_ */
@@ -0,0 +1,32 @@
+/*
+ * GlyphMasks.h
+ *
+ *  Created on: Dec 11, 2024
+ *      Author: Will Fraser
+ */
+
+#ifndef INC_GLYPHMASKS_H_
+#define INC_GLYPHMASKS_H_
+
+#include <stdint.h>
+
+/*
+ * The font tables in fonts.c store their rows in two bit orders (12x12 is MSB
+ * first, 16x24 is LSB first). GlyphMasks.c holds the same glyphs with every row
+ * normalised so bit 0 is the leftmost pixel, plus the range of rows that have any
+ * pixels set. It is generated by Tools/GlyphGen, do not edit it by hand.
+ */
+
+#define GLYPH_FIRST_CHAR 32		// ' ', the tables start at the space
+
+typedef struct {
+	const uint16_t *rows;		// height masks per glyph, bit 0 is the leftmost pixel
+	const uint8_t *extent;		// per glyph: first row with pixels, number of rows to draw
+	uint8_t count;				// glyphs in the set
+	uint8_t height;
+} GlyphSet;
+
+extern const GlyphSet Glyphs16x24;
+extern const GlyphSet Glyphs12x12;
+
+#endif /* INC_GLYPHMASKS_H_ */
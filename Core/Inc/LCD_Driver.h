@@ -11,37 +11,16 @@
 #include "stm32f4xx_hal.h"
 #include "ili9341.h"
 #include "fonts.h"
+#include "LCD_Graphics.h"
+#include "UiLayer.h"
+#include "ScanSync.h"
 #include "stmpe811.h"
 
 #define COMPILE_TOUCH_FUNCTIONS COMPILE_TOUCH
 #define TOUCH_INTERRUPT_ENABLED COMPILE_TOUCH_INTERRUPT_SUPPORT
 
-/**
-  * @brief  LCD color RGB565
-  */
-
 #define LCD_PIXEL_FORMAT_1     LTDC_PIXEL_FORMAT_RGB565
 
-#define LCD_COLOR_WHITE         0xFFFF
-#define LCD_COLOR_BLACK         0x0000
-#define LCD_COLOR_GREY          0x18c3
-#define LCD_COLOR_BLUE          0x001F
-#define LCD_COLOR_BLUE2         0x051F
-#define LCD_COLOR_RED           0xF800
-#define LCD_COLOR_MAGENTA       0xF81F
-#define LCD_COLOR_GREEN         0x07E0
-#define LCD_COLOR_CYAN          0x7FFF
-#define LCD_COLOR_YELLOW        0xFFE0
-
-// Custom TETRIS colors
-#define L_BLOCK_COLOR           0x90F3
-#define J_BLOCK_COLOR           0xA514
-#define I_BLOCK_COLOR           0x90E2
-#define O_BLOCK_COLOR           0x0014
-#define T_BLOCK_COLOR           0x9AA3
-#define S_BLOCK_COLOR           0x4D05
-#define Z_BLOCK_COLOR           0x4D1F
-
 /* Timing configuration from datahseet
   HSYNC=10 (9+1)
   HBP=20 (29-10+1)
@@ -59,30 +38,13 @@
 #define  ILI9341_VSYNC            ((uint32_t)1)   /* Vertical synchronization   */
 #define  ILI9341_VBP              ((uint32_t)3)    /* Vertical back porch        */
 #define  ILI9341_VFP              ((uint32_t)2)    /* Vertical front porch       */
-#define  LCD_PIXEL_WIDTH    ((uint16_t)240)
-#define  LCD_PIXEL_HEIGHT   ((uint16_t)320)
-#define  LCD_PIXELS		     ((uint32_t)LCD_PIXEL_WIDTH * (uint32_t)LCD_PIXEL_HEIGHT)
 
 void LCD_Init(void);
 void LTCD__Init(void);
 void LTCD_Layer_Init(uint8_t LayerIndex);
-
-void LCD_DrawChar(uint16_t Xpos, uint16_t Ypos, const uint16_t *c);
-void LCD_DisplayChar(uint16_t Xpos, uint16_t Ypos, uint8_t Ascii);
-void LCD_SetTextColor(uint16_t Color);
-void LCD_SetFont(FONT_t *fonts);
-
-void LCD_Draw_Pixel(uint16_t x, uint16_t y, uint16_t color);
-
-// Draw Circle Filled
-void LCD_Draw_Circle_Fill(uint16_t Xpos, uint16_t Ypos, uint16_t radius, uint16_t color);
-
-// Draw Rectangle Filled
-void LCD_Draw_Rectangle_Fill(uint16_t X1, uint16_t Y1, uint16_t X2, uint16_t Y2, uint16_t color);
-
-// Draw Vertical Line
-void LCD_Draw_Vertical_Line(uint16_t x, uint16_t y, uint16_t len, uint16_t color);
-void LCD_Clear(uint8_t LayerIndex, uint16_t Color);
+void LCD_Ui_Apply(void);
+uint32_t LCD_ScanClock(void);
+void LCD_ScanWait(uint32_t clock);
 
 void LCD_Error_Handler(void);
 
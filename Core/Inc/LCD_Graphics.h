@@ -0,0 +1,87 @@
+/*
+ * LCD_Graphics.h
+ *
+ *  Created on: Dec 11, 2024
+ *      Author: Will Fraser
+ */
+
+#ifndef INC_LCD_GRAPHICS_H_
+#define INC_LCD_GRAPHICS_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "fonts.h"
+
+/*
+ * Drawing into the framebuffer. Nothing in here touches the HAL, so the same code
+ * runs in the host tools under Tools/ against a plain array.
+ */
+
+/**
+  * @brief  LCD color RGB565
+  */
+
+#define LCD_COLOR_WHITE         0xFFFF
+#define LCD_COLOR_BLACK         0x0000
+#define LCD_COLOR_GREY          0x18c3
+#define LCD_COLOR_BLUE          0x001F
+#define LCD_COLOR_BLUE2         0x051F
+#define LCD_COLOR_RED           0xF800
+#define LCD_COLOR_MAGENTA       0xF81F
+#define LCD_COLOR_GREEN         0x07E0
+#define LCD_COLOR_CYAN          0x7FFF
+#define LCD_COLOR_YELLOW        0xFFE0
+
+// Custom TETRIS colors
+#define L_BLOCK_COLOR           0x90F3
+#define J_BLOCK_COLOR           0xA514
+#define I_BLOCK_COLOR           0x90E2
+#define O_BLOCK_COLOR           0x0014
+#define T_BLOCK_COLOR           0x9AA3
+#define S_BLOCK_COLOR           0x4D05
+#define Z_BLOCK_COLOR           0x4D1F
+
+#define  LCD_PIXEL_WIDTH    ((uint16_t)240)
+#define  LCD_PIXEL_HEIGHT   ((uint16_t)320)
+#define  LCD_PIXELS		     ((uint32_t)LCD_PIXEL_WIDTH * (uint32_t)LCD_PIXEL_HEIGHT)
+
+#define LCD_CHAR_SPACING   4		// blank columns between characters of a string
+
+// Anchor of LCD_DisplayString and LCD_DisplayNumber
+#define LCD_ALIGN_LEFT     0		// Xpos is the left edge
+#define LCD_ALIGN_CENTER   1		// Xpos is the middle
+#define LCD_ALIGN_RIGHT    2		// Xpos is one past the right edge
+
+#define LCD_NUMBER_DIGITS  10		// longest uint32_t
+
+// Word aligned so two pixels can be written with one store
+extern uint16_t frameBuffer[LCD_PIXEL_WIDTH * LCD_PIXEL_HEIGHT];
+
+void LCD_Draw_Char(uint16_t Xpos, uint16_t Ypos, const uint16_t *c);
+void LCD_DisplayChar(uint16_t Xpos, uint16_t Ypos, uint8_t Ascii);
+void LCD_SetTextColor(uint16_t Color);
+void LCD_SetFont(FONT_t *fonts);
+
+uint16_t LCD_StringWidth(const char *text);
+void LCD_DisplayString(int16_t Xpos, int16_t Ypos, const char *text, uint8_t align);
+void LCD_DisplayNumber(int16_t Xpos, int16_t Ypos, uint32_t value, uint8_t align);
+uint8_t LCD_FormatNumber(uint32_t value, char digits[LCD_NUMBER_DIGITS + 1]);
+
+void LCD_Draw_Pixel(uint16_t x, uint16_t y, uint16_t color);
+
+// Draw Circle Filled
+void LCD_Draw_Circle_Fill(int16_t Xpos, int16_t Ypos, uint16_t radius, uint16_t color);
+
+// Draw Rectangle Filled
+void LCD_Draw_Rectangle_Fill(uint16_t X1, uint16_t Y1, uint16_t X2, uint16_t Y2, uint16_t color);
+
+// Draw Vertical Line
+void LCD_Draw_Vertical_Line(int16_t x, int16_t y, uint16_t len, uint16_t color);
+void LCD_Draw_Horizontal_Line(int16_t x, int16_t y, uint16_t len, uint16_t color);
+
+// Draw Line, any direction, both ends included
+void LCD_Draw_Line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+void LCD_Clear(uint8_t LayerIndex, uint16_t Color);
+
+#endif /* INC_LCD_GRAPHICS_H_ */
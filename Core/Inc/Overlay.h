@@ -0,0 +1,58 @@
+/*
+ * Overlay.h
+ *
+ *  Created on: Dec 14, 2024
+ *      Author: Will Fraser
+ */
+
+#ifndef INC_OVERLAY_H_
+#define INC_OVERLAY_H_
+
+#include <stdint.h>
+
+#include "GameEngine.h"
+#include "TileAtlas.h"
+#include "UiLayer.h"
+#include "Widget.h"
+#include "ScreenImage.h"
+
+// Next piece preview and hold slot, over row 0 of the playfield
+#define PREVIEW_CELL_SIZE ATLAS_MINI_SIZE		// mini cell size in pixels
+#define PREVIEW_SLOT_W    (BLOCK_SIZE * PREVIEW_CELL_SIZE)
+#define PREVIEW_X         (GRID_WIDTH * ATLAS_TILE_SIZE - PREVIEW_COUNT * PREVIEW_SLOT_W) // right edge of row 0
+#define HOLD_X            0		// hold slot sits in the top left cell
+
+// HUD over the top rows of the playfield, Font12x12 on the UI layer
+#define HUD_HEIGHT        60		// rows of the UI window during a game
+#define HUD_SCORE         10		// widgets of gameScreen after the touch zones and labels
+#define HUD_LINES         11
+#define HUD_LEVEL         12
+#define HUD_TIME          13
+#define HUD_PPS           14
+#define HUD_LEVEL_LINES   10		// lines per level
+
+// Start button of the main menu
+#define MENU_BUTTON_X1    20
+#define MENU_BUTTON_Y1    214		// 200 x 72, the window has to fit in UI_LAYER_BYTES
+#define MENU_BUTTON_X2    219
+#define MENU_BUTTON_Y2    285
+
+#define MENU_START        0		// action of the start button
+
+// Number fields of the results screen
+#define RESULTS_TIME      0
+#define RESULTS_LINES     1		// singles, then doubles, triples and tetrises
+#define RESULTS_BEST      5
+
+// Touch areas are in screen pixels, game screen actions are the INPUT_* values
+extern WidgetScreen menuScreen;
+extern WidgetScreen gameScreen;
+extern WidgetScreen resultsScreen;
+
+void Overlay_Menu(void);
+void Overlay_Game(const GameState *game);
+void Overlay_DrawPreview(const GameState *game);
+void Overlay_SetHud(uint32_t elapsed, const uint16_t *score, uint32_t points, uint32_t pieces);
+void Overlay_Results(uint32_t elapsed, const uint16_t *score, uint32_t best);
+
+#endif /* INC_OVERLAY_H_ */
@@ -0,0 +1,84 @@
+/*
+ * PerfectClear.h
+ *
+ *  Created on: Dec 22, 2024
+ *      Author: Will Fraser
+ */
+
+#ifndef INC_PERFECTCLEAR_H_
+#define INC_PERFECTCLEAR_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "GameEngine.h"
+#include "Placement.h"
+
+/*
+ * Whether the board can be emptied with the pieces that are known: the block in play,
+ * the preview queue and the hold slot. The search is depth first over every placement
+ * Placement_FromSpawn finds, one piece after the other, with the hold slot swapped in
+ * wherever that gives another piece. A clear of h rows has to use exactly
+ * (12h - cells) / 4 pieces, all inside the bottom h rows, so every height the pieces
+ * allow is searched from the lowest up. Branches are cut when
+ *  - there are fewer pieces left than the empty cells under the top need,
+ *  - the empty cells in even and odd columns cannot be evened out by the pieces left:
+ *    line clears take 6 of each, I, O, S and Z fill 2 of each or 4 of one, J and L
+ *    always 3 and 1, T either, so the difference is a bound and, without a T, a parity,
+ *  - the board, pieces left and hold slot are in the table of states already found
+ *    to have no clear.
+ * The table and the time budget belong to the caller, on the board a few KB and a
+ * deadline in HAL ticks, on the host as much as it likes with one solver per thread.
+ */
+
+#define PC_MAX_PIECES (PREVIEW_COUNT + 2)	// the block in play, the queue and the hold slot
+#define PC_MAX_HEIGHT 4						// rows a clear may use
+#define PC_MAX_MOVES  128					// placements of one piece on a board under PC_MAX_HEIGHT
+#define PC_CLOCK_EVERY 256					// nodes between looks at the clock
+
+typedef struct {
+	uint8_t blockNum;
+	bool hold;						// swapped with the hold slot first
+	Placement placement;
+} PcStep;
+
+typedef struct {
+	uint16_t rows[GRID_ROWS];
+	uint8_t pieces[PC_MAX_PIECES];	// in the order they come, the block in play first
+	uint8_t pieceCount;
+	uint8_t hold;					// NO_BLOCK when empty
+	bool holdUsed;					// the block in play was already swapped
+} PcProblem;
+
+typedef struct {
+	// set up by the caller
+	uint64_t *table;				// states without a clear, tableMask + 1 entries
+	uint32_t tableMask;
+	uint32_t (*clock)(void);		// no deadline when NULL
+	uint32_t deadline;
+	bool countAll;					// go on after the first clear and count them
+	uint8_t rootFirst;				// only first placements rootFirst, + rootStride, ...
+	uint8_t rootStride;
+
+	// results of the last PcSolver_Solve
+	uint32_t nodes;
+	uint32_t solutions;
+	bool timedOut;
+	uint8_t height;					// rows the first clear found takes
+	uint8_t length;
+	PcStep solution[PC_MAX_PIECES];
+
+	// search state
+	const PcProblem *problem;
+	bool stop;
+	uint16_t rootMove;
+	PcStep path[PC_MAX_PIECES];
+	Placement moves[PC_MAX_PIECES][PC_MAX_MOVES];
+	PlacementSet set;
+} PcSolver;
+
+void PcSolver_Init(PcSolver *solver, uint64_t *table, uint32_t tableSize);
+void PcSolver_FromGame(const GameState *game, PcProblem *problem);
+bool PcSolver_Solve(PcSolver *solver, const PcProblem *problem);
+
+#endif /* INC_PERFECTCLEAR_H_ */
@@ -0,0 +1,32 @@
+/*
+ * PieceBag.h
+ *
+ *  Created on: Dec 6, 2024
+ *      Author: Will Fraser
+ */
+
+#ifndef INC_PIECEBAG_H_
+#define INC_PIECEBAG_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define BAG_SIZE 7 // one of each block per bag
+
+#define BAG_MODE_HARDWARE 0 // shuffle with words from the hardware RNG pool
+#define BAG_MODE_SEEDED   1 // shuffle with a seeded software PRNG, fully repeatable
+
+// 7-bag randomizer, deals I_BLOCK..L_BLOCK (1..7) in a freshly shuffled order each bag
+typedef struct {
+	uint8_t pieces[BAG_SIZE];			// shuffled block numbers
+	uint8_t next;						// index of the next piece to deal
+	uint8_t mode;						// BAG_MODE_HARDWARE or BAG_MODE_SEEDED
+	uint32_t state;						// xorshift32 state
+	bool (*readWord)(uint32_t *word);	// non-blocking hardware word source
+} PieceBag;
+
+void Bag_InitHardware(PieceBag *bag, bool (*readWord)(uint32_t *word));
+void Bag_InitSeeded(PieceBag *bag, uint32_t seed);
+uint8_t Bag_Next(PieceBag *bag);
+
+#endif /* INC_PIECEBAG_H_ */
@@ -0,0 +1,50 @@
+/*
+ * Placement.h
+ *
+ *  Created on: Dec 20, 2024
+ *      Author: Will Fraser
+ */
+
+#ifndef INC_PLACEMENT_H_
+#define INC_PLACEMENT_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "GameEngine.h"
+
+/*
+ * Every place a block can come to rest from where it starts, with the moves the engine
+ * allows: left, right, down and turns in place, so soft drop tucks under overhangs and
+ * turns after landing are found too. A position is the top left of the 4x4 box, as
+ * currentBlockX/Y, and each row of box positions is a bit mask, so a whole row of
+ * positions moves left or right with one shift and drops with one AND. Rotations with
+ * the same cells (O, and the I, S and Z pairs) are merged, each placement is found once.
+ */
+
+#define PLACEMENT_X_BIAS    (BLOCK_SIZE - 1)	// bit of box column x is x + PLACEMENT_X_BIAS
+#define PLACEMENT_COLUMNS   ((1u << (GRID_WIDTH + PLACEMENT_X_BIAS)) - 1)	// box columns -3..11
+#define PLACEMENT_ROTATIONS 4
+
+typedef struct {
+	uint8_t rotation;		// right turns from the spawn shape
+	int8_t x, y;			// top left of the box, engine rows
+} Placement;
+
+typedef struct {
+	uint16_t land[PLACEMENT_ROTATIONS][GRID_ROWS];	// resting positions per rotation and box row
+	uint16_t count;
+} PlacementSet;
+
+void Placement_Init(void);
+
+uint16_t Placement_Generate(const uint16_t *gridRows, uint8_t blockNum, const Placement *start,
+		PlacementSet *set);
+uint16_t Placement_GenerateNaive(const uint16_t *gridRows, uint8_t blockNum,
+		const Placement *start, PlacementSet *set);
+uint16_t Placement_FromSpawn(const uint16_t *gridRows, uint8_t blockNum, PlacementSet *set);
+
+uint16_t Placement_List(const PlacementSet *set, Placement *list, uint16_t max);
+void Placement_Rows(uint8_t blockNum, const Placement *placement, uint16_t rows[BLOCK_SIZE]);
+
+#endif /* INC_PLACEMENT_H_ */
@@ -14,7 +14,9 @@
 #include "stm32f4xx_ll_system.h"
 #include "stm32f4xx_ll_rng.h"
 
-#define NB_OF_GENERATED_RANDOM_NUMBERS 3
+#include <stdbool.h>
+
+#define RNG_POOL_SIZE 16 // random words buffered by the RNG interrupt (power of 2)
 
 #define BUTTON_PORT GPIOA
 #define BUTTON_PIN  GPIO_PIN_0
@@ -25,6 +27,8 @@
 
 void RNG_Init(void);
 uint32_t RandomNumbersGeneration(void);
+bool RNG_PoolRead(uint32_t *word);
+void HASH_RNG_IRQHandler(void);
 uint32_t SetSystemToHSI(void);
 void BUTTON_Init(void);
 
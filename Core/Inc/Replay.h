@@ -0,0 +1,62 @@
+/*
+ * Replay.h
+ *
+ *  Created on: Dec 8, 2024
+ *      Author: Will Fraser
+ */
+
+#ifndef INC_REPLAY_H_
+#define INC_REPLAY_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "GameEngine.h"
+
+/*
+ * Replay stream layout, all multi-byte values little endian
+ *   header : "TRPL", version byte, 32 bit bag seed
+ *   events : varint((ms since previous event << 3) | INPUT_*)
+ *   end    : varint((ms since previous event << 3) | REPLAY_END)
+ *   result : varint per score counter, 32 bit Engine_BoardHash
+ */
+#define REPLAY_MAGIC       "TRPL"
+#define REPLAY_VERSION     2	// 2: hidden spawn rows, games end on block out or lock out
+#define REPLAY_HEADER_SIZE 9
+#define REPLAY_END         7	// event code that closes the input stream
+#define REPLAY_BUFFER_SIZE 4096	// RAM ring buffer for the recorder (power of 2)
+#define REPLAY_FLUSH_LEVEL 2048	// bytes waiting before a game in progress is flushed
+
+// Outcome stored at the end of a replay and produced by replaying it
+typedef struct {
+	uint32_t endTime;			// ms from start to game over
+	uint32_t score[4];			// singles, doubles, triples, tetrises
+	uint32_t boardHash;			// Engine_BoardHash of the final board
+} ReplayResult;
+
+// Reads a replay stream, reentrant so many replays can be read at once
+typedef struct {
+	const uint8_t *data;
+	uint32_t length;
+	uint32_t position;
+	uint32_t time;				// time of the last event read
+	uint32_t seed;
+	bool ended;					// REPLAY_END has been read
+} ReplayPlayer;
+
+// Recorder, one game at a time
+void Replay_StartRecording(uint32_t seed);
+void Replay_RecordInput(uint8_t input, uint32_t time);
+void Replay_StopRecording(const GameState *game);
+bool Replay_Overflowed(void);
+uint32_t Replay_Buffered(void);
+void Replay_Flush(void (*write)(const uint8_t *data, uint32_t length));
+
+// Player
+bool Replay_OpenPlayer(ReplayPlayer *player, const uint8_t *data, uint32_t length);
+bool Replay_NextEvent(ReplayPlayer *player, uint8_t *input, uint32_t *time);
+bool Replay_ReadResult(ReplayPlayer *player, ReplayResult *result);
+bool Replay_Run(GameState *game, const uint8_t *data, uint32_t length,
+		ReplayResult *expected, ReplayResult *actual);
+
+#endif /* INC_REPLAY_H_ */
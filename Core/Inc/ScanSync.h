@@ -0,0 +1,62 @@
+/*
+ * ScanSync.h
+ *
+ *  Created on: Dec 15, 2024
+ *      Author: Will Fraser
+ */
+
+#ifndef INC_SCANSYNC_H_
+#define INC_SCANSYNC_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * Tear free drawing into the single frameBuffer. The LTDC reads the framebuffer one
+ * line at a time from the top, so a band of rows can be written without tearing when
+ * the beam has already passed it, or will not reach it before the write is done.
+ * Drawing code announces each band before writing it and Scan_Band waits, when
+ * chasing is on, until the beam is out of the way. Bands are drawn in y order
+ * starting just below the beam (Scan_StartBand) and wrapping around to the top, so
+ * the band the beam is in comes last and the beam has usually left it by then. A band
+ * too tall to fit between two passes of the beam, like the rows a line clear moves
+ * down, is written bottom up in parts that do, with Scan_BandPart.
+ *
+ * Time is counted in scan lines, the clock and the wait are supplied by the platform
+ * (LCD_ScanClock and LCD_ScanWait on the board, a timing model in Tools/ScanModel).
+ * Without a clock everything here does nothing.
+ */
+
+#define SCAN_FIRST_LINE      4		// sync and back porch lines before row 0
+#define SCAN_TOTAL_LINES     328	// lines per refresh, front porch included
+#define SCAN_BYTES_PER_LINE  2048	// framebuffer bytes written per line time, on the low side
+#define SCAN_MARGIN_LINES    1		// extra lines kept between the beam and a band
+
+typedef struct {
+	uint32_t updates;			// Scan_Begin / Scan_End pairs
+	uint32_t bands;				// bands written
+	uint32_t bytes;				// bytes announced with them
+	uint32_t waits;				// bands that had to wait for the beam
+	uint32_t waitLines;			// lines spent waiting
+	uint32_t renderLines;		// lines spent drawing, waits left out
+	uint32_t maxRenderLines;	// longest single update
+	uint32_t lateBands;			// bands the beam went over while they were written
+	uint32_t tallBands;			// Scan_Band bands that fit neither ahead of nor behind the beam
+	uint32_t parts;				// Scan_BandPart parts, counted in bands too
+	uint32_t partBytes;			// bytes announced with them
+} ScanStats;
+
+void Scan_Init(uint32_t (*clock)(void), void (*waitUntil)(uint32_t clock));
+void Scan_SetChase(bool enabled);
+bool Scan_Chasing(void);
+
+void Scan_Begin(void);
+uint8_t Scan_StartBand(uint16_t height, uint8_t count);
+void Scan_Band(uint16_t top, uint16_t bottom, uint32_t bytes);
+uint16_t Scan_BandPart(uint16_t top, uint16_t bottom, uint32_t bytes);
+void Scan_End(void);
+
+const ScanStats* Scan_GetStats(void);
+void Scan_ResetStats(void);
+
+#endif /* INC_SCANSYNC_H_ */
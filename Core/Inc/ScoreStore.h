@@ -0,0 +1,60 @@
+/*
+ * ScoreStore.h
+ *
+ *  Created on: Dec 10, 2024
+ *      Author: Will Fraser
+ */
+
+#ifndef INC_SCORESTORE_H_
+#define INC_SCORESTORE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define STORE_SECTORS          2		// log rotates between two flash sectors
+#define STORE_LEADERBOARD_SIZE 10
+
+#define STORE_RECORD_TOTALS 1	// sector header, lifetime totals of every game before it
+#define STORE_RECORD_GAME   2	// one finished game
+#define STORE_RECORD_RANKED 3	// leaderboard entry carried over from the previous sector
+#define STORE_RECORD_LINES  4	// upper 16 bits of the lifetime line counts, slot 1 after the header
+
+// Fixed-size log record, 32 bytes so a record is 8 word programs
+typedef struct {
+	uint32_t sequence;			// increases with every record, erased flash reads 0xFFFFFFFF
+	uint32_t type;				// STORE_RECORD_*
+	uint32_t points;			// game score, games played for STORE_RECORD_TOTALS
+	uint32_t elapsed;			// game length in ms, total ms played for STORE_RECORD_TOTALS
+	uint16_t lines[4];			// singles, doubles, triples, tetrises
+	uint32_t seed;				// bag seed (matches replay_<seed>.trp), longest game for STORE_RECORD_TOTALS
+	uint32_t crc;				// CRC-32 of everything before it
+} ScoreRecord;
+
+// Flash access, implemented by FlashPort.c on target and by a file on the host
+typedef struct {
+	const uint8_t *sector[STORE_SECTORS];	// memory-mapped start of each sector
+	uint32_t sectorSize;
+	bool (*erase)(uint8_t sector);
+	bool (*program)(uint8_t sector, uint32_t offset, uint32_t word);
+} FlashPort;
+
+// Lifetime statistics kept in the RAM index
+typedef struct {
+	uint32_t games;
+	uint32_t timePlayed;		// ms
+	uint32_t lines[4];
+	uint32_t bestTime;			// longest game in ms
+} StoreTotals;
+
+void Store_Init(const FlashPort *port);
+void Store_SubmitGame(uint32_t elapsed, const uint16_t lines[4], uint32_t seed);
+bool Store_Service(void);
+bool Store_Pending(void);
+
+uint32_t Store_Points(const uint16_t lines[4]);
+uint8_t Store_LeaderboardCount(void);
+const ScoreRecord* Store_LeaderboardEntry(uint8_t rank);
+const StoreTotals* Store_GetTotals(void);
+uint8_t Store_LastRank(void);
+
+#endif /* INC_SCORESTORE_H_ */
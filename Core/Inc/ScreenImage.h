@@ -0,0 +1,48 @@
+/*
+ * ScreenImage.h
+ *
+ *  Created on: Dec 17, 2024
+ *      Author: Will Fraser
+ */
+
+#ifndef INC_SCREENIMAGE_H_
+#define INC_SCREENIMAGE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "LCD_Graphics.h"
+
+/*
+ * Static screens rendered on the host by Tools/ScreenGen and kept compressed in
+ * flash, so showing one is a single pass over frameBuffer. A screen is a stream of
+ * 16 bit words, each command word followed by its data:
+ *   SCREEN_LITERAL  count pixels follow
+ *   SCREEN_RUN      one pixel follows, written count times
+ *   SCREEN_COPY     a distance follows, count pixels are copied from that many
+ *                   pixels back in frameBuffer, the two may overlap
+ * Pixels are written in order from the top left. ScreenImages.c is generated by
+ * Tools/ScreenGen, do not edit it by hand.
+ */
+
+#define SCREEN_OP_SHIFT    14
+#define SCREEN_COUNT_MASK  0x3FFF	// longest command in pixels
+#define SCREEN_LITERAL     0
+#define SCREEN_RUN         1
+#define SCREEN_COPY        2
+
+// Results screen columns, the labels are in ScreenResults
+#define RESULTS_LABEL_X    32		// left edge of the labels
+#define RESULTS_VALUE_X    208		// right edge of the numbers
+
+typedef struct {
+	const uint16_t *words;
+	uint32_t length;			// words in the stream
+} ScreenImage;
+
+extern const ScreenImage ScreenTitle;		// menu board and title, the button is on the UI layer
+extern const ScreenImage ScreenResults;		// results labels, the numbers are drawn over them
+
+bool Screen_Decode(const ScreenImage *image);
+
+#endif /* INC_SCREENIMAGE_H_ */
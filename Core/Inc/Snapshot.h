@@ -0,0 +1,47 @@
+/*
+ * Snapshot.h
+ *
+ *  Created on: Dec 25, 2024
+ *      Author: Will Fraser
+ */
+
+#ifndef INC_SNAPSHOT_H_
+#define INC_SNAPSHOT_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "GameEngine.h"
+
+/*
+ * A game position in SNAPSHOT_SIZE bytes, against close to 800 for a GameState.
+ * Fields are bit packed, low bits first:
+ *   clock   : engineTime, nextGravity - engineTime
+ *   score   : the four clear counters
+ *   bag     : xorshift state, the order of the bag as a permutation rank, next
+ *   hold    : holdUsed, softDrop, gameOver, holdBlock
+ *   queue   : block numbers from the next piece on
+ *   piece   : block number, x, y and its 4x4 box
+ *   rows    : occupancy, GRID_WIDTH bits per row
+ *   colours : a block number per filled cell, top row first, left to right
+ * A row is never left full, so the colours fit in the worst case. Everything else in
+ * a GameState is worked out again on restore, the rest of the snapshot is zero, so
+ * two positions are the same game exactly when their snapshots compare equal.
+ * Only games with a seeded bag can be saved, a hardware bag has no state to keep.
+ */
+
+#define SNAPSHOT_GRAVITY_BITS 11		// nextGravity is never more than FRAMERATE ahead
+#define SNAPSHOT_MAX_CELLS    (GRID_ROWS * (GRID_WIDTH - 1))
+#define SNAPSHOT_FIXED_BITS   (32 + SNAPSHOT_GRAVITY_BITS + 4 * 16 + 32 + 13 + 3 + 3 + 3 \
+		+ PREVIEW_COUNT * 3 + 3 + 4 + 5 + BLOCK_SIZE * BLOCK_SIZE + GRID_ROWS * GRID_WIDTH)
+#define SNAPSHOT_SIZE         ((SNAPSHOT_FIXED_BITS + 3 * SNAPSHOT_MAX_CELLS + 7) / 8)
+
+typedef struct {
+	uint8_t bytes[SNAPSHOT_SIZE];
+} Snapshot;
+
+bool Snapshot_Save(const GameState *game, Snapshot *snapshot);
+void Snapshot_Restore(GameState *game, const Snapshot *snapshot);
+bool Snapshot_Equal(const Snapshot *a, const Snapshot *b);
+
+#endif /* INC_SNAPSHOT_H_ */
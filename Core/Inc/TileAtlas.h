@@ -0,0 +1,27 @@
+/*
+ * TileAtlas.h
+ *
+ *  Created on: Dec 12, 2024
+ *      Author: Will Fraser
+ */
+
+#ifndef INC_TILEATLAS_H_
+#define INC_TILEATLAS_H_
+
+#include <stdint.h>
+
+#include "LCD_Graphics.h"
+
+//#define ATLAS_BEVEL // uncomment for shaded cell edges instead of the flat grey border
+
+#define ATLAS_TILE_SIZE  20		// playfield cell in pixels
+#define ATLAS_MINI_SIZE  4		// preview and hold cell in pixels
+#define ATLAS_COLORS     8		// EMPTY_CELL then I_BLOCK..L_BLOCK
+
+void Atlas_Init(void);
+uint16_t Atlas_Color(uint8_t blockNum);
+void Atlas_DrawCell(uint16_t x, uint16_t y, uint8_t blockNum);
+void Atlas_DrawGhost(uint16_t x, uint16_t y, uint8_t blockNum);
+void Atlas_DrawMini(uint16_t x, uint16_t y, uint8_t blockNum);
+
+#endif /* INC_TILEATLAS_H_ */
@@ -0,0 +1,64 @@
+/*
+ * UiLayer.h
+ *
+ *  Created on: Dec 14, 2024
+ *      Author: Will Fraser
+ */
+
+#ifndef INC_UILAYER_H_
+#define INC_UILAYER_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "LCD_Graphics.h"
+
+/*
+ * Menus and the HUD are drawn into a window on LTDC layer 1, blended over the
+ * playfield in frameBuffer by the LTDC. The window is L8, one byte per pixel looked
+ * up in a small CLUT, and only as big as the screen in use needs. Everything here is
+ * plain memory like LCD_Graphics.c; LCD_Ui_Apply in LCD_Driver.c hands the window
+ * to the LTDC. Coordinates are screen pixels, drawing is clipped to the window.
+ *
+ * The LTDC cannot fetch from CCM, so the buffer takes main SRAM next to the 153600
+ * bytes of frameBuffer and is kept to the largest window: the HUD rows of a game,
+ * GRID_WIDTH cells by HUD_HEIGHT rows, 240 x 60. The menu's start button, 200 x 72,
+ * fits in the same, Overlay.c checks both at compile time.
+ */
+
+#define UI_LAYER_BYTES   14400	// largest window, the HUD rows of a game
+#define UI_ALPHA         255	// constant alpha of layer 1
+
+// Palette indices, 1..7 are the cell values so preview blocks are drawn by number
+#define UI_CLEAR         0		// color keyed, the playfield shows through
+#define UI_BLACK         8
+#define UI_WHITE         9
+#define UI_GREY          10
+#define UI_GREEN         11
+#define UI_PALETTE_SIZE  12
+
+#define UI_KEY_RGB       0xFF00FE	// RGB888 of UI_CLEAR, no RGB565 color expands to it
+
+typedef struct {
+	uint16_t x, y;				// top left on screen
+	uint16_t width, height;
+	bool visible;
+} UiWindow;
+
+// Read by the LTDC, so in SRAM and word aligned like frameBuffer
+extern uint8_t uiBuffer[UI_LAYER_BYTES];
+extern UiWindow uiWindow;
+
+bool Ui_SetWindow(uint16_t x, uint16_t y, uint16_t width, uint16_t height);
+void Ui_Hide(void);
+uint32_t Ui_ExpandRGB565(uint16_t color);
+uint32_t Ui_PaletteRGB(uint8_t index);
+
+void Ui_Fill(int16_t x, int16_t y, uint16_t width, uint16_t height, uint8_t index);
+void Ui_Box(int16_t X1, int16_t Y1, int16_t X2, int16_t Y2, uint8_t index);
+
+void Ui_SetFont(FONT_t *fonts);
+void Ui_SetTextColor(uint8_t index);
+void Ui_DisplayString(int16_t Xpos, int16_t Ypos, const char *text, uint8_t align);
+
+#endif /* INC_UILAYER_H_ */
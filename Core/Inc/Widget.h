@@ -0,0 +1,105 @@
+/*
+ * Widget.h
+ *
+ *  Created on: Dec 18, 2024
+ *      Author: Will Fraser
+ */
+
+#ifndef INC_WIDGET_H_
+#define INC_WIDGET_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "LCD_Graphics.h"
+#include "ScanSync.h"
+
+/*
+ * Retained screens. A screen is an array of widgets with parents before their
+ * children, it stays set up while it is shown and only what the dirty widgets
+ * changed is drawn again, so a screen that does not change costs nothing to keep up
+ * to date. Text is handled as a row of glyph cells: each widget remembers the text
+ * it has on screen, and only the cells whose character changed are damaged, so a
+ * counter going from 129 to 130 redraws two glyphs. The damaged pixels are collected
+ * as rectangles, grown to take in the boxes and glyph cells they cut through, and
+ * each one is cleared and has what is inside it drawn again in array order. Each
+ * rectangle is announced to ScanSync before it is written and counted in the stats.
+ *
+ * Touches are looked up in the same arrays: the last widget with an action that
+ * contains the point wins, so children and later widgets are on top.
+ */
+
+#define WIDGET_PANEL    0		// filled box with a grey border
+#define WIDGET_BUTTON   1		// panel with an action, its label is a child
+#define WIDGET_LABEL    2		// text
+#define WIDGET_NUMBER   3		// decimal value, decimals digits after the point
+#define WIDGET_CLOCK    4		// value in seconds as m:ss
+#define WIDGET_ZONE     5		// touch area with an action, not drawn
+
+#define WIDGET_NONE     0xFF	// no parent, or no widget at a point
+#define WIDGET_NO_ACTION 0xFF
+
+#define WIDGET_DAMAGE_RECTS 8	// merged into fewer, larger rectangles beyond this
+#define WIDGET_TEXT_MAX  12		// characters of text shown, longer labels are cut
+
+typedef struct {
+	int16_t x, y;
+	uint16_t width, height;
+} WidgetRect;
+
+// Where a screen draws, colors are RGB565 for the framebuffer and palette indices for the UI layer
+typedef struct {
+	void (*box)(int16_t X1, int16_t Y1, int16_t X2, int16_t Y2, uint16_t color);
+	void (*fill)(int16_t x, int16_t y, uint16_t width, uint16_t height, uint16_t color);
+	void (*text)(int16_t x, int16_t y, const char *text, uint8_t align, FONT_t *font,
+			uint16_t color);
+	uint8_t pixelBytes;
+} WidgetSurface;
+
+typedef struct {
+	uint8_t type;
+	uint8_t parent;			// index of the enclosing panel or button, WIDGET_NONE at the root
+	uint8_t action;			// buttons and zones, reported by Widget_HitTest
+	uint8_t align;			// text: LCD_ALIGN_*, x is the anchor
+	int16_t x, y;			// top left, or text anchor and top
+	uint16_t width, height;	// boxes and zones, text is measured
+	uint16_t color;			// box fill or text color
+	FONT_t *font;
+	const char *text;
+	uint32_t value;
+	uint8_t decimals;		// numbers: digits after the point
+
+	bool dirty;
+	int16_t left;								// text: left edge of the glyphs to show
+	int16_t shownLeft;							// text: left edge of the glyphs on screen
+	char current[WIDGET_TEXT_MAX + 1];			// text: what the widget shows now
+	char shown[WIDGET_TEXT_MAX + 1];			// text: what is on screen, empty for nothing
+} Widget;
+
+typedef struct {
+	const WidgetSurface *surface;
+	Widget *widgets;
+	uint8_t count;
+	uint16_t background;	// color behind the root widgets
+	bool dirty;				// any widget dirty
+
+	WidgetRect damage[WIDGET_DAMAGE_RECTS];
+	uint8_t damageCount;
+	uint32_t damagePixels;	// area redrawn since Widget_ResetStats
+	uint32_t renders;		// Widget_Render calls that drew anything
+} WidgetScreen;
+
+extern const WidgetSurface widgetFrame;		// layer 0, frameBuffer
+extern const WidgetSurface widgetUi;		// layer 1, the UI window
+
+void Widget_InvalidateAll(WidgetScreen *screen);
+void Widget_InvalidateValues(WidgetScreen *screen);
+void Widget_Invalidate(WidgetScreen *screen, uint8_t index);
+void Widget_SetNumber(WidgetScreen *screen, uint8_t index, uint32_t value);
+void Widget_SetText(WidgetScreen *screen, uint8_t index, const char *text);
+
+bool Widget_Render(WidgetScreen *screen);
+uint8_t Widget_HitTest(const WidgetScreen *screen, int16_t x, int16_t y);
+void Widget_ResetStats(WidgetScreen *screen);
+
+#endif /* INC_WIDGET_H_ */
@@ -7,609 +7,654 @@
 
 #include "ApplicationCode.h"
 
-// define block struct to store color and shape info for each block
-typedef struct {
-	uint8_t shape[BLOCK_SIZE][BLOCK_SIZE]; // 4x4 matrix for block shape
-	uint16_t color;                        // color of the block
-} TetrisBlock;
-
-// define standard tetris blocks
-const TetrisBlock tetrisBlocks[7] = { { { { 0, 0, 0, 0 }, { 1, 1, 1, 1 }, { 0,
-		0, 0, 0 }, { 0, 0, 0, 0 } }, I_BLOCK_COLOR }, // I Block
-		{ { { 0, 0, 0, 0 }, { 0, 1, 1, 0 }, { 0, 1, 1, 0 }, { 0, 0, 0, 0 } },
-		O_BLOCK_COLOR }, // O Block
-		{ { { 0, 0, 1, 0 }, { 0, 0, 1, 1 }, { 0, 0, 1, 0 }, { 0, 0, 0, 0 } },
-		T_BLOCK_COLOR }, // T Block
-		{ { { 0, 0, 1, 1 }, { 0, 1, 1, 0 }, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
-		S_BLOCK_COLOR }, // S Block
-		{ { { 0, 1, 1, 0 }, { 0, 0, 1, 1 }, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
-		Z_BLOCK_COLOR }, // Z Block
-		{ { { 0, 0, 0, 0 }, { 0, 1, 1, 1 }, { 0, 0, 0, 1 }, { 0, 0, 0, 0 } },
-		J_BLOCK_COLOR }, // J Block
-		{ { { 0, 0, 0, 1 }, { 0, 1, 1, 1 }, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
-		L_BLOCK_COLOR }  // L Block
-};
-
 // Static variables
-static bool menuTouched;
-static uint8_t score[4];
+static GameState game;				// the game on screen, the engine keeps none of its own
+static FinesseTracker finesse;		// touches on the block in play
+static bool previewVisible;
+static uint32_t gameOverTick;		// for the game over to results time
+
+// HUD redraw cost over a game, in cycles
+static uint32_t hudRenders;
+static uint32_t hudCycles;
+static uint32_t hudMaxCycles;
+
+#ifdef PLACEMENT_BENCH
+// Placement search on the board each next block spawns on, bit masks against naive, in cycles
+static uint32_t placementBlocks;
+static uint32_t placementsFound;
+static uint32_t placementCycles;
+static uint32_t placementNaiveCycles;
+static void TimePlacements(void);
+#endif
+
+#ifdef PC_TRAINING
+// 11 KB that main SRAM has no room for next to the frame buffer, so in CCM with the tile
+// atlas. Neither is loaded or cleared: PcSolver_Init sets the solver up, each solve the table
+#define PC_SECTION __attribute__((section(".ccmnoload")))
+
+static PcSolver pcSolver PC_SECTION;
+static PcProblem pcProblem;
+static uint64_t pcTable[PC_TABLE_SIZE] PC_SECTION;
+static void ShowPerfectClear(void);
+#endif
+
+#ifdef PRACTICE_REWIND
+// The game at each of the last blocks spawned, a ring
+static Snapshot practiceHistory[PRACTICE_HISTORY];
+static uint8_t practiceNext;		// where the next snapshot goes
+static uint8_t practiceCount;
+static uint8_t practiceRewinds;
+static uint32_t practicePieces;		// pieces placed at the last snapshot
+static void PracticeSave(void);
+static bool PracticeRewind(void);
+#endif
+
+#ifdef EVAL_BENCH
+// Board evaluator kernels on a batch of the board each new block spawns on, in cycles
+static uint32_t evalBatches;
+static uint32_t evalScalarCycles;
+static uint32_t evalDspCycles;
+static uint32_t evalDiffer;
+static void TimeEval(void);
+#endif
+
+#if defined(BOT_HINTS) || defined(BOT_PLAY)
+// Bot choices over a game, from the table or the search, in cycles
+static uint32_t botBlocks;
+static uint32_t botHits;
+static uint32_t botCycles;
+static void BotMove(void);
+#endif
 
 // Function prototypes
 extern void initialise_monitor_handles(void);
+static void StartCycleCounter(void);
+static uint32_t CyclesToMicros(uint32_t cycles);
+static void ShowMainMenu(void);
+static void ShowResultsScreen(void);
 void LCDTouchScreenInterruptGPIOInit(void);
-
-// Game variables
-static uint16_t gameGrid[GRID_HEIGHT][GRID_WIDTH]; 		// game state array
-static uint16_t currentBlock[GRID_HEIGHT][GRID_WIDTH]; 	// current block array
-static uint8_t currentBlockX;
-static uint8_t currentBlockY;
+static void PostInput(uint8_t input);
+static void ProcessInputs(void);
+static void ReportFinesse(bool fault);
+static uint8_t PracticeRewinds(void);
+static void OpenReplay(uint32_t seed);
+static void WriteReplayChunk(const uint8_t *data, uint32_t length);
+static void CloseReplay(bool keep);
 
 // Touch variables
 static STMPE811_TouchData StaticTouchData;
 static EXTI_HandleTypeDef LCDTouchIRQ;
-volatile bool userButtonPressed = false;
+
+// Inputs from the touch and button interrupts, handled by the main loop in order
+typedef struct {
+	uint8_t input;
+	uint32_t time;			// ms since the start of the game
+} InputEvent;
+
+static volatile InputEvent inputQueue[INPUT_QUEUE_SIZE];
+static volatile uint8_t inputHead;
+static volatile uint8_t inputTail;
+
+// Start pressed in the touch interrupt, the game is started from the main loop
+static volatile bool startRequested;
 
 void ApplicationInit(void) {
 	initPeripherals();					// Initializes all peripherals
+	Store_Init(&scoreFlash);			// Builds the high score index from flash
+	Scan_Init(LCD_ScanClock, LCD_ScanWait);	// render time is measured in scan lines
+#ifdef SCAN_CHASE
+	Scan_SetChase(true);
+#endif
+#if defined(PLACEMENT_BENCH) || defined(PC_TRAINING) || defined(BOT_HINTS) || defined(BOT_PLAY)
+	Placement_Init();
+#endif
+#ifdef PC_TRAINING
+	PcSolver_Init(&pcSolver, pcTable, PC_TABLE_SIZE);
+	pcSolver.clock = HAL_GetTick;
+#endif
 	addSchedulerEvent(MAIN_MENU);		// Starts game in main menu first
+	ShowMainMenu();
 }
 
 // Initialize peripherals
 void initPeripherals(void) {
 	initialise_monitor_handles(); // Allows printf functionality
+	StartCycleCounter();		  // times the screen draws
 
 	// Initialize LCD, RNG, Timer, Button, and Touch
 	LCD_Init();
+	Atlas_Init();			// cell tiles, before anything is drawn
 	RNG_Init();
 	TIMER_Init();
 	BUTTON_Init();
 	InitializeLCDTouch();
 	LCDTouchScreenInterruptGPIOInit();
-	menuTouched = false;
 
 	// Top left would be low x value, high y value. Bottom right would be low x value, low y value.
 	StaticTouchData.orientation = STMPE811_Orientation_Portrait_2;
 }
 
-// Displays main menu
-void displayMainMenu(void) {
-	if (menuTouched == false) {	// checks menuTouched flag to not display menu more than once
-		InitGameGrid();
-
-		arrangeBlocks();			// positions blocks in starting position
-
-		DrawGameGrid();				// show grid
-
-		LCD_Draw_Rectangle_Fill(20, 200, 219, 299, LCD_COLOR_BLACK);// button box
+// Draws the whole main menu once
+static void ShowMainMenu(void) {
+	uint32_t start = DWT->CYCCNT;
+	previewVisible = false;
 
-		// Title
-		LCD_SetFont(&Font16x24);
-		LCD_SetTextColor(LCD_COLOR_WHITE);
-		LCD_DisplayChar(62, 21, 'T');
-		LCD_DisplayChar(82, 21, 'E');
-		LCD_DisplayChar(102, 21, 'T');
-		LCD_DisplayChar(122, 21, 'R');
-		LCD_DisplayChar(142, 21, 'I');
-		LCD_DisplayChar(162, 21, 'S');
+	// board and title, rendered by Tools/ScreenGen, startGame repaints the board
+	Screen_Decode(&ScreenTitle);
 
-		// Start button
-		LCD_SetTextColor(LCD_COLOR_GREEN);
-		LCD_DisplayChar(102, 241, 'G');
-		LCD_DisplayChar(122, 241, 'O');
+	// Start button, on the UI layer
+	Overlay_Menu();
+	LCD_Ui_Apply();
 
-		menuTouched = true;							// sets flag
+	printf("\nMENU %" PRIu32 " ms after boot, drawn in %" PRIu32 " us", HAL_GetTick(),
+			CyclesToMicros(DWT->CYCCNT - start));
+}
 
+// Keeps the main menu up to date, nothing to draw while nothing changes
+void displayMainMenu(void) {
+	// starting opens the replay file over semihosting, never done in the interrupt
+	if (startRequested) {
+		startRequested = false;
+		removeSchedulerEvent(MAIN_MENU);
+		addSchedulerEvent(GAME);
+		startGame();
+		return;
 	}
+	Widget_Render(&menuScreen);
 }
 
 // Timer variables
-static uint32_t lastUpdate;
 static uint32_t startTime;
+static uint32_t gameSeed;
+static FILE *replayFile;				// open from the start of a game to its end
+static char replayName[] = REPLAY_FILE_PREFIX "00000000.trp";
 
 // Start the game
 void startGame(void) {
-	InitGameGrid();
-
-	GenerateBlock(RANDOM_BLOCK);
+#ifdef BAG_SEED
+	gameSeed = BAG_SEED;
+#else
+	gameSeed = RandomNumbersGeneration(); // pool is prefilled, does not wait
+#endif
+
+	Engine_NewGame(&game, gameSeed);
+	Replay_StartRecording(gameSeed);
+	OpenReplay(gameSeed);
+	Finesse_Reset(&finesse, &game);
+
+	// drop anything left over from the menu
+	inputTail = inputHead;
+	previewVisible = true;
+
+	Engine_TakeChanges(&game);
+	Scan_ResetStats();
+	Board_Invalidate();
 	DrawGameGrid();
-
-	lastUpdate = HAL_GetTick(); // Get the current tick count at startup
-	startTime = lastUpdate;
-
+	Overlay_Game(&game);				// hold slot, preview panel and HUD on the UI layer
+	LCD_Ui_Apply();
+
+	hudRenders = 0;
+	hudCycles = 0;
+	hudMaxCycles = 0;
+	Widget_ResetStats(&gameScreen);
+#ifdef PLACEMENT_BENCH
+	placementBlocks = 0;
+	placementsFound = 0;
+	placementCycles = 0;
+	placementNaiveCycles = 0;
+#endif
+#ifdef PRACTICE_REWIND
+	practiceNext = 0;
+	practiceCount = 0;
+	practiceRewinds = 0;
+	practicePieces = 0;
+	Snapshot_Save(&game, &practiceHistory[practiceNext++]);
+	practiceCount++;
+#endif
+#ifdef EVAL_BENCH
+	evalBatches = 0;
+	evalScalarCycles = 0;
+	evalDspCycles = 0;
+	evalDiffer = 0;
+#endif
+#if defined(BOT_HINTS) || defined(BOT_PLAY)
+	botBlocks = 0;
+	botHits = 0;
+	botCycles = 0;
+#endif
+
+	startTime = HAL_GetTick(); // Get the current tick count at startup
 }
 
 // Update game screen
 void updateGameScreen(void) {
+	// game time is read before the queue is drained, anything posted later is at or after it
+	uint32_t currentTime = HAL_GetTick() - startTime;
 
-	uint32_t currentTime = HAL_GetTick();
+	ProcessInputs();
+	Engine_Advance(&game, currentTime);
+	ReportFinesse(Finesse_Update(&finesse, &game));
 
-	// Only move block once per second
-	if ((currentTime - lastUpdate >= FRAMERATE) || (userButtonPressed)) {
-		if (MoveCurrentBlock(MOVE_DOWN)) {
-			// If move down returns true, place block
-			printf("\nPLACE BLOCK");
-			PlaceCurrentBlock();
-			GenerateBlock(RANDOM_BLOCK);
-		}
-		// update screen
+	// only redraw what the engine changed
+	uint8_t changes = Engine_TakeChanges(&game);
+	if (changes & ENGINE_CHANGED_GRID) {
 		DrawGameGrid();
+	}
+	if (changes & ENGINE_CHANGED_QUEUE) {
+		Overlay_DrawPreview(&game);
+#ifdef PLACEMENT_BENCH
+		TimePlacements();
+#endif
+#ifdef EVAL_BENCH
+		TimeEval();
+#endif
+#ifdef PC_TRAINING
+		if (!Engine_IsOver(&game)) {
+			ShowPerfectClear();
+		}
+#endif
+#if defined(BOT_HINTS) || defined(BOT_PLAY)
+		if (!Engine_IsOver(&game)) {
+			BotMove();
+		}
+#endif
+#ifdef PRACTICE_REWIND
+		if (!Engine_IsOver(&game)) {
+			PracticeSave();
+		}
+#endif
+	}
 
-		// update time
-		lastUpdate = currentTime;
+	// HUD values are compared every pass, the digits that changed are drawn on a pass
+	// that left the playfield alone so they never add to a gravity step
+	Overlay_SetHud(Engine_Elapsed(&game), Engine_GetScore(&game),
+			Store_Points(Engine_GetScore(&game)), Engine_PiecesPlaced(&game));
+	if (!(changes & ENGINE_CHANGED_GRID)) {
+		uint32_t start = DWT->CYCCNT;
+		if (Widget_Render(&gameScreen)) {
+			uint32_t cycles = DWT->CYCCNT - start;
+			hudRenders++;
+			hudCycles += cycles;
+			hudMaxCycles = (cycles > hudMaxCycles) ? cycles : hudMaxCycles;
+		}
 	}
-}
 
-// Display results screen
-void displayResultsScreen(void) {
-	// calculate total game time
-	lastUpdate = HAL_GetTick() - startTime;
-
-	// create buffer and store char version of game length
-	char buffer[11];
-	snprintf(buffer, sizeof(buffer), "%lu", lastUpdate);
-
-	LCD_Clear(0, LCD_COLOR_BLACK);
-	LCD_SetTextColor(LCD_COLOR_WHITE);
-
-	LCD_DisplayChar(72, 61, 'T');
-	LCD_DisplayChar(92, 61, 'O');
-	LCD_DisplayChar(112, 61, 'T');
-	LCD_DisplayChar(132, 61, 'A');
-	LCD_DisplayChar(152, 61, 'L');
-
-	LCD_DisplayChar(52, 81, 'T');
-	LCD_DisplayChar(72, 81, 'I');
-	LCD_DisplayChar(92, 81, 'M');
-	LCD_DisplayChar(112, 81, 'E');
-	LCD_DisplayChar(132, 81, ' ');
-	LCD_DisplayChar(152, 81, 'M');
-	LCD_DisplayChar(172, 81, 'S');
-
-	uint16_t current_x = 80;
-
-	// Step through each char and display
-	for (int i = 0; buffer[i] != '\0'; i++) {
-		LCD_DisplayChar(current_x, 121, buffer[i]); // display the current char
-		current_x += 20; // Move to the next character position
+	// long games outgrow the recorder, a semihosting write stops the core so it waits
+	// for a pass that did not draw the playfield
+	if (!(changes & ENGINE_CHANGED_GRID) && (replayFile != NULL)
+			&& (Replay_Buffered() >= REPLAY_FLUSH_LEVEL)) {
+		Replay_Flush(WriteReplayChunk);
 	}
 
-	LCD_DisplayChar(32, 181, 'S');
-	LCD_DisplayChar(52, 181, 'I');
-	LCD_DisplayChar(72, 181, 'N');
-	LCD_DisplayChar(92, 181, 'G');
-	LCD_DisplayChar(112, 181, 'L');
-	LCD_DisplayChar(132, 181, 'E');
-	LCD_DisplayChar(152, 181, 'S');
-
-	LCD_DisplayChar(192, 181, score[0] + '0');
-
-	LCD_DisplayChar(32, 201, 'D');
-	LCD_DisplayChar(52, 201, 'O');
-	LCD_DisplayChar(72, 201, 'U');
-	LCD_DisplayChar(92, 201, 'B');
-	LCD_DisplayChar(112, 201, 'L');
-	LCD_DisplayChar(132, 201, 'E');
-	LCD_DisplayChar(152, 201, 'S');
-
-	LCD_DisplayChar(192, 201, score[1] + '0');
-
-	LCD_DisplayChar(32, 221, 'T');
-	LCD_DisplayChar(52, 221, 'R');
-	LCD_DisplayChar(72, 221, 'I');
-	LCD_DisplayChar(92, 221, 'P');
-	LCD_DisplayChar(112, 221, 'L');
-	LCD_DisplayChar(132, 221, 'E');
-	LCD_DisplayChar(152, 221, 'S');
-
-	LCD_DisplayChar(192, 221, score[2] + '0');
-
-	LCD_DisplayChar(32, 241, 'T');
-	LCD_DisplayChar(52, 241, 'E');
-	LCD_DisplayChar(72, 241, 'T');
-	LCD_DisplayChar(92, 241, 'R');
-	LCD_DisplayChar(112, 241, 'I');
-	LCD_DisplayChar(132, 241, 'S');
-	LCD_DisplayChar(152, 241, '!');
-
-	LCD_DisplayChar(192, 241, score[3] + '0');
-
-	removeSchedulerEvent(RESULTS);
-}
+#ifdef PRACTICE_REWIND
+	if (Engine_IsOver(&game) && PracticeRewind()) {
+		return;
+	}
+#endif
+	if (Engine_IsOver(&game)) {
+		printf("\nGAME OVER");
+		gameOverTick = HAL_GetTick();
+		Replay_StopRecording(&game);
+		if (PracticeRewinds() != 0) {
+			// the replay no longer plays back and the score was not made in one go
+			printf("\nPRACTICE %u rewinds, not saved or ranked", PracticeRewinds());
+			CloseReplay(false);
+		} else {
+			CloseReplay(true);
 
-void InitGameGrid(void) {
-	for (uint16_t y = 0; y < GRID_HEIGHT; y++) {
-		for (uint16_t x = 0; x < GRID_WIDTH; x++) {
-			gameGrid[y][x] = EMPTY_CELL; // initialize all cells as empty
+			// written to flash later from idle time
+			Store_SubmitGame(Engine_Elapsed(&game), Engine_GetScore(&game), gameSeed);
+			printf("\nRANK %u", Store_LastRank() + 1);
 		}
-	}
-}
 
-// iterates through each grid position in array and displays it
-void DrawGameGrid(void) {
-	for (uint16_t y = 0; y < GRID_HEIGHT; y++) {
-		for (uint16_t x = 0; x < GRID_WIDTH; x++) {
-			uint16_t color = gameGrid[y][x];
-			if (color == EMPTY_CELL) {
-				color = currentBlock[y][x];
-			}
-			LCD_Draw_Rectangle_Fill(x * CELL_SIZE, y * CELL_SIZE,
-					(x + 1) * CELL_SIZE - 1, (y + 1) * CELL_SIZE - 1, color);
+		// how much of a 320 line refresh the playfield took to draw
+		const ScanStats *scan = Scan_GetStats();
+		printf("\nRENDER %" PRIu32 " updates, %" PRIu32 " lines total, max %" PRIu32
+				" of %u lines, %" PRIu32 " waits, %" PRIu32 " late bands, %" PRIu32
+				" tall bands, %" PRIu32 " shift parts",
+				scan->updates, scan->renderLines, scan->maxRenderLines, LCD_PIXEL_HEIGHT,
+				scan->waits, scan->lateBands, scan->tallBands, scan->parts);
+		printf("\nHUD %" PRIu32 " updates, %" PRIu32 " us average, max %" PRIu32 " us, %"
+				PRIu32 " pixels", hudRenders,
+				(hudRenders == 0) ? 0 : CyclesToMicros(hudCycles / hudRenders),
+				CyclesToMicros(hudMaxCycles), gameScreen.damagePixels);
+		printf("\nFINESSE %" PRIu32 " blocks judged, %" PRIu32 " faults, %" PRIu32
+				" extra touches", finesse.judged, finesse.faults, finesse.extraPresses);
+#ifdef PLACEMENT_BENCH
+		if (placementBlocks != 0) {
+			printf("\nPLACEMENT %" PRIu32 " blocks, %" PRIu32 " placements, %" PRIu32
+					" us bit masks, %" PRIu32 " us naive, %" PRIu32 " placements/s",
+					placementBlocks, placementsFound,
+					CyclesToMicros(placementCycles / placementBlocks),
+					CyclesToMicros(placementNaiveCycles / placementBlocks),
+					(uint32_t) ((uint64_t) placementsFound * SystemCoreClock / placementCycles));
+		}
+#endif
+#ifdef EVAL_BENCH
+		if (evalBatches != 0) {
+			printf("\nEVAL %" PRIu32 " batches, scalar %" PRIu32 " boards/s, dsp %" PRIu32
+					" boards/s, %" PRIu32 " differ", evalBatches,
+					(uint32_t) ((uint64_t) evalBatches * EVAL_BATCH * SystemCoreClock
+							/ evalScalarCycles),
+					(evalDspCycles == 0) ? 0 : (uint32_t) ((uint64_t) evalBatches * EVAL_BATCH
+							* SystemCoreClock / evalDspCycles), evalDiffer);
+		}
+#endif
+#if defined(BOT_HINTS) || defined(BOT_PLAY)
+		if (botBlocks != 0) {
+			printf("\nBOT %" PRIu32 " blocks, %" PRIu32 " from the table, %" PRIu32
+					" us average", botBlocks, botHits, CyclesToMicros(botCycles / botBlocks));
 		}
+#endif
+
+		addSchedulerEvent(RESULTS);
+		removeSchedulerEvent(GAME);
+		ShowResultsScreen();
 	}
 }
 
-// Create block in currentBlock array
-void GenerateBlock(uint8_t blockIndex) {
+// Draws the whole results screen once
+static void ShowResultsScreen(void) {
+	uint32_t start = DWT->CYCCNT;
 
-	// check if user wants random block
-	if (blockIndex == RANDOM_BLOCK) {
-		blockIndex = RandomNumbersGeneration() % 7;
-	} else {
-		blockIndex--;
-	}
+	Ui_Hide();
+	LCD_Ui_Apply();
 
-	// set block starting position
-	currentBlockY = 0;
-	currentBlockX = 4;
+	// labels from flash, only the numbers are drawn
+	Overlay_Results(Engine_Elapsed(&game), Engine_GetScore(&game),
+			Store_LeaderboardEntry(0)->points);
 
-	// copy block data
-	for (uint8_t y = 0; y < BLOCK_SIZE; y++) {
-		for (uint8_t x = 0; x < BLOCK_SIZE; x++) {
-			if (tetrisBlocks[blockIndex].shape[y][x] == 1) {
-				currentBlock[y][x + 4] = tetrisBlocks[blockIndex].color;
-			}
-		}
-	}
+	printf("\nRESULTS %" PRIu32 " ms after game over, drawn in %" PRIu32 " us",
+			HAL_GetTick() - gameOverTick, CyclesToMicros(DWT->CYCCNT - start));
 }
 
-bool MoveCurrentBlock(uint8_t direction) {
-	uint16_t tempBlock[GRID_HEIGHT][GRID_WIDTH] = { 0 }; // temp buffer to store the shifted block
-
-	switch (direction) {
-	case MOVE_DOWN:
-		for (uint16_t y = GRID_HEIGHT - 1; y > 0; y--) {
-			for (uint16_t x = 0; x < GRID_WIDTH; x++) {
-				if ((currentBlock[y - 1][x] != EMPTY_CELL)
-						&& (gameGrid[y][x] != EMPTY_CELL)) {
-					return true;
-				} else if ((currentBlock[y][x] != EMPTY_CELL)
-						&& (y == GRID_HEIGHT - 1)) {
-					return true;
-				}
-				// check if block can be moved and shift tempBlock
-				tempBlock[y][x] = currentBlock[y - 1][x];
-			}
-		}
-		currentBlockY++;
-		break;
-
-	case MOVE_UP:
-		for (uint16_t y = 0; y < GRID_HEIGHT - 1; y++) {
-			for (uint16_t x = 0; x < GRID_WIDTH; x++) {
-				if ((currentBlock[y + 1][x] != EMPTY_CELL)
-						&& (gameGrid[y][x] != EMPTY_CELL)) {
-					return true;
-				}
-				// check if block can be moved and shift tempBlock
-				tempBlock[y][x] = currentBlock[y + 1][x];
+// Keeps the results screen up to date, only the best score can still change
+void displayResultsScreen(void) {
+	Widget_SetNumber(&resultsScreen, RESULTS_BEST, Store_LeaderboardEntry(0)->points);
+	Widget_Render(&resultsScreen);
+}
 
-			}
-		}
-		currentBlockY--;
-		break;
-
-	case MOVE_LEFT:
-		for (uint16_t y = 0; y < GRID_HEIGHT; y++) {
-			for (uint16_t x = 0; x < GRID_WIDTH - 1; x++) {
-				if ((currentBlock[y][x] != EMPTY_CELL) && (x == 0)) {
-					return false;
-				} else if ((currentBlock[y][x + 1] != EMPTY_CELL)
-						&& (gameGrid[y][x] != EMPTY_CELL)) {
-					return false;
-				}
-				// check if block can be rotated and shift tempBlock
-				tempBlock[y][x] = currentBlock[y][x + 1];
+// Work that must never run during a game, called by the main loop outside of GAME
+void ApplicationIdle(void) {
+	Store_Service();
+}
 
-			}
-		}
-		currentBlockX--;
-		break;
-
-	case MOVE_RIGHT:
-		for (uint16_t y = 0; y < GRID_HEIGHT; y++) {
-			for (uint16_t x = GRID_WIDTH - 1; x > 0; x--) {
-				if ((currentBlock[y][x] != EMPTY_CELL)
-						&& (x == GRID_WIDTH - 1)) {
-					return false;
-				} else if ((currentBlock[y][x - 1] != EMPTY_CELL)
-						&& (gameGrid[y][x] != EMPTY_CELL)) {
-					return false;
-				}
-				// check if block can be rotated and shift tempBlock
-				tempBlock[y][x] = currentBlock[y][x - 1];
+// Brings the playfield on screen up to date, only cells that changed are drawn
+// The hold slot and preview panel are on the UI layer, the whole grid is drawn
+void DrawGameGrid(void) {
+	Board_Draw(&game, 0, previewVisible);	// ghost piece only during a game
+}
 
-			}
-		}
-		currentBlockX++;
-		break;
+// DWT cycle counter, free running from here on
+static void StartCycleCounter(void) {
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
 
-	default:
-		return false;
-	}
+static uint32_t CyclesToMicros(uint32_t cycles) {
+	return cycles / (SystemCoreClock / 1000000);
+}
 
-	// Copy tempBlock back into currentBlock
-	for (uint16_t y = 0; y < GRID_HEIGHT; y++) {
-		for (uint16_t x = 0; x < GRID_WIDTH; x++) {
-			currentBlock[y][x] = tempBlock[y][x];
-		}
+#ifdef PLACEMENT_BENCH
+// Both searches for the next block on the board it will spawn on
+static void TimePlacements(void) {
+	static PlacementSet set;
+	const QueuedPiece *next = &game.nextQueue[game.nextHead];
+	uint8_t blockNum = Engine_PeekNext(&game, 0);
+
+	// the search the bot runs, from the row the engine will spawn the block on
+	uint32_t start = DWT->CYCCNT;
+	placementsFound += Placement_FromSpawn(game.gridRows, blockNum, &set);
+	placementCycles += DWT->CYCCNT - start;
+
+	if (!next->spawnBlocked) {
+		Placement spawn = { 0, SPAWN_X, next->dropBlocked ? 0 : 1 };
+		start = DWT->CYCCNT;
+		Placement_GenerateNaive(game.gridRows, blockNum, &spawn, &set);
+		placementNaiveCycles += DWT->CYCCNT - start;
 	}
-
-	return false; // move successful
+	placementBlocks++;
 }
+#endif
 
-bool RotateCurrentBlock(uint8_t direction) {
-	// temp storage for the 4x4 block
-	uint16_t temp[BLOCK_SIZE][BLOCK_SIZE] = { 0 };
+#ifdef EVAL_BENCH
+// Both kernels over a batch of the board on screen, the kernels take the same time on any board
+static void TimeEval(void) {
+	static EvalBatch batch;
+	EvalFeatures scalar;
 
-	// extract the 4x4 section
-	for (uint8_t y = 0; y < BLOCK_SIZE; y++) {
-		for (uint8_t x = 0; x < BLOCK_SIZE; x++) {
-			temp[y][x] = currentBlock[currentBlockY + y][currentBlockX + x];
-		}
+	for (uint8_t b = 0; b < EVAL_BATCH; b++) {
+		Eval_SetBoard(&batch, b, game.gridRows);
 	}
 
-	//rotate into a new temporary array
-	uint16_t rotated[BLOCK_SIZE][BLOCK_SIZE] = { 0 };
-
-	if (direction == ROTATE_RIGHT) {
-		// rotate right: new[x][3 - y] = old[y][x]
-		for (uint8_t y = 0; y < BLOCK_SIZE; y++) {
-			for (uint8_t x = 0; x < BLOCK_SIZE; x++) {
-				rotated[x][BLOCK_SIZE - 1 - y] = temp[y][x];
-			}
-		}
-	} else {
-		// rotate left: new[3 - x][y] = old[y][x]
-		for (uint8_t y = 0; y < BLOCK_SIZE; y++) {
-			for (uint8_t x = 0; x < BLOCK_SIZE; x++) {
-				rotated[BLOCK_SIZE - 1 - x][y] = temp[y][x];
-			}
+	uint32_t start = DWT->CYCCNT;
+	Eval_Scalar(&batch, &scalar);
+	evalScalarCycles += DWT->CYCCNT - start;
+#ifdef EVAL_HAS_DSP
+	EvalFeatures dsp;
+	start = DWT->CYCCNT;
+	Eval_Dsp(&batch, &dsp);
+	evalDspCycles += DWT->CYCCNT - start;
+	evalDiffer += memcmp(&scalar, &dsp, sizeof(scalar)) != 0;
+#endif
+	evalBatches++;
+}
+#endif
+
+#ifdef PC_TRAINING
+// Searches from the new block's spawn and prints the clear, a step per block
+static void ShowPerfectClear(void) {
+	static const char blockNames[] = "IOTSZJL";
+	uint32_t start = DWT->CYCCNT;
+
+	PcSolver_FromGame(&game, &pcProblem);
+	pcSolver.deadline = HAL_GetTick() + PC_BUDGET_MS;
+	bool found = PcSolver_Solve(&pcSolver, &pcProblem);
+	uint32_t micros = CyclesToMicros(DWT->CYCCNT - start);
+
+	uint32_t rate = (micros == 0) ? 0 : (uint32_t) ((uint64_t) pcSolver.nodes * 1000000 / micros);
+
+	printf("\nPC %s in %" PRIu32 " us, %" PRIu32 " nodes, %" PRIu32 " nodes/s",
+			found ? "found" : (pcSolver.timedOut ? "out of time" : "none"), micros,
+			pcSolver.nodes, rate);
+	if (found) {
+		printf("\nPC %u rows:", pcSolver.height);
+		for (uint8_t s = 0; s < pcSolver.length; s++) {
+			const PcStep *step = &pcSolver.solution[s];
+			printf(" %s%c r%u x%d y%d", step->hold ? "hold " : "", blockNames[step->blockNum - 1],
+					step->placement.rotation, step->placement.x,
+					step->placement.y - GRID_HIDDEN_ROWS);
 		}
 	}
+}
+#endif
+
+#if defined(BOT_HINTS) || defined(BOT_PLAY)
+// Where the new block goes, with BOT_TABLE one lookup unless the surface is not in it
+static void BotMove(void) {
+	Placement best;
+	bool hit = false;
+	uint32_t start = DWT->CYCCNT;
+
+#ifdef BOT_TABLE
+	bool found = Bot_Choose(&botTable, game.gridRows, game.currentBlockNum, &best, &hit);
+#else
+	bool found = Bot_Search(game.gridRows, game.currentBlockNum, &best);
+#endif
+	uint32_t cycles = DWT->CYCCNT - start;
+	botBlocks++;
+	botHits += hit;
+	botCycles += cycles;
+	if (!found) {
+		return;
+	}
 
-	// check if rotated block can fit (add later)
-
-	// if valid, copy rotated shape back into currentBlock
-	for (uint8_t y = 0; y < BLOCK_SIZE; y++) {
-		for (uint8_t x = 0; x < BLOCK_SIZE; x++) {
-			currentBlock[currentBlockY + y][currentBlockX + x] = rotated[y][x];
+#ifdef BOT_HINTS
+	printf("\nBOT r%u x%d y%d, %s in %" PRIu32 " us", best.rotation, best.x,
+			best.y - GRID_HIDDEN_ROWS, hit ? "table" : "search", CyclesToMicros(cycles));
+#endif
+#ifdef BOT_PLAY
+	// the shortest touches there from the spawn, then a soft drop held until the next block
+	uint32_t path = Finesse_Path(game.currentBlockNum, best.rotation, best.x);
+	PostInput(INPUT_DROP_RELEASE);
+	if (FINESSE_PRESSES(path) != FINESSE_UNREACHABLE) {
+		for (uint8_t i = 0; i < FINESSE_PRESSES(path); i++) {
+			PostInput(FINESSE_INPUT(path, i));
 		}
 	}
-
-	return false;
+	PostInput(INPUT_DROP_PRESS);
+#endif
 }
+#endif
 
-void PlaceCurrentBlock(void) {
-	for (uint8_t y = 0; y < GRID_HEIGHT; y++) {
-		for (uint8_t x = 0; x < GRID_WIDTH; x++) {
-			if (currentBlock[y][x] != EMPTY_CELL) {
-				gameGrid[y][x] = currentBlock[y][x]; // copy currentBlock to gameGrid
-				currentBlock[y][x] = 0;					// erase currentBlock
-			}
-		}
+#ifdef PRACTICE_REWIND
+// A snapshot for every block that spawns after one locked, the oldest is overwritten
+static void PracticeSave(void) {
+	if (Engine_PiecesPlaced(&game) == practicePieces) {
+		return;		// a hold, the same block count
 	}
-	// update score and clear lines
-	uint8_t linesCleared = ClearCompleteLines();
-
-	// update score based on lines cleared
-	switch (linesCleared) {
-	case 0:
-		score[0] += 0; // add 0 to score as a consolation prize
-		break;
-	case 1:
-		score[0]++;
-		break;
-	case 2:
-		score[1]++;
-		break;
-	case 3:
-		score[2]++;
-		break;
-	case 4:
-		score[3]++;
-		break;
-	default:
-		score[3]++;
+	if (Snapshot_Save(&game, &practiceHistory[practiceNext])) {
+		practicePieces = Engine_PiecesPlaced(&game);
+		practiceNext = (practiceNext + 1) % PRACTICE_HISTORY;
+		practiceCount += (practiceCount < PRACTICE_HISTORY);
 	}
+}
 
-	// reset flag to prevent next block from being placed
-	userButtonPressed = false;
+// Back to the oldest snapshot kept, the game clock follows the game, false to end the game
+static bool PracticeRewind(void) {
+	if ((practiceRewinds >= PRACTICE_REWINDS) || (practiceCount == 0)) {
+		return false;
+	}
 
-	CheckGameEnd();
+	uint8_t oldest = (practiceNext + PRACTICE_HISTORY - practiceCount) % PRACTICE_HISTORY;
+	Snapshot_Restore(&game, &practiceHistory[oldest]);
+	practiceNext = (oldest + 1) % PRACTICE_HISTORY;
+	practiceCount = 1;
+	practicePieces = Engine_PiecesPlaced(&game);
+	practiceRewinds++;
+
+	startTime = HAL_GetTick() - game.engineTime;
+	inputTail = inputHead;
+	Finesse_Reset(&finesse, &game);
+	Board_Invalidate();
+	printf("\nREWIND to block %" PRIu32 ", %u left", Engine_PiecesPlaced(&game),
+			PRACTICE_REWINDS - practiceRewinds);
+	return true;
+}
+#endif
+
+// Rewinds in this game, always 0 outside of practice games
+static uint8_t PracticeRewinds(void) {
+#ifdef PRACTICE_REWIND
+	return practiceRewinds;
+#else
+	return 0;
+#endif
 }
 
-uint8_t ClearCompleteLines(void) {
-	uint8_t linesCleared = 0;
+/*
+ * Queue an input, the main loop applies it to the engine. The touch and button
+ * interrupts post here and so does the bot from the main loop, interrupts are masked
+ * so a post is never cut in half by another one.
+ */
+static void PostInput(uint8_t input) {
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+
+	if ((uint8_t) (inputHead - inputTail) < INPUT_QUEUE_SIZE) { // full queues drop the input
+		inputQueue[inputHead & (INPUT_QUEUE_SIZE - 1)].input = input;
+		inputQueue[inputHead & (INPUT_QUEUE_SIZE - 1)].time = HAL_GetTick() - startTime;
+		inputHead++;
+	}
 
-	// iterate over each row from bottom to top
-	for (int16_t y = GRID_HEIGHT - 1; y >= 0; y--) {
-		bool isLineComplete = true;
+	__set_PRIMASK(primask);
+}
 
-		// check if the current row is complete (no EMPTY_CELL)
-		for (uint16_t x = 0; x < GRID_WIDTH; x++) {
-			if (gameGrid[y][x] == EMPTY_CELL) {
-				isLineComplete = false;
-				break;
-			}
+// Apply and record every queued input, replays go through the same Engine_Input call
+static void ProcessInputs(void) {
+	while (inputTail != inputHead) {
+		uint8_t input = inputQueue[inputTail & (INPUT_QUEUE_SIZE - 1)].input;
+		uint32_t time = inputQueue[inputTail & (INPUT_QUEUE_SIZE - 1)].time;
+		inputTail++;
+
+		// gravity due first, an input after game over is never recorded
+		Engine_Advance(&game, time);
+		ReportFinesse(Finesse_Update(&finesse, &game));
+		if (!Engine_IsOver(&game)) {
+			Replay_RecordInput(input, time);
+			Engine_Input(&game, input, time);
+			ReportFinesse(Finesse_Input(&finesse, &game, input));
 		}
+	}
+}
 
-		// if line is complete, clear it and shift down the above lines
-		if (isLineComplete) {
-			linesCleared++; // increment the count of cleared lines
-
-			// shift all rows above the cleared line down by one
-			for (int16_t ty = y; ty > 0; ty--) {
-				for (uint16_t x = 0; x < GRID_WIDTH; x++) {
-					gameGrid[ty][x] = gameGrid[ty - 1][x];
-				}
-			}
-
-			// clear the topmost row as it has been shifted down
-			for (uint16_t x = 0; x < GRID_WIDTH; x++) {
-				gameGrid[0][x] = EMPTY_CELL;
-			}
-
-			y++;
-		}
+// Blocks are judged as they lock, a fault is reported straight away
+static void ReportFinesse(bool fault) {
+	if (fault) {
+		printf("\nFINESSE FAULT %u touches, %u needed", finesse.lastPresses,
+				finesse.lastOptimal);
 	}
+}
 
-	return linesCleared;
+static void WriteReplayChunk(const uint8_t *data, uint32_t length) {
+	fwrite(data, 1, length, replayFile);
 }
 
-void CheckGameEnd(void) {
-	// iterate through the top four rows
-	for (int y = 0; y < 4; y++) {
-		for (int x = 0; x < GRID_WIDTH; x++) {
-			if (gameGrid[y][x] != EMPTY_CELL) {
+// Open replay_<seed>.trp on the host over semihosting, the recording is written as it grows
+static void OpenReplay(uint32_t seed) {
+	char *digit = &replayName[sizeof(REPLAY_FILE_PREFIX) - 1];
 
-				// update the game state to RESULTS to trigger game over
-				addSchedulerEvent(RESULTS);
-				removeSchedulerEvent(GAME);
-				return;
-			}
-		}
+	CloseReplay(false);
+	for (int8_t shift = 28; shift >= 0; shift -= 4) {
+		*digit++ = "0123456789abcdef"[(seed >> shift) & 0xF];
 	}
+	replayFile = fopen(replayName, "wb");
 }
 
-void arrangeBlocks(void) {
-	// Positions T block
-	GenerateBlock(T_BLOCK);
-	RotateCurrentBlock(ROTATE_LEFT);
-	MoveCurrentBlock(MOVE_RIGHT);
-	MoveCurrentBlock(MOVE_RIGHT);
-	MoveCurrentBlock(MOVE_RIGHT);
-	MoveCurrentBlock(MOVE_RIGHT);
-	MoveCurrentBlock(MOVE_DOWN);
-	MoveCurrentBlock(MOVE_DOWN);
-	MoveCurrentBlock(MOVE_DOWN);
-	MoveCurrentBlock(MOVE_DOWN);
-	MoveCurrentBlock(MOVE_DOWN);
-	MoveCurrentBlock(MOVE_DOWN);
-	MoveCurrentBlock(MOVE_DOWN);
-	PlaceCurrentBlock();
-
-	// Positions S block
-	GenerateBlock(S_BLOCK);
-	RotateCurrentBlock(ROTATE_RIGHT);
-	MoveCurrentBlock(MOVE_LEFT);
-	MoveCurrentBlock(MOVE_LEFT);
-	MoveCurrentBlock(MOVE_LEFT);
-	MoveCurrentBlock(MOVE_LEFT);
-	MoveCurrentBlock(MOVE_LEFT);
-	MoveCurrentBlock(MOVE_DOWN);
-	MoveCurrentBlock(MOVE_DOWN);
-	MoveCurrentBlock(MOVE_DOWN);
-	MoveCurrentBlock(MOVE_DOWN);
-	MoveCurrentBlock(MOVE_DOWN);
-	PlaceCurrentBlock();
-
-	// Positions L block
-	GenerateBlock(L_BLOCK);
-	RotateCurrentBlock(ROTATE_RIGHT);
-	MoveCurrentBlock(MOVE_LEFT);
-	MoveCurrentBlock(MOVE_LEFT);
-	MoveCurrentBlock(MOVE_DOWN);
-	MoveCurrentBlock(MOVE_DOWN);
-	MoveCurrentBlock(MOVE_DOWN);
-	MoveCurrentBlock(MOVE_DOWN);
-	MoveCurrentBlock(MOVE_DOWN);
-	PlaceCurrentBlock();
-
-	// Positions O block
-	GenerateBlock(O_BLOCK);
-	MoveCurrentBlock(MOVE_RIGHT);
-	MoveCurrentBlock(MOVE_DOWN);
-	MoveCurrentBlock(MOVE_DOWN);
-	MoveCurrentBlock(MOVE_DOWN);
-	MoveCurrentBlock(MOVE_DOWN);
-	PlaceCurrentBlock();
-
-	// Positions J block
-	GenerateBlock(J_BLOCK);
-	RotateCurrentBlock(ROTATE_RIGHT);
-	MoveCurrentBlock(MOVE_RIGHT);
-	MoveCurrentBlock(MOVE_RIGHT);
-	MoveCurrentBlock(MOVE_RIGHT);
-	MoveCurrentBlock(MOVE_RIGHT);
-	MoveCurrentBlock(MOVE_DOWN);
-	MoveCurrentBlock(MOVE_DOWN);
-	PlaceCurrentBlock();
-
-	// Positions Z block
-	GenerateBlock(Z_BLOCK);
-	MoveCurrentBlock(MOVE_LEFT);
-	MoveCurrentBlock(MOVE_LEFT);
-	MoveCurrentBlock(MOVE_LEFT);
-	MoveCurrentBlock(MOVE_LEFT);
-	MoveCurrentBlock(MOVE_DOWN);
-	MoveCurrentBlock(MOVE_DOWN);
-	MoveCurrentBlock(MOVE_DOWN);
-	PlaceCurrentBlock();
-
-	// Positions I block
-	GenerateBlock(I_BLOCK);
-	MoveCurrentBlock(MOVE_DOWN);
-	MoveCurrentBlock(MOVE_DOWN);
-	MoveCurrentBlock(MOVE_RIGHT);
-	PlaceCurrentBlock();
+// Write the rest of the replay, or delete the file if it is not kept or lost bytes
+static void CloseReplay(bool keep) {
+	if (replayFile == NULL) {
+		return;
+	}
+
+	Replay_Flush(WriteReplayChunk);
+	fclose(replayFile);
+	replayFile = NULL;
+	if (keep && !Replay_Overflowed()) {
+		printf("\nREPLAY SAVED %s", replayName);
+		return;
+	}
+	remove(replayName);
+	if (keep) {
+		printf("\nREPLAY TRUNCATED, NOT SAVED");
+	}
 }
 
 void HandleTouch(void) {
+	static const char *inputNames[] = { "Move LEFT", "Move RIGHT", "Rotate LEFT",
+			"Rotate RIGHT", "HOLD" };
+
 	// determine what to do about touch based on current game state
 	uint32_t gameState = getScheduledEvents();
 
-	// if in menu, start game
+	// touch y grows upwards, the widgets are in screen pixels
+	int16_t x = StaticTouchData.x;
+	int16_t y = LCD_PIXEL_HEIGHT - 1 - StaticTouchData.y;
+
+	// if in menu, have the main loop start the game
 	if (gameState & MAIN_MENU) {
-		if ((StaticTouchData.x >= 20) && (StaticTouchData.x <= 219)
-				&& (StaticTouchData.y >= 20) && (StaticTouchData.y <= 139)) {
+		if (Widget_HitTest(&menuScreen, x, y) == MENU_START) {
 			printf("GAME STARTED");
-
-			removeSchedulerEvent(MAIN_MENU);
-			addSchedulerEvent(GAME);
-			startGame();
-
+			startRequested = true;
 		}
 
-		// if in game, move block
+		// if in game, queue the move for the main loop
 	} else if (gameState & GAME) {
-		if (StaticTouchData.x <= 119) {
-			if (StaticTouchData.y > 159) {
-				printf("\nRotate LEFT");
-				RotateCurrentBlock(ROTATE_LEFT);
-				DrawGameGrid();
-			} else {
-				printf("\nMove LEFT");
-				if (MoveCurrentBlock(MOVE_LEFT)) {
-					printf("PLACE\n\n");
-					PlaceCurrentBlock();
-					GenerateBlock(RANDOM_BLOCK);
-				}
-				DrawGameGrid();
-			}
-		} else {
-			if (StaticTouchData.y > 159) {
-				printf("\nRotate RIGHT");
-				RotateCurrentBlock(ROTATE_RIGHT);
-				DrawGameGrid();
-			} else {
-				printf("\nMove RIGHT");
-				if (MoveCurrentBlock(MOVE_RIGHT)) {
-					printf("PLACE\n\n");
-					PlaceCurrentBlock();
-					GenerateBlock(RANDOM_BLOCK);
-				}
-				DrawGameGrid();
-			}
+		uint8_t input = Widget_HitTest(&gameScreen, x, y);
+		if (input != WIDGET_NO_ACTION) {
+			printf("\n%s", inputNames[input]);
+			PostInput(input);
 		}
 	}
 }
@@ -622,10 +667,12 @@ void EXTI0_IRQHandler(void) {
 	// check if the interrupt was triggered by the User Button GPIO Pin
 	if (__HAL_GPIO_EXTI_GET_IT(BUTTON_PIN) != RESET) {
 		__HAL_GPIO_EXTI_CLEAR_IT(BUTTON_PIN);
-		if (pinState == PRESSED) {
-			userButtonPressed = false; // set flag false
-		} else {
-			userButtonPressed = true;  // set flag true
+		if (getScheduledEvents() & GAME) {
+			if (pinState == PRESSED) {
+				PostInput(INPUT_DROP_RELEASE);	// button released
+			} else {
+				PostInput(INPUT_DROP_PRESS);	// button held, soft drop
+			}
 		}
 	}
 
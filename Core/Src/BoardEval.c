@@ -0,0 +1,231 @@
+/*
+ * BoardEval.c
+ *
+ *  Created on: Dec 24, 2024
+ *      Author: Will Fraser
+ */
+
+#include "BoardEval.h"
+
+#include <string.h>
+
+#if defined(__ARM_FEATURE_DSP)
+#include "stm32f4xx.h"
+#elif defined(EVAL_DSP_EMULATED)
+// Host builds of the bench stand in for the two Cortex-M4 instructions the kernel uses
+static inline uint32_t __UADD8(uint32_t a, uint32_t b) {
+	uint32_t sum = 0;
+	for (uint8_t shift = 0; shift < 32; shift += 8) {
+		sum |= (((a >> shift) + (b >> shift)) & 0xFF) << shift;
+	}
+	return sum;
+}
+
+static inline uint32_t __USADA8(uint32_t a, uint32_t b, uint32_t accumulate) {
+	for (uint8_t shift = 0; shift < 32; shift += 8) {
+		int32_t difference = (int32_t) ((a >> shift) & 0xFF) - (int32_t) ((b >> shift) & 0xFF);
+		accumulate += (difference < 0) ? -difference : difference;
+	}
+	return accumulate;
+}
+#endif
+#if defined(EVAL_HAS_SSE) || defined(EVAL_HAS_AVX2)
+#include <immintrin.h>
+#endif
+
+/*
+ * Per board and row, with covered the columns filled in this row or any above it:
+ *   height      popcount(covered)
+ *   holes       popcount(covered & ~row)
+ *   bumpiness   popcount((covered ^ covered >> 1) & LEFT_COLUMNS)
+ *   transitions popcount((walled ^ walled >> 1) & WALLED_PAIRS), walled = row << 1 | WALLS
+ * A feature never passes 8 per byte of a row and 18 rows, so the SIMD kernels add byte
+ * popcounts in byte lanes and only add the two bytes of a board together at the end.
+ */
+
+#define LEFT_COLUMNS ((1u << (GRID_WIDTH - 1)) - 1)		// columns with one to their right
+#define WALLS        (1u | 1u << (GRID_WIDTH + 1))		// the walls either side of row << 1
+#define WALLED_PAIRS ((1u << (GRID_WIDTH + 1)) - 1)		// neighbouring pairs from wall to wall
+
+void Eval_Scalar(const EvalBatch *batch, EvalFeatures *features) {
+	for (uint8_t b = 0; b < EVAL_BATCH; b++) {
+		uint16_t covered = 0;
+		uint16_t height = 0, holes = 0, bumpiness = 0, transitions = 0;
+
+		for (uint8_t y = 0; y < GRID_ROWS; y++) {
+			uint16_t row = batch->rows[y][b];
+			uint16_t walled = row << 1 | WALLS;
+
+			covered |= row;
+			height += __builtin_popcount(covered);
+			holes += __builtin_popcount(covered & ~row);
+			bumpiness += __builtin_popcount((covered ^ covered >> 1) & LEFT_COLUMNS);
+			transitions += __builtin_popcount((walled ^ walled >> 1) & WALLED_PAIRS);
+		}
+		features->height[b] = height;
+		features->holes[b] = holes;
+		features->bumpiness[b] = bumpiness;
+		features->transitions[b] = transitions;
+	}
+}
+
+#ifdef EVAL_HAS_SSE
+// Popcount of every byte, a nibble table lookup per half
+static inline __m128i Eval_Popcount8Sse(__m128i x) {
+	const __m128i nibbles = _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+	const __m128i low = _mm_set1_epi8(0x0F);
+
+	return _mm_add_epi8(_mm_shuffle_epi8(nibbles, _mm_and_si128(x, low)),
+			_mm_shuffle_epi8(nibbles, _mm_and_si128(_mm_srli_epi16(x, 4), low)));
+}
+
+// Byte lane counts to a 16 bit count per board
+static inline void Eval_StoreSse(uint16_t *out, __m128i counts) {
+	counts = _mm_add_epi16(_mm_and_si128(counts, _mm_set1_epi16(0xFF)), _mm_srli_epi16(counts, 8));
+	_mm_storeu_si128((__m128i*) out, counts);
+}
+
+void Eval_Sse(const EvalBatch *batch, EvalFeatures *features) {
+	const __m128i leftColumns = _mm_set1_epi16(LEFT_COLUMNS);
+	const __m128i walls = _mm_set1_epi16(WALLS);
+	const __m128i walledPairs = _mm_set1_epi16(WALLED_PAIRS);
+
+	for (uint8_t b = 0; b < EVAL_BATCH; b += 8) {
+		__m128i covered = _mm_setzero_si128();
+		__m128i height = covered, holes = covered, bumpiness = covered, transitions = covered;
+
+		for (uint8_t y = 0; y < GRID_ROWS; y++) {
+			__m128i row = _mm_loadu_si128((const __m128i*) &batch->rows[y][b]);
+			__m128i walled = _mm_or_si128(_mm_slli_epi16(row, 1), walls);
+
+			covered = _mm_or_si128(covered, row);
+			height = _mm_add_epi8(height, Eval_Popcount8Sse(covered));
+			holes = _mm_add_epi8(holes, Eval_Popcount8Sse(_mm_andnot_si128(row, covered)));
+			bumpiness = _mm_add_epi8(bumpiness, Eval_Popcount8Sse(_mm_and_si128(
+					_mm_xor_si128(covered, _mm_srli_epi16(covered, 1)), leftColumns)));
+			transitions = _mm_add_epi8(transitions, Eval_Popcount8Sse(_mm_and_si128(
+					_mm_xor_si128(walled, _mm_srli_epi16(walled, 1)), walledPairs)));
+		}
+		Eval_StoreSse(&features->height[b], height);
+		Eval_StoreSse(&features->holes[b], holes);
+		Eval_StoreSse(&features->bumpiness[b], bumpiness);
+		Eval_StoreSse(&features->transitions[b], transitions);
+	}
+}
+#endif
+
+#ifdef EVAL_HAS_AVX2
+static inline __m256i Eval_Popcount8Avx2(__m256i x) {
+	const __m256i nibbles = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+			0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+	const __m256i low = _mm256_set1_epi8(0x0F);
+
+	return _mm256_add_epi8(_mm256_shuffle_epi8(nibbles, _mm256_and_si256(x, low)),
+			_mm256_shuffle_epi8(nibbles, _mm256_and_si256(_mm256_srli_epi16(x, 4), low)));
+}
+
+static inline void Eval_StoreAvx2(uint16_t *out, __m256i counts) {
+	counts = _mm256_add_epi16(_mm256_and_si256(counts, _mm256_set1_epi16(0xFF)),
+			_mm256_srli_epi16(counts, 8));
+	_mm256_storeu_si256((__m256i*) out, counts);
+}
+
+void Eval_Avx2(const EvalBatch *batch, EvalFeatures *features) {
+	const __m256i leftColumns = _mm256_set1_epi16(LEFT_COLUMNS);
+	const __m256i walls = _mm256_set1_epi16(WALLS);
+	const __m256i walledPairs = _mm256_set1_epi16(WALLED_PAIRS);
+
+	for (uint8_t b = 0; b < EVAL_BATCH; b += 16) {
+		__m256i covered = _mm256_setzero_si256();
+		__m256i height = covered, holes = covered, bumpiness = covered, transitions = covered;
+
+		for (uint8_t y = 0; y < GRID_ROWS; y++) {
+			__m256i row = _mm256_loadu_si256((const __m256i*) &batch->rows[y][b]);
+			__m256i walled = _mm256_or_si256(_mm256_slli_epi16(row, 1), walls);
+
+			covered = _mm256_or_si256(covered, row);
+			height = _mm256_add_epi8(height, Eval_Popcount8Avx2(covered));
+			holes = _mm256_add_epi8(holes, Eval_Popcount8Avx2(_mm256_andnot_si256(row, covered)));
+			bumpiness = _mm256_add_epi8(bumpiness, Eval_Popcount8Avx2(_mm256_and_si256(
+					_mm256_xor_si256(covered, _mm256_srli_epi16(covered, 1)), leftColumns)));
+			transitions = _mm256_add_epi8(transitions, Eval_Popcount8Avx2(_mm256_and_si256(
+					_mm256_xor_si256(walled, _mm256_srli_epi16(walled, 1)), walledPairs)));
+		}
+		Eval_StoreAvx2(&features->height[b], height);
+		Eval_StoreAvx2(&features->holes[b], holes);
+		Eval_StoreAvx2(&features->bumpiness[b], bumpiness);
+		Eval_StoreAvx2(&features->transitions[b], transitions);
+	}
+}
+#endif
+
+#ifdef EVAL_HAS_DSP
+#define PAIR(mask) ((uint32_t) (mask) * 0x00010001u)	// the same 16 bit mask for both boards
+
+// Popcount of every byte, the shifts only ever carry bits that the masks drop
+static inline uint32_t Eval_Popcount8Dsp(uint32_t x) {
+	x -= (x >> 1) & 0x55555555u;
+	x = (x & 0x33333333u) + ((x >> 2) & 0x33333333u);
+	return (x + (x >> 4)) & 0x0F0F0F0Fu;
+}
+
+// The two bytes of each board summed, a sum of absolute differences against zero
+static inline void Eval_StoreDsp(uint16_t *out, uint32_t counts) {
+	out[0] = __USADA8(counts & 0xFFFF, 0, 0);
+	out[1] = __USADA8(counts >> 16, 0, 0);
+}
+
+void Eval_Dsp(const EvalBatch *batch, EvalFeatures *features) {
+	for (uint8_t b = 0; b < EVAL_BATCH; b += 2) {
+		uint32_t covered = 0;
+		uint32_t height = 0, holes = 0, bumpiness = 0, transitions = 0;
+
+		for (uint8_t y = 0; y < GRID_ROWS; y++) {
+			uint32_t row;
+			memcpy(&row, &batch->rows[y][b], sizeof(row));		// boards b and b + 1, one load
+			uint32_t walled = row << 1 | PAIR(WALLS);
+
+			covered |= row;
+			height = __UADD8(height, Eval_Popcount8Dsp(covered));
+			holes = __UADD8(holes, Eval_Popcount8Dsp(covered & ~row));
+			bumpiness = __UADD8(bumpiness,
+					Eval_Popcount8Dsp((covered ^ covered >> 1) & PAIR(LEFT_COLUMNS)));
+			transitions = __UADD8(transitions,
+					Eval_Popcount8Dsp((walled ^ walled >> 1) & PAIR(WALLED_PAIRS)));
+		}
+		Eval_StoreDsp(&features->height[b], height);
+		Eval_StoreDsp(&features->holes[b], holes);
+		Eval_StoreDsp(&features->bumpiness[b], bumpiness);
+		Eval_StoreDsp(&features->transitions[b], transitions);
+	}
+}
+#endif
+
+void Eval_Batch(const EvalBatch *batch, EvalFeatures *features) {
+#if defined(EVAL_HAS_AVX2)
+	Eval_Avx2(batch, features);
+#elif defined(EVAL_HAS_SSE)
+	Eval_Sse(batch, features);
+#elif defined(__ARM_FEATURE_DSP)
+	Eval_Dsp(batch, features);
+#else
+	Eval_Scalar(batch, features);
+#endif
+}
+
+// Copy a board's rows into its lane of the batch
+void Eval_SetBoard(EvalBatch *batch, uint8_t board, const uint16_t *gridRows) {
+	for (uint8_t y = 0; y < GRID_ROWS; y++) {
+		batch->rows[y][board] = gridRows[y];
+	}
+}
+
+// Weighted sum of the features of the first count boards, higher is better
+void Eval_Scores(const EvalFeatures *features, const EvalWeights *weights, uint8_t count,
+		int32_t *scores) {
+	for (uint8_t b = 0; b < count; b++) {
+		scores[b] = weights->height * features->height[b] + weights->holes * features->holes[b]
+				+ weights->bumpiness * features->bumpiness[b]
+				+ weights->transitions * features->transitions[b];
+	}
+}
@@ -0,0 +1,165 @@
+/*
+ * BoardView.c
+ *
+ *  Created on: Dec 13, 2024
+ *      Author: Will Fraser
+ */
+
+#include "BoardView.h"
+
+#include <string.h>
+
+/*
+ * Draws the playfield from the engine, keeping a copy of what every cell on screen
+ * shows so only cells that changed are drawn again. When lines are cleared the
+ * pixel rows above them are moved down in the framebuffer together with the copy,
+ * which leaves just the exposed top rows and the pieces to draw. Every write is
+ * announced to ScanSync as a band of pixel rows.
+ */
+
+#define SHOWN_UNKNOWN  0xFF		// cell on screen does not match any tile, always drawn
+#define SHOWN_GHOST    0x80		// added to the block number for ghost tiles
+
+#define BAND_PIXELS    (ATLAS_TILE_SIZE * LCD_PIXEL_WIDTH)	// one row of cells
+#define TILE_BYTES     (ATLAS_TILE_SIZE * ATLAS_TILE_SIZE * sizeof(uint16_t))
+
+static uint8_t shownCells[GRID_HEIGHT][GRID_WIDTH];
+static bool allUnknown;			// invalidated since the last draw, clears have nothing to move
+
+static bool Board_RowEmpty(uint8_t y) {
+	for (uint8_t x = 0; x < GRID_WIDTH; x++) {
+		if (shownCells[y][x] != EMPTY_CELL) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// Forget what is on screen, the next Board_Draw paints every cell
+void Board_Invalidate(void) {
+	memset(shownCells, SHOWN_UNKNOWN, sizeof(shownCells));
+	allUnknown = true;
+}
+
+/*
+ * Remove the cleared rows from the screen the way ClearCompleteLines removes them from
+ * the grid. Going up from the bottom every kept row has a fixed distance to move, rows
+ * next to each other with the same distance are moved as one band with one memmove.
+ * Empty rows landing on empty rows look the same after the move, so the band stops
+ * at the top of the stack instead of dragging the empty rows above it along.
+ */
+static void Board_ShiftRows(uint16_t cleared) {
+	int8_t destination = GRID_HEIGHT - 1;
+	int8_t source = GRID_HEIGHT - 1;
+
+	while (source >= 0) {
+		// skip the cleared rows, the distance grows by one for each
+		if (cleared & (1 << source)) {
+			source--;
+			continue;
+		}
+
+		// extend the band up while rows are kept
+		int8_t top = source;
+		while ((top > 0) && !(cleared & (1 << (top - 1)))) {
+			top--;
+		}
+		uint8_t rows = source - top + 1;
+		uint8_t distance = destination - source;
+		destination -= rows;
+
+		if (distance != 0) {
+			int8_t first = top;
+			while ((first <= source) && Board_RowEmpty(first)
+					&& Board_RowEmpty(first + distance)) {
+				first++;
+			}
+			if (first <= source) {
+				// up to 15 cell rows, more than fit between two passes of the beam
+				uint16_t bandTop = (first + distance) * ATLAS_TILE_SIZE;
+				uint16_t bottom = (source + distance + 1) * ATLAS_TILE_SIZE;
+				uint32_t shift = distance * BAND_PIXELS;
+				while (bottom > bandTop) {
+					uint16_t part = Scan_BandPart(bandTop, bottom,
+							(bottom - bandTop) * LCD_PIXEL_WIDTH * sizeof(uint16_t));
+					memmove(&frameBuffer[part * LCD_PIXEL_WIDTH],
+							&frameBuffer[part * LCD_PIXEL_WIDTH - shift],
+							(bottom - part) * LCD_PIXEL_WIDTH * sizeof(uint16_t));
+					bottom = part;
+				}
+				memmove(&shownCells[first + distance], &shownCells[first],
+						(source - first + 1) * sizeof(shownCells[0]));
+			}
+		}
+		source = top - 1;
+	}
+
+	// rows left at the top still show what was there before, draw them again
+	memset(shownCells, SHOWN_UNKNOWN, (destination + 1) * sizeof(shownCells[0]));
+}
+
+/*
+ * Bring the screen up to date with the engine. Cells of row 0 set in reservedTop
+ * belong to another panel and are left alone, ghost draws where the falling block
+ * would land.
+ */
+void Board_Draw(GameState *game, uint16_t reservedTop, bool ghost) {
+	uint16_t cleared = Engine_TakeClearedRows(game);
+	uint8_t drop = ghost ? Engine_GhostDrop(game) : 0;
+
+	Scan_Begin();
+	if (cleared == ENGINE_CLEARS_UNKNOWN) {
+		Board_Invalidate();
+	} else if ((cleared != 0) && !allUnknown) {
+		Board_ShiftRows(cleared);
+	}
+
+	// rows from the one under the beam down, then from the top
+	uint8_t start = Scan_StartBand(ATLAS_TILE_SIZE, GRID_HEIGHT);
+	for (uint8_t i = 0; i < GRID_HEIGHT; i++) {
+		uint8_t y = (start + i) % GRID_HEIGHT;
+		uint8_t cells[GRID_WIDTH];
+		uint8_t changed = 0;
+
+		// what the row should show, the band is announced once for all its cells
+		for (uint8_t x = 0; x < GRID_WIDTH; x++) {
+			if ((y == 0) && (reservedTop & (1 << x))) {
+				shownCells[y][x] = SHOWN_UNKNOWN;
+				cells[x] = SHOWN_UNKNOWN;
+				continue;
+			}
+
+			uint8_t cell = Engine_CellAt(game, x, y);
+			if ((cell == EMPTY_CELL) && (drop != 0)) {
+				uint8_t shadow = Engine_GhostAt(game, x, y, drop);
+				if (shadow != EMPTY_CELL) {
+					cell = SHOWN_GHOST | shadow;
+				}
+			}
+			cells[x] = cell;
+			if (cell != shownCells[y][x]) {
+				changed++;
+			}
+		}
+		if (changed == 0) {
+			continue;
+		}
+
+		Scan_Band(y * ATLAS_TILE_SIZE, (y + 1) * ATLAS_TILE_SIZE, changed * TILE_BYTES);
+		for (uint8_t x = 0; x < GRID_WIDTH; x++) {
+			uint8_t cell = cells[x];
+			if (cell == shownCells[y][x]) {
+				continue;
+			}
+
+			if (cell & SHOWN_GHOST) {
+				Atlas_DrawGhost(x * ATLAS_TILE_SIZE, y * ATLAS_TILE_SIZE, cell);
+			} else {
+				Atlas_DrawCell(x * ATLAS_TILE_SIZE, y * ATLAS_TILE_SIZE, cell);
+			}
+			shownCells[y][x] = cell;
+		}
+	}
+	allUnknown = false;
+	Scan_End();
+}
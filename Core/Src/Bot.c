@@ -0,0 +1,190 @@
+/*
+ * Bot.c
+ *
+ *  Created on: Dec 23, 2024
+ *      Author: Will Fraser
+ */
+
+#include "Bot.h"
+
+#include <string.h>
+
+#define FULL_ROW ((1u << GRID_WIDTH) - 1)
+
+// Board score weights, per cell of height, hole, step between columns and line cleared
+#define WEIGHT_HEIGHT -51
+#define WEIGHT_HOLE   -36
+#define WEIGHT_BUMP   -18
+#define WEIGHT_LINE    76
+
+static const EvalWeights weights = { WEIGHT_HEIGHT, WEIGHT_HOLE, WEIGHT_BUMP, 0 };	// no row transitions
+
+// Boards after each drop, scored a batch at a time
+typedef struct {
+	EvalBatch batch;
+	Placement placements[EVAL_BATCH];
+	uint8_t cleared[EVAL_BATCH];
+	uint8_t count;
+	int32_t bestScore;
+} BotCandidates;
+
+static void Bot_ScoreCandidates(BotCandidates *candidates, Placement *best);
+static void Bot_Heights(const uint16_t *gridRows, uint8_t heights[GRID_WIDTH]);
+
+// 32 bit mix of a key, a different seed gives an unrelated hash
+uint32_t Bot_Hash(uint32_t key, uint32_t seed) {
+	uint32_t hash = key * 0x9E3779B1u ^ (seed + 1) * 0x85EBCA77u;
+
+	hash ^= hash >> 15;
+	hash *= 0x2C1B3C6Du;
+	hash ^= hash >> 12;
+	hash *= 0x297A2D39u;
+	hash ^= hash >> 15;
+	return hash;
+}
+
+// The steps between neighbouring column tops, bucketed, and the block
+uint32_t Bot_SurfaceKey(const uint16_t *gridRows, uint8_t blockNum) {
+	uint8_t heights[GRID_WIDTH];
+	uint32_t key = 0;
+
+	Bot_Heights(gridRows, heights);
+	for (uint8_t x = 0; x < GRID_WIDTH - 1; x++) {
+		int8_t step = heights[x + 1] - heights[x];
+		step = (step > BOT_STEP_LIMIT) ? BOT_STEP_LIMIT : step;
+		step = (step < -BOT_STEP_LIMIT) ? -BOT_STEP_LIMIT : step;
+		key = key * BOT_STEP_VALUES + step + BOT_STEP_LIMIT;
+	}
+	return key * 7 + blockNum - 1;
+}
+
+// Where a block dropped straight down at a rotation and box column lands, false if it cannot
+bool Bot_Drop(const uint16_t *gridRows, uint8_t blockNum, uint8_t rotation, int8_t x,
+		Placement *placement) {
+	PlacementSet set;
+
+	if ((x < -PLACEMENT_X_BIAS) || (x >= GRID_WIDTH)) {
+		return false;
+	}
+	Placement_FromSpawn(gridRows, blockNum, &set);
+	for (uint8_t y = 0; y < GRID_ROWS; y++) {
+		if (set.land[rotation][y] & (1 << (x + PLACEMENT_X_BIAS))) {
+			placement->rotation = rotation;
+			placement->x = x;
+			placement->y = y;
+			return true;
+		}
+	}
+	return false;
+}
+
+// Every rotation and column a block drops straight down at, scored, false if there is none
+bool Bot_Search(const uint16_t *gridRows, uint8_t blockNum, Placement *best) {
+	PlacementSet set;
+	BotCandidates candidates;
+
+	candidates.count = 0;
+	candidates.bestScore = INT32_MIN;
+	Placement_FromSpawn(gridRows, blockNum, &set);
+	for (uint8_t r = 0; r < PLACEMENT_ROTATIONS; r++) {
+		uint16_t dropped = 0;
+
+		// the highest landing in a column is where a straight drop stops
+		for (uint8_t y = 0; y < GRID_ROWS; y++) {
+			uint16_t land = set.land[r][y] & ~dropped;
+			dropped |= land;
+			while (land != 0) {
+				Placement *placement = &candidates.placements[candidates.count];
+				uint16_t rows[GRID_ROWS];
+
+				placement->rotation = r;
+				placement->x = __builtin_ctz(land) - PLACEMENT_X_BIAS;
+				placement->y = y;
+				land &= land - 1;
+
+				memcpy(rows, gridRows, sizeof(rows));
+				candidates.cleared[candidates.count] = Bot_Lock(rows, blockNum, placement);
+				Eval_SetBoard(&candidates.batch, candidates.count, rows);
+				if (++candidates.count == EVAL_BATCH) {
+					Bot_ScoreCandidates(&candidates, best);
+				}
+			}
+		}
+	}
+	Bot_ScoreCandidates(&candidates, best);
+	return candidates.bestScore != INT32_MIN;
+}
+
+// The table's drop for this surface and block, false on a miss
+bool Bot_Lookup(const BotTable *table, const uint16_t *gridRows, uint8_t blockNum,
+		Placement *best) {
+	uint32_t key = Bot_SurfaceKey(gridRows, blockNum);
+	uint16_t displace = table->displace[Bot_Hash(key, BOT_SEED_BUCKET) % table->buckets];
+	uint16_t entry = table->entries[Bot_Hash(key, BOT_SEED_SLOT + displace) % table->slots];
+
+	if (BOT_ENTRY_FINGERPRINT(entry) != (Bot_Hash(key, BOT_SEED_FINGERPRINT) >> 24)) {
+		return false;
+	}
+	return Bot_Drop(gridRows, blockNum, BOT_ENTRY_ROTATION(entry), BOT_ENTRY_X(entry), best);
+}
+
+// The table first and the search when it has nothing that fits
+bool Bot_Choose(const BotTable *table, const uint16_t *gridRows, uint8_t blockNum,
+		Placement *best, bool *hit) {
+	*hit = Bot_Lookup(table, gridRows, blockNum, best);
+	return *hit || Bot_Search(gridRows, blockNum, best);
+}
+
+// Lock a block into the rows and drop the rows above any it completes, returns rows cleared
+uint8_t Bot_Lock(uint16_t *gridRows, uint8_t blockNum, const Placement *placement) {
+	uint16_t cells[BLOCK_SIZE];
+	uint8_t cleared = 0;
+
+	Placement_Rows(blockNum, placement, cells);
+	for (uint8_t i = 0; (i < BLOCK_SIZE) && (placement->y + i < GRID_ROWS); i++) {
+		gridRows[placement->y + i] |= cells[i];
+	}
+	for (uint8_t y = 0; y < GRID_ROWS; y++) {
+		if (gridRows[y] == FULL_ROW) {
+			memmove(&gridRows[1], &gridRows[0], y * sizeof(gridRows[0]));
+			gridRows[0] = 0;
+			cleared++;
+		}
+	}
+	return cleared;
+}
+
+// The batch so far, in the order the drops were found so ties go to the first as before
+static void Bot_ScoreCandidates(BotCandidates *candidates, Placement *best) {
+	EvalFeatures features;
+	int32_t scores[EVAL_BATCH];
+
+	if (candidates->count == 0) {
+		return;
+	}
+	Eval_Batch(&candidates->batch, &features);
+	Eval_Scores(&features, &weights, candidates->count, scores);
+	for (uint8_t c = 0; c < candidates->count; c++) {
+		int32_t score = scores[c] + WEIGHT_LINE * candidates->cleared[c];
+		if (score > candidates->bestScore) {
+			candidates->bestScore = score;
+			*best = candidates->placements[c];
+		}
+	}
+	candidates->count = 0;
+}
+
+// Column tops, from the top row down
+static void Bot_Heights(const uint16_t *gridRows, uint8_t heights[GRID_WIDTH]) {
+	uint16_t covered = 0;
+
+	memset(heights, 0, GRID_WIDTH);
+	for (uint8_t y = 0; y < GRID_ROWS; y++) {
+		uint16_t tops = gridRows[y] & ~covered;
+		while (tops != 0) {
+			heights[__builtin_ctz(tops)] = GRID_ROWS - y;
+			tops &= tops - 1;
+		}
+		covered |= gridRows[y];
+	}
+}
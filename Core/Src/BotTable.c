@@ -0,0 +1,541 @@
+/*
+ * BotTable.c
+ *
+ * Generated by Tools/BotTableGen, do not edit.
+ */
+
+#include "Bot.h"
+
+#ifdef BOT_TABLE
+
+static const uint16_t botDisplace[1024] = {
+		0, 11, 59, 6, 33, 23, 6, 4, 11, 32, 6, 45,
+		127, 27, 0, 106, 5, 3, 20, 11, 42, 4, 22, 5,
+		25, 18, 1, 169, 8, 0, 9, 0, 156, 1, 1, 2,
+		12, 2, 6, 15, 15, 44, 3, 30, 28, 0, 60, 11,
+		7, 191, 8, 0, 0, 6, 21, 0, 5, 10, 15, 12,
+		27, 16, 25, 3, 11, 32, 145, 10, 2, 9, 2, 3,
+		7, 0, 1, 43, 9, 57, 7, 4, 3, 5, 11, 0,
+		22, 2, 12, 2, 88, 41, 2, 16, 12, 1, 90, 1,
+		1, 0, 35, 20, 129, 16, 34, 4, 72, 0, 1, 3,
+		57, 5, 1, 56, 58, 33, 22, 0, 49, 62, 48, 1,
+		104, 70, 5, 6, 2, 54, 2, 11, 1, 72, 0, 14,
+		1, 32, 7, 47, 13, 16, 0, 0, 0, 56, 44, 36,
+		283, 56, 16, 290, 0, 19, 26, 0, 1, 50, 141, 17,
+		246, 0, 0, 0, 7, 10, 19, 10, 1, 2, 19, 4,
+		7, 5, 0, 32, 74, 1, 2, 3, 4, 48, 40, 7,
+		4, 0, 20, 1, 1, 6, 9, 1, 5, 57, 1, 10,
+		1, 7, 2, 68, 35, 8, 2, 18, 1, 46, 11, 7,
+		9, 1, 17, 41, 0, 60, 12, 6, 3, 52, 23, 0,
+		18, 124, 4, 6, 3, 114, 1, 14, 38, 3, 3, 56,
+		72, 66, 3, 11, 59, 3, 41, 0, 70, 3, 2, 36,
+		11, 8, 11, 21, 24, 70, 3, 1, 5, 20, 97, 8,
+		58, 90, 1, 12, 6, 49, 95, 5, 19, 2, 213, 26,
+		21, 15, 9, 2, 14, 2, 25, 16, 22, 12, 0, 8,
+		0, 1, 1, 3, 8, 12, 57, 9, 4, 84, 28, 8,
+		3, 22, 22, 0, 75, 0, 10, 7, 1, 24, 10, 56,
+		7, 79, 3, 8, 0, 139, 33, 34, 1, 37, 5, 39,
+		29, 11, 30, 9, 56, 48, 89, 3, 19, 0, 0, 70,
+		42, 54, 3, 4, 3, 47, 0, 8, 4, 50, 0, 22,
+		2, 0, 74, 0, 15, 5, 43, 7, 24, 1, 4, 9,
+		0, 67, 13, 5, 5, 27, 16, 0, 1, 149, 143, 0,
+		36, 1, 96, 76, 12, 2, 2, 1, 48, 9, 4, 0,
+		2, 18, 0, 47, 86, 15, 9, 24, 4, 43, 46, 7,
+		89, 0, 16, 4, 3, 2, 43, 17, 2, 59, 11, 31,
+		113, 7, 39, 265, 506, 75, 35, 3, 7, 2, 18, 0,
+		2, 179, 51, 14, 2, 10, 7, 17, 217, 7, 0, 5,
+		2, 63, 47, 128, 126, 25, 4, 171, 27, 0, 4, 14,
+		10, 82, 0, 37, 90, 48, 7, 29, 72, 15, 19, 76,
+		8, 26, 4, 3, 9, 26, 0, 14, 360, 30, 54, 72,
+		77, 12, 3, 5, 1, 8, 111, 9, 4, 65, 59, 8,
+		53, 72, 14, 399, 14, 44, 0, 3, 37, 26, 85, 16,
+		62, 50, 186, 260, 3, 1, 32, 0, 31, 42, 53, 101,
+		0, 2, 26, 2, 5, 7, 230, 102, 4, 92, 17, 0,
+		0, 81, 51, 8, 55, 14, 0, 103, 10, 21, 74, 52,
+		20, 12, 425, 70, 21, 41, 1, 9, 28, 29, 17, 22,
+		3, 72, 20, 6, 89, 0, 2, 18, 3, 138, 1, 58,
+		13, 95, 20, 20, 12, 61, 7, 37, 51, 3, 0, 27,
+		0, 164, 2, 3, 14, 17, 8, 141, 116, 49, 78, 33,
+		0, 37, 130, 4, 13, 22, 0, 7, 134, 9, 38, 102,
+		127, 118, 15, 89, 14, 29, 0, 2, 53, 27, 0, 5,
+		10, 41, 2, 74, 0, 209, 14, 3, 61, 67, 387, 55,
+		101, 0, 76, 1, 5, 22, 65, 237, 21, 0, 15, 121,
+		1, 5, 37, 15, 36, 5, 7, 177, 29, 30, 17, 17,
+		50, 0, 19, 41, 15, 57, 23, 26, 14, 23, 3, 391,
+		47, 114, 32, 1, 1, 0, 270, 34, 2, 0, 67, 19,
+		9, 49, 8, 40, 4, 2, 2, 0, 4, 99, 71, 60,
+		8, 50, 87, 60, 78, 48, 1, 37, 70, 178, 6, 117,
+		6, 71, 11, 55, 9, 131, 127, 26, 2, 11, 210, 0,
+		91, 313, 32, 13, 1, 8, 3, 0, 7, 331, 26, 9,
+		301, 18, 34, 175, 28, 74, 37, 10, 0, 78, 146, 99,
+		20, 4, 110, 3, 10, 0, 10, 7, 1, 196, 9, 7,
+		7, 1, 10, 0, 25, 124, 0, 11, 454, 63, 22, 17,
+		31, 21, 5, 156, 25, 1, 24, 9, 36, 39, 3, 1,
+		110, 157, 254, 18, 20, 76, 0, 197, 53, 7, 0, 292,
+		3, 24, 131, 32, 3, 19, 13, 8, 15, 63, 1, 20,
+		1, 1, 21, 1, 28, 8, 5, 54, 69, 5, 35, 118,
+		77, 7, 146, 18, 6, 10, 178, 21, 112, 27, 7, 0,
+		0, 69, 32, 120, 6, 33, 125, 0, 166, 124, 44, 2,
+		74, 18, 71, 153, 29, 0, 58, 455, 51, 10, 6, 112,
+		3, 5, 6, 171, 352, 4, 0, 63, 214, 1, 51, 62,
+		154, 86, 16, 47, 16, 246, 250, 31, 46, 2, 6, 124,
+		31, 1, 0, 16, 67, 55, 0, 282, 7, 174, 42, 44,
+		0, 26, 0, 32, 85, 25, 266, 0, 19, 22, 9, 14,
+		1, 28, 699, 164, 0, 0, 1, 493, 72, 280, 215, 67,
+		190, 340, 214, 118, 71, 440, 0, 1, 2, 58, 36, 2,
+		221, 201, 359, 0, 54, 290, 410, 2, 30, 23, 102, 1,
+		20, 106, 133, 42, 11, 37, 8, 43, 0, 3, 105, 234,
+		0, 6, 2, 5, 415, 134, 209, 41, 0, 6, 287, 55,
+		17, 444, 89, 34, 33, 0, 188, 12, 230, 2, 3, 178,
+		159, 1, 57, 0, 331, 302, 50, 145, 4, 5, 56, 1174,
+		1, 311, 414, 59, 39, 1048, 3, 0, 120, 5, 174, 16,
+		1, 172, 23, 88, 681, 3, 0, 27, 119, 398, 107, 574,
+		0, 386, 25, 377, 337, 38, 14, 16, 1, 134, 4, 294,
+		58, 206, 37, 325, 2, 0, 0, 1, 76, 7, 197, 3,
+		168, 113, 188, 135, 36, 714, 22, 49, 136, 33, 0, 41,
+		142, 17, 125, 206, 1, 16, 5, 563, 78, 104, 109, 7,
+		5, 212, 27, 220,
+};
+
+static const uint16_t botEntries[4353] = {
+		0xFFFF, 0x060B, 0x1311, 0xD224, 0x4C14, 0xFFFF, 0x4E1C, 0xFFFF, 0x3823, 0x7904,
+		0x5738, 0x7924, 0x022A, 0xEA09, 0x8812, 0x0007, 0x9013, 0x0503, 0xAB33, 0xA201,
+		0xFFFF, 0x700B, 0x121C, 0xDC02, 0xFE2C, 0xB708, 0x3E05, 0x921C, 0xB412, 0xC823,
+		0xFFFF, 0x1128, 0x7904, 0x320B, 0x6C1C, 0x0433, 0xE902, 0x6703, 0x6404, 0x4928,
+		0x6711, 0x7D0A, 0x7301, 0x151C, 0xA203, 0x2D0C, 0xE00C, 0x191B, 0x6B0B, 0xC23D,
+		0x3532, 0x0E0A, 0x9923, 0xEC29, 0xDB35, 0x5934, 0x070A, 0xFD05, 0xAA19, 0x2D19,
+		0xFFFF, 0x2A04, 0xCF09, 0xD60A, 0xCE07, 0x4209, 0x3B2D, 0xC10A, 0xFFFF, 0xC807,
+		0xDC14, 0x2D09, 0x4B14, 0x1105, 0xD619, 0x6C18, 0x3A17, 0xDD04, 0x8E04, 0x2E03,
+		0x4508, 0x2208, 0xFFFF, 0xA306, 0xC819, 0x3B03, 0x3403, 0xDA33, 0xFFFF, 0x5802,
+		0x4F08, 0xC205, 0x6037, 0x2C33, 0xFFFF, 0x4C19, 0xC511, 0x8502, 0xD006, 0x162A,
+		0x001C, 0xF00C, 0xF31B, 0x8C29, 0xFFFF, 0x8C09, 0xFC18, 0x4108, 0x0611, 0x1827,
+		0x7835, 0x3603, 0x6324, 0x7E0B, 0x2512, 0x4E18, 0xA113, 0x3F0A, 0xDE39, 0x123D,
+		0xFFFF, 0x893B, 0xEB03, 0xE906, 0x3301, 0xC902, 0x2908, 0xCF34, 0xD102, 0x1D04,
+		0x1A04, 0xD005, 0x8205, 0xB909, 0xF30A, 0x6B33, 0x1F06, 0xEC0B, 0x7216, 0x2215,
+		0xA308, 0xD216, 0xFF06, 0x9B06, 0x7F03, 0xB604, 0x5006, 0xFC0B, 0xCC3A, 0x1A15,
+		0x3327, 0xCD12, 0x5008, 0xE228, 0xED09, 0x940A, 0x4004, 0x7207, 0xC826, 0x6108,
+		0xE416, 0x401B, 0xFFFF, 0x7C0A, 0x6602, 0xA304, 0x4202, 0xAD04, 0xAA08, 0x9533,
+		0xBD36, 0x362A, 0x7908, 0xA909, 0xA108, 0x0E2C, 0x7B0C, 0xB407, 0x101B, 0x0702,
+		0xFFFF, 0x1A0B, 0xC409, 0xFF17, 0x100B, 0x2B28, 0x0302, 0x9703, 0xFFFF, 0x3611,
+		0x8719, 0x5316, 0xF505, 0x2411, 0x1F36, 0x5C03, 0xCD0B, 0x9E0B, 0x4F03, 0xE404,
+		0xC616, 0x3916, 0xC813, 0xCD1B, 0xB111, 0x4D1A, 0x1A1B, 0x5D02, 0x4608, 0x6D05,
+		0x6009, 0x3413, 0x0C03, 0xBF12, 0xA33A, 0x720B, 0x1202, 0x0606, 0xA315, 0xD534,
+		0x371A, 0xBA03, 0x0607, 0x7D37, 0xCA18, 0xFFFF, 0x3B02, 0xCD1B, 0x532D, 0xF504,
+		0xB10A, 0xFFFF, 0x0203, 0xA218, 0x1604, 0x4A03, 0xAB03, 0xA525, 0x8507, 0xAE03,
+		0xBA0A, 0xFFFF, 0x020B, 0x2703, 0xFFFF, 0xF307, 0xFF1A, 0xA802, 0xAA03, 0xFFFF,
+		0x1808, 0x7319, 0xDF2A, 0xAB03, 0x2111, 0xBD2D, 0x5C39, 0x6D06, 0x9617, 0x3008,
+		0xC203, 0x3F11, 0x540A, 0xE50A, 0xEC18, 0x0511, 0x1206, 0x6D02, 0xD50C, 0x7437,
+		0xB40C, 0x3C04, 0x453C, 0x5409, 0x1A03, 0x480C, 0xCA16, 0x741B, 0x571B, 0x5512,
+		0x4302, 0xDB04, 0x5E11, 0x7E08, 0x670B, 0xED17, 0xE203, 0xBE12, 0x6402, 0x4005,
+		0x3E2C, 0x9904, 0xAB29, 0x0D2C, 0x5234, 0xF903, 0x8D2C, 0xFFFF, 0xC53A, 0x7304,
+		0x0604, 0xBE08, 0x1A2D, 0x9F3A, 0xEC03, 0x750B, 0xFD06, 0x3F07, 0xFFFF, 0x901B,
+		0xE73B, 0x0109, 0x3D03, 0x9336, 0x0615, 0xDC27, 0x6318, 0x1B0A, 0x5409, 0x7C2D,
+		0x140B, 0xB919, 0xD706, 0x7C08, 0xD024, 0x9714, 0x7417, 0xE629, 0x9937, 0xDE16,
+		0x3703, 0x6611, 0x8823, 0x6A0C, 0x1502, 0x1A09, 0x020C, 0x2104, 0x272A, 0x3A04,
+		0x901B, 0xFFFF, 0xEA0C, 0xEB0B, 0x7204, 0xF432, 0xAE1C, 0xE706, 0x9D0C, 0x5D03,
+		0xE407, 0xA70B, 0x8704, 0xE804, 0xC707, 0xB602, 0x1125, 0xFFFF, 0xFF08, 0xFFFF,
+		0x1203, 0x0823, 0xFFFF, 0xFFFF, 0xB803, 0xDB0A, 0x5507, 0x6706, 0x0813, 0x9704,
+		0x6811, 0xFB12, 0x8B14, 0xFFFF, 0x3603, 0x3E08, 0x0724, 0x770B, 0x3A08, 0x3F17,
+		0xE004, 0x2302, 0x0707, 0x5C2C, 0x1014, 0x0207, 0x6B07, 0x103A, 0x013B, 0x660C,
+		0xC217, 0x8702, 0x0512, 0x9903, 0xC111, 0x3004, 0x2D23, 0xB406, 0x0103, 0xB728,
+		0x0308, 0x1F03, 0x2212, 0xAE1C, 0xA60A, 0x4D08, 0x7D0A, 0x6603, 0xD601, 0xC816,
+		0xF205, 0x341B, 0x7711, 0xFB07, 0x1002, 0x4F06, 0x6E0A, 0xD403, 0x9108, 0x7508,
+		0x5B02, 0x220B, 0x0D01, 0x1106, 0x952B, 0x8519, 0xE019, 0xD91B, 0x2804, 0x351B,
+		0x9D02, 0x7F0B, 0xC308, 0x5F1B, 0xC208, 0x7E3B, 0xEC17, 0x9806, 0xE20B, 0x9C07,
+		0x6E05, 0x8F27, 0xF703, 0x9B0B, 0xEF0B, 0xA618, 0xFFFF, 0x8133, 0xA627, 0x4A06,
+		0xC127, 0xC515, 0x7013, 0xFFFF, 0x7815, 0x1319, 0xCD1A, 0xFFFF, 0xF107, 0x001B,
+		0x160B, 0xFFFF, 0x6609, 0xDC02, 0x9006, 0x732B, 0x2D02, 0x0326, 0x1E03, 0xC70C,
+		0xAF0C, 0x840B, 0x3513, 0xB103, 0x210B, 0xCF15, 0xFFFF, 0x0A03, 0xF714, 0x461B,
+		0xFFFF, 0x7A23, 0xAA04, 0x1E18, 0xFFFF, 0xAB07, 0xE838, 0xB413, 0x1503, 0xED1B,
+		0xFE0C, 0xA43D, 0xFFFF, 0x4505, 0xFFFF, 0x1816, 0xFFFF, 0x7126, 0x0324, 0xC818,
+		0x0C03, 0xA517, 0xCA0B, 0x3716, 0xA908, 0xBA12, 0x6F0B, 0x690C, 0xAD07, 0x9803,
+		0x6A1C, 0xEF23, 0xEE05, 0xFFFF, 0xE304, 0x5B06, 0x8612, 0xE505, 0x6D03, 0xEB2C,
+		0xBA09, 0x4809, 0x4C03, 0x5804, 0xCF09, 0xA40B, 0x6717, 0x880C, 0x2E04, 0x3E33,
+		0x6C11, 0x3D13, 0x510B, 0x8806, 0x1202, 0x6709, 0xC102, 0xC40B, 0x2508, 0x0A04,
+		0x6F17, 0xFFFF, 0x1004, 0x1F08, 0xA716, 0x9E28, 0xD116, 0xC40B, 0xF10B, 0x7101,
+		0x5307, 0x2619, 0x6D11, 0xCC11, 0xFFFF, 0x0014, 0x5B05, 0xB626, 0xE004, 0x6405,
+		0x421C, 0x4A04, 0x5703, 0x4602, 0xE61C, 0x6F02, 0xBD29, 0xFFFF, 0xB52A, 0x5D08,
+		0x9005, 0x4A2A, 0x8305, 0xA639, 0xB508, 0x6C29, 0x5615, 0x203C, 0xAE16, 0xEB05,
+		0x3D2C, 0x130B, 0x753B, 0x9F2D, 0x5F33, 0x5002, 0x2A03, 0x3405, 0xB008, 0x1806,
+		0xA912, 0x2502, 0x6B1A, 0x3E18, 0x9D04, 0x4619, 0x340A, 0x8213, 0x6909, 0x7F35,
+		0x4E1B, 0x110A, 0xCA1B, 0x6B17, 0x7303, 0xDD03, 0x890B, 0xC909, 0x3807, 0x9502,
+		0x130A, 0x7411, 0x7C2C, 0x3313, 0xD20A, 0xF127, 0x0601, 0xCF02, 0xFF09, 0x7A18,
+		0x5E03, 0x4103, 0x560B, 0x1C0A, 0x7303, 0xB508, 0x4D16, 0xBD09, 0xED09, 0xF52B,
+		0x0515, 0xD10C, 0xFFFF, 0x9B06, 0x1808, 0x6D07, 0xF313, 0x981B, 0x0C0B, 0x5811,
+		0xED15, 0x9618, 0xFFFF, 0xB708, 0x9304, 0x8706, 0x3C17, 0x521B, 0xC809, 0x4C16,
+		0xC50B, 0xB508, 0x6303, 0x120A, 0x0E05, 0x3802, 0xC614, 0xFFFF, 0x5001, 0xEE1B,
+		0xFA24, 0x7812, 0x5B16, 0xF905, 0xDB07, 0x1C03, 0x4101, 0x0335, 0x6128, 0xF205,
+		0xC603, 0x4B27, 0x580B, 0xC11B, 0x7807, 0x4D09, 0xD119, 0x4E29, 0xD304, 0x2602,
+		0x7A3A, 0x7928, 0x060B, 0x7912, 0x8C02, 0xBF23, 0xA417, 0xEC2D, 0xFFFF, 0x3613,
+		0x3B04, 0xFFFF, 0xAE03, 0x5E35, 0xFFFF, 0xEF05, 0x5809, 0x4105, 0x6914, 0xE40C,
+		0x733B, 0x8F1B, 0xF208, 0xE81A, 0x3808, 0xCA11, 0xE525, 0xFFFF, 0x5D15, 0x9029,
+		0x532B, 0xE302, 0xA91B, 0x5518, 0x4802, 0x8F1C, 0x5F08, 0x570A, 0xFFFF, 0x4511,
+		0x370B, 0xFFFF, 0xCE01, 0xFF12, 0xA51A, 0x8913, 0x0004, 0xDA15, 0xDF05, 0xEC3B,
+		0x3803, 0x0904, 0x331B, 0x2D14, 0x631B, 0x640B, 0x9701, 0xFFFF, 0xF31B, 0x9E04,
+		0xB717, 0x2729, 0xC706, 0x7002, 0x1402, 0x491C, 0x8F3C, 0xC725, 0x9908, 0x4E2D,
+		0x2915, 0x0F16, 0x511C, 0x350B, 0xE502, 0x4C14, 0x1004, 0xAD07, 0xA307, 0x6714,
+		0x2A0B, 0x8C04, 0x4C0B, 0x4C03, 0x2A04, 0xBF1C, 0x4926, 0xF20A, 0x3A0C, 0x8A3C,
+		0x2D19, 0x9806, 0x5407, 0x0803, 0xF123, 0xC104, 0xE00B, 0x2E06, 0x3D07, 0xF43D,
+		0x4803, 0xEA23, 0x8C12, 0xFF3D, 0x8E06, 0xFA0C, 0xB908, 0x2305, 0xD02D, 0xFFFF,
+		0x900B, 0x6C25, 0x0F2D, 0x770B, 0xFE0B, 0xF708, 0x9304, 0x5517, 0xB106, 0xC20B,
+		0x3F0B, 0x2B04, 0xC303, 0x400A, 0xB13C, 0x2712, 0x5906, 0x7632, 0xF908, 0x5005,
+		0xA007, 0xE10A, 0x2D05, 0x4C08, 0x4A3C, 0x9A2B, 0xD00B, 0x3A03, 0x6807, 0x5B07,
+		0x3102, 0x131B, 0xAC0B, 0x0235, 0xE404, 0x3B07, 0x9904, 0xD102, 0x3506, 0xAD03,
+		0x0923, 0xE404, 0xD609, 0x0602, 0xDE0C, 0x2334, 0xFFFF, 0xCC17, 0x4A1C, 0x4A1B,
+		0xFFFF, 0x063D, 0x3002, 0xDA06, 0x3739, 0xB006, 0x9E0B, 0x291A, 0x0237, 0x8904,
+		0x3025, 0x480B, 0xFFFF, 0xED11, 0x3104, 0xFFFF, 0x0B0A, 0x8003, 0xE502, 0x3C07,
+		0xAC3D, 0x2809, 0x6319, 0x9103, 0x0E04, 0x421B, 0x080C, 0x7503, 0xB214, 0x5B03,
+		0x0236, 0xE102, 0xC601, 0x282C, 0x9218, 0xA412, 0xD933, 0x0911, 0x8206, 0x9F04,
+		0x6F3C, 0xE003, 0x4035, 0xA40A, 0x1809, 0xFFFF, 0xA005, 0x2005, 0x440B, 0x6107,
+		0x9502, 0x5519, 0xA511, 0x8708, 0xE60B, 0xBD03, 0xAD11, 0xBA2B, 0xB507, 0xB304,
+		0x3228, 0xA818, 0x8714, 0xFFFF, 0x4702, 0xFFFF, 0xF918, 0xD011, 0x8009, 0x9128,
+		0x5324, 0xE711, 0xC312, 0x011A, 0x3307, 0x1035, 0x6E35, 0x8511, 0xFFFF, 0x5C18,
+		0x7B12, 0xB11B, 0x7D38, 0x1702, 0xF005, 0xA428, 0x1513, 0x6517, 0xCC05, 0x5107,
+		0x5716, 0xB709, 0xE21C, 0x1F0A, 0xE91A, 0x0619, 0xFFFF, 0x380B, 0x6D2A, 0x0C06,
+		0x4D09, 0xAB0B, 0xCE07, 0xEC24, 0x5F0B, 0x0D0B, 0xBA1B, 0x1919, 0xA60B, 0x9207,
+		0x0804, 0x3C14, 0xFFFF, 0x7E03, 0x7A02, 0xA53C, 0xF70B, 0xEA3D, 0x5314, 0x060B,
+		0x1214, 0x4A09, 0xFC0A, 0x7804, 0xFFFF, 0x6512, 0x0902, 0x8804, 0x0026, 0xA00B,
+		0x170A, 0xA302, 0xFFFF, 0xD02A, 0xF51C, 0xFFFF, 0x7503, 0xFFFF, 0x2A12, 0xC519,
+		0x3405, 0x7C23, 0xD62D, 0x5805, 0x2204, 0xB80B, 0x310A, 0xFE05, 0x5638, 0xFFFF,
+		0xFFFF, 0xB60A, 0x5C1B, 0xA124, 0x500B, 0x7417, 0x1606, 0x8009, 0x0509, 0xF802,
+		0xE009, 0xF804, 0x9F33, 0x501A, 0x0423, 0x6302, 0x4927, 0x0838, 0xDC06, 0x3C05,
+		0x6A0B, 0x7203, 0x8509, 0xFF28, 0x1D03, 0x9A02, 0xAB04, 0x7929, 0xFA13, 0x1405,
+		0x4B03, 0xA026, 0xA01B, 0xC51C, 0xFFFF, 0x6602, 0xB806, 0x1E15, 0xFFFF, 0x9316,
+		0x0702, 0xDB25, 0x8303, 0x4702, 0x0003, 0x2704, 0x1033, 0x6205, 0x6826, 0x5411,
+		0x7E0B, 0x4113, 0x6702, 0x990C, 0x8F1B, 0x2B19, 0xAF17, 0xCE0B, 0xFFFF, 0xBD04,
+		0xC504, 0x8327, 0xDA0A, 0x5004, 0xF027, 0xE216, 0x9B11, 0x790A, 0x9213, 0xD919,
+		0x7206, 0x5126, 0x080B, 0xA317, 0xD803, 0xDE09, 0x1C08, 0x2A02, 0x6412, 0xE537,
+		0x7A16, 0x8E1B, 0xA815, 0xFFFF, 0xF608, 0xC701, 0x5A1B, 0xCE1C, 0x2218, 0x5D11,
+		0xF72A, 0x0328, 0x7C09, 0xD43C, 0xA806, 0xAC04, 0xAB06, 0x912A, 0x1E37, 0x183A,
+		0xA238, 0xB611, 0x5A25, 0x0418, 0xE008, 0x2718, 0x9039, 0x8A03, 0xC108, 0x8908,
+		0x1F17, 0x1A04, 0x5003, 0xE108, 0xE21C, 0x6016, 0x290A, 0x853A, 0x9F06, 0xA00B,
+		0xFFFF, 0x1212, 0xA406, 0x3B05, 0x2B06, 0x3803, 0xFFFF, 0x150A, 0xFFFF, 0xD62D,
+		0xC701, 0x5D02, 0x640B, 0x9A09, 0xF013, 0xC404, 0xB609, 0xB111, 0x382C, 0x522D,
+		0xFD09, 0x930C, 0x8702, 0x753D, 0x1E04, 0xE106, 0x4909, 0x5718, 0x8E05, 0x2B02,
+		0x133B, 0x152C, 0x7002, 0xCB07, 0x7323, 0xA505, 0x5A14, 0x0B2D, 0x8024, 0x7818,
+		0x9407, 0xC50B, 0x1E03, 0xCA16, 0xF813, 0x241B, 0x8F13, 0x060A, 0x6608, 0x8B0C,
+		0xB106, 0x6A04, 0xA70B, 0x7028, 0x380C, 0x3304, 0xC20C, 0xEC2D, 0x5B02, 0xFFFF,
+		0x1916, 0xF13D, 0xC12C, 0xB92C, 0x2603, 0xC12C, 0x030C, 0x0B1A, 0x0902, 0x2E14,
+		0x411B, 0x9123, 0x352A, 0x5233, 0xA227, 0xBC16, 0x6F04, 0x1223, 0xF617, 0xD60B,
+		0xEC1B, 0x8302, 0x460B, 0xC904, 0x6B14, 0xE518, 0xC50A, 0x2E05, 0x013A, 0xF107,
+		0x6412, 0x1602, 0x3705, 0x4E0A, 0x760C, 0x7012, 0x3A02, 0x1A09, 0x1D33, 0x7207,
+		0x4305, 0xDF05, 0xFF1C, 0x7B15, 0xAD14, 0x8B27, 0x8006, 0x6F03, 0xA10A, 0x410B,
+		0x4615, 0x5408, 0x1925, 0xE805, 0xAE16, 0xE70C, 0xD609, 0x8108, 0xFA05, 0x0418,
+		0xFFFF, 0xC204, 0xAF03, 0x3B05, 0x321B, 0xDF13, 0x7712, 0xFFFF, 0xBD09, 0xD10B,
+		0x130A, 0x3E3D, 0xFFFF, 0xDC28, 0x5D09, 0xC20B, 0x7711, 0x3508, 0xC914, 0x9311,
+		0x481C, 0x0404, 0x1A24, 0xA706, 0x172C, 0x8835, 0x0233, 0x4C14, 0xFFFF, 0xFE07,
+		0x8018, 0x4B02, 0xF705, 0xDA06, 0xC806, 0x2203, 0x3B04, 0x1602, 0x4E02, 0x5416,
+		0x9217, 0xD003, 0xFFFF, 0xFA2C, 0xEA0B, 0x8C06, 0x9338, 0x730B, 0x8C18, 0xC603,
+		0x690B, 0xAA11, 0x6209, 0xA503, 0x6915, 0x7909, 0x8E15, 0xC21C, 0x9109, 0xAE26,
+		0xA411, 0x1038, 0x601B, 0xFD2C, 0x730B, 0x7C3D, 0x253D, 0x3302, 0x5923, 0x8533,
+		0x930B, 0x681A, 0xB20C, 0x5304, 0xC105, 0x5602, 0xE114, 0xFC0A, 0xFD04, 0xD402,
+		0x5A05, 0xAB08, 0x110B, 0x3C1A, 0xBD2A, 0xBF1A, 0x3714, 0xC908, 0x3B39, 0x9419,
+		0xC613, 0x0E06, 0x9118, 0x190C, 0x4533, 0xAD11, 0x081A, 0x1705, 0x3404, 0x5A2C,
+		0x1A02, 0x7D0B, 0x0E14, 0xFFFF, 0x8906, 0x3719, 0x7803, 0x4334, 0xD019, 0xFFFF,
+		0x2408, 0x1309, 0x3B1B, 0x520C, 0xFFFF, 0xAB06, 0xC00B, 0x0504, 0x5A08, 0xD02C,
+		0x4403, 0x8402, 0x0607, 0xFD14, 0xC932, 0x3302, 0xF023, 0x8407, 0x9F07, 0x7D0C,
+		0x3504, 0x5A08, 0x3C16, 0x960A, 0xF313, 0x2707, 0x4F0B, 0xB80C, 0xE608, 0x5411,
+		0x4F11, 0xFFFF, 0xAB08, 0xB113, 0x5D17, 0x7F07, 0xFB1B, 0x5129, 0xBB25, 0x403D,
+		0x901A, 0xFFFF, 0x0134, 0xED02, 0xAD0B, 0x0206, 0xFB0A, 0x4811, 0xC308, 0x8B06,
+		0xCA0A, 0x1229, 0x6F03, 0x2E25, 0x7827, 0x350A, 0xF108, 0xD103, 0x8605, 0x5318,
+		0x670C, 0x1E36, 0xA80B, 0xFFFF, 0x7F3D, 0x0905, 0x7B03, 0xB405, 0x3602, 0x903D,
+		0x500B, 0xD60B, 0x7404, 0x9C08, 0x672D, 0x2C0B, 0xA608, 0x2D02, 0x662D, 0x9815,
+		0x9104, 0xEA11, 0x6434, 0xBF04, 0xDA04, 0x491C, 0x613D, 0xB403, 0x2711, 0xF22C,
+		0x9D33, 0xAF06, 0x073D, 0x6A1B, 0x5B3B, 0x4D04, 0xBA3D, 0x4D06, 0x0604, 0xEE17,
+		0xE23C, 0x7A0A, 0x2B0B, 0xD705, 0x0503, 0x8416, 0xFFFF, 0xFA06, 0x9008, 0xB004,
+		0x2208, 0xA313, 0x492D, 0x5B12, 0x041B, 0xFFFF, 0xF813, 0xAF0B, 0xF805, 0xFFFF,
+		0xC20A, 0xFFFF, 0xE023, 0x5E05, 0xEB1C, 0x4B07, 0x2C05, 0xDD09, 0x0E03, 0x6D12,
+		0x8007, 0xB50A, 0xF71A, 0x3106, 0x2924, 0xF703, 0x0B07, 0x8B28, 0x7908, 0xBD04,
+		0x3608, 0x1406, 0xFE04, 0xD92A, 0x5812, 0x5603, 0x771A, 0x1D23, 0x5F07, 0xD818,
+		0x351B, 0x4304, 0x6639, 0x9903, 0x5305, 0x220A, 0x410C, 0xBC0A, 0x7D14, 0xB02A,
+		0x1B13, 0x910B, 0xCF07, 0x8309, 0x1607, 0xF006, 0x0007, 0xFFFF, 0xBA24, 0xD306,
+		0x2818, 0x5515, 0x9D07, 0xC714, 0x0D0B, 0x9906, 0x0D37, 0x7718, 0x412C, 0xE10B,
+		0x4615, 0xE505, 0x2E05, 0xFB09, 0x0D0B, 0xFFFF, 0x6F3B, 0xAE02, 0xF801, 0xFC13,
+		0xFE03, 0x7707, 0x4B07, 0x1F09, 0xFC29, 0x6A03, 0xF628, 0xFFFF, 0xFB3D, 0x3918,
+		0x8B09, 0x8516, 0xF805, 0x0D04, 0xD211, 0x660B, 0x5933, 0x2D05, 0x1B0A, 0xD312,
+		0x210B, 0x4709, 0x4302, 0x6B03, 0x1412, 0x3403, 0x4B14, 0xA114, 0x0202, 0xFFFF,
+		0x5904, 0x280A, 0xD407, 0x6006, 0x6302, 0x7E0B, 0x4708, 0xFFFF, 0x8703, 0x1632,
+		0x9907, 0x591C, 0x9B1C, 0x3A1B, 0x2208, 0x0236, 0x4F1B, 0x8518, 0xA702, 0x4D24,
+		0xD30B, 0x6018, 0x8708, 0x6124, 0x030B, 0x1003, 0xB803, 0xF917, 0x5937, 0x7003,
+		0x670B, 0x551B, 0xAE1C, 0x8F1B, 0x1C38, 0xFFFF, 0xD406, 0x3207, 0xFFFF, 0xCF0B,
+		0xBF06, 0xF806, 0x0F02, 0xF616, 0x0B18, 0x9B11, 0xB711, 0xFFFF, 0xE812, 0xA80B,
+		0xE903, 0xE605, 0x5B02, 0xB023, 0xFFFF, 0xDB34, 0x7C08, 0x1913, 0xCF04, 0x1E2C,
+		0x440C, 0xFFFF, 0xB103, 0xD10B, 0xC519, 0xF62C, 0x5304, 0x6C05, 0xFFFF, 0x1106,
+		0x0701, 0xD911, 0xAA2D, 0x8617, 0xFFFF, 0xE119, 0xF308, 0xAA06, 0xE80C, 0xA509,
+		0x6519, 0x9109, 0x9905, 0x0C05, 0x4B3D, 0xF90C, 0x8E1B, 0x7814, 0x6918, 0x171C,
+		0xDD0A, 0x4302, 0x0B01, 0xA11A, 0xFFFF, 0xD934, 0x7303, 0x7809, 0x2901, 0xA003,
+		0x1605, 0xC833, 0x0B0B, 0xFB0B, 0xF704, 0xA105, 0x7F0A, 0x9811, 0xA40B, 0xD533,
+		0x5206, 0xD21A, 0xE625, 0x0F03, 0x0D1C, 0x0503, 0xFFFF, 0x900A, 0x7409, 0x3409,
+		0x2E2A, 0xFA13, 0x7326, 0xB832, 0x491A, 0xE30B, 0xEC0A, 0x6314, 0x6008, 0x6C37,
+		0x130B, 0xFFFF, 0xA83D, 0x6702, 0x950B, 0x130B, 0x5D2B, 0x9339, 0x5002, 0x0D17,
+		0x6905, 0xF20A, 0x0D08, 0x2611, 0xD105, 0xA705, 0x0826, 0xFFFF, 0xEB1B, 0x0F39,
+		0x3003, 0x4334, 0xD613, 0x3209, 0x6911, 0x731B, 0xB52D, 0x3628, 0xD22D, 0xFFFF,
+		0xB72C, 0x3B11, 0xDB1B, 0xFFFF, 0x5307, 0xA40B, 0xD905, 0xFE18, 0x8E0A, 0xA02A,
+		0xF227, 0xF302, 0x0F0B, 0x3E34, 0x1D03, 0x3C07, 0x0504, 0xB833, 0xE416, 0x2E0A,
+		0xB00B, 0x240A, 0xAF19, 0xB938, 0x7015, 0x361A, 0xFC03, 0xFFFF, 0xB815, 0x4524,
+		0x661C, 0x9D03, 0xB027, 0x6903, 0xCF23, 0xD107, 0xA437, 0x6129, 0x6502, 0xC324,
+		0xF125, 0x1312, 0x3C02, 0x8103, 0xDA08, 0x1102, 0xCD03, 0x4323, 0xF123, 0x3209,
+		0xBD1C, 0x6C06, 0x4735, 0xB105, 0x2D14, 0x891B, 0x4A0A, 0xB503, 0xA518, 0xFF18,
+		0xC802, 0x9F02, 0x5C11, 0xBF11, 0xD603, 0xFFFF, 0xF70A, 0x6A02, 0xC01B, 0xFFFF,
+		0x4F03, 0x4105, 0xFFFF, 0xA30C, 0x8B06, 0x4B09, 0x4F0B, 0x2A06, 0x7709, 0xC10B,
+		0x1D29, 0x511A, 0x7706, 0xFFFF, 0x7514, 0x6F09, 0x0102, 0x0218, 0xD408, 0xCE06,
+		0x4E08, 0xFFFF, 0xFFFF, 0x3011, 0x2611, 0xFA06, 0xCE28, 0x0108, 0x3D0C, 0x9F09,
+		0xBF03, 0x7C0A, 0x141A, 0xD30C, 0x5B35, 0xFD02, 0xAF04, 0x1A02, 0xBC04, 0xE908,
+		0xF93C, 0xFFFF, 0x5F19, 0xD106, 0xF816, 0xF817, 0x6425, 0xF013, 0x6A11, 0x6524,
+		0xEA1C, 0x4205, 0x4F15, 0xB40B, 0x1A1B, 0x8608, 0xF717, 0x0B03, 0xB216, 0xB118,
+		0xEC14, 0x1706, 0x300B, 0xDD09, 0xA70C, 0x6A02, 0xB108, 0x8B05, 0x973A, 0x8209,
+		0x2511, 0xAD23, 0xDF08, 0xDB28, 0x4706, 0xFFFF, 0xBC02, 0xEE03, 0xE702, 0xAB35,
+		0xA50A, 0x5801, 0xD00B, 0xFA17, 0x4616, 0x8D14, 0xA609, 0x2829, 0x6C17, 0x1202,
+		0xFA19, 0x4607, 0xFE17, 0xCD03, 0xE60B, 0x4A23, 0xFC06, 0xE932, 0xCF09, 0xDB0A,
+		0xBC23, 0xAC1B, 0xF007, 0xD81A, 0xF00C, 0x5113, 0xFFFF, 0xCB09, 0x1E04, 0x7605,
+		0xF51C, 0xFFFF, 0x2003, 0xB019, 0xD214, 0x7A07, 0xFFFF, 0xEA11, 0xFFFF, 0xCA05,
+		0xDC06, 0xF102, 0x8E03, 0xDC09, 0x970C, 0x2F13, 0xC913, 0x4C0B, 0x6409, 0x2C06,
+		0x7205, 0x0207, 0xF614, 0xC00B, 0x8B08, 0x2D03, 0xF108, 0x631B, 0xC80A, 0x2004,
+		0x4B1B, 0xBE15, 0x7F04, 0xB329, 0x7E07, 0x0902, 0xDC2D, 0xD804, 0xCF03, 0x8003,
+		0xB616, 0x3402, 0x4B08, 0xFFFF, 0xAB16, 0xB606, 0xFFFF, 0xC111, 0x3918, 0xBC07,
+		0xFFFF, 0xC711, 0x5705, 0x471A, 0x4A02, 0x510B, 0x5B07, 0xFB06, 0x4D05, 0x3C13,
+		0xFFFF, 0xF113, 0x3301, 0x5F0B, 0x3729, 0x9F04, 0x0D03, 0x0712, 0xAC23, 0xA615,
+		0x390A, 0xB412, 0x1A04, 0xFFFF, 0x9B1C, 0x0E05, 0x9402, 0x1003, 0x5C02, 0x9213,
+		0xE617, 0x1B04, 0x6619, 0x4905, 0x5005, 0x780A, 0xEB19, 0x4437, 0xB708, 0x1519,
+		0xFFFF, 0x691B, 0x7316, 0x3803, 0x4112, 0x9207, 0xC809, 0x1605, 0xE332, 0x8D36,
+		0x9002, 0xD71C, 0xC715, 0xCD05, 0x8413, 0x140B, 0xE603, 0x663C, 0xCD38, 0x922C,
+		0xA707, 0xDE09, 0x9917, 0x0105, 0x4526, 0xA304, 0xFFFF, 0xFFFF, 0xFF17, 0xCE0B,
+		0xFF0B, 0xFFFF, 0x2012, 0xF605, 0x8B03, 0x7E04, 0xDC0B, 0x692B, 0x2A02, 0x3802,
+		0x0D32, 0x7B23, 0x5526, 0xD728, 0x4A23, 0xDD15, 0xA137, 0x1E28, 0x1505, 0x8B07,
+		0xFFFF, 0x5B0A, 0x1C06, 0xF10C, 0xFFFF, 0xC709, 0x8217, 0x220B, 0x783C, 0x2417,
+		0x6F0B, 0xE11C, 0x6F17, 0x9A23, 0x0003, 0x8111, 0x5F07, 0x2A06, 0x6109, 0xDE1B,
+		0xDE08, 0xC206, 0x6939, 0xB61A, 0x4306, 0xCA0A, 0xEC19, 0xCF34, 0x5A04, 0x3F06,
+		0x0F03, 0xA702, 0x8411, 0xA40C, 0x001B, 0x0315, 0x2713, 0x4138, 0xC803, 0x542D,
+		0x770B, 0x1B03, 0x7016, 0x7405, 0x7035, 0xFA1C, 0x5208, 0x7D03, 0xFFFF, 0xA73D,
+		0xE005, 0x9606, 0xCB04, 0xFFFF, 0x1513, 0x7317, 0x6633, 0xF638, 0x4B05, 0x5D11,
+		0xBB03, 0xA135, 0xDD23, 0x3009, 0x183D, 0x7414, 0x0A14, 0x6F02, 0x1B36, 0x8206,
+		0xCD02, 0x7A0B, 0xE202, 0xC701, 0x932C, 0x6D07, 0x7317, 0x2223, 0x2417, 0x4B25,
+		0x5A11, 0x7026, 0xD811, 0xA203, 0xA32C, 0x963D, 0x3C0B, 0x230B, 0xA11A, 0xD71C,
+		0xD10B, 0x1126, 0x662C, 0x1906, 0xFF17, 0xAF36, 0x7302, 0xCE1B, 0x2604, 0xFC03,
+		0xFFFF, 0xE40A, 0x0E08, 0x991C, 0x6C07, 0xFC0A, 0x1739, 0x3B0B, 0x9105, 0xCB02,
+		0xFFFF, 0xA318, 0x1C17, 0xA22C, 0xFFFF, 0xFFFF, 0x1A02, 0xF71B, 0x7023, 0xF506,
+		0xE208, 0x5703, 0xD00C, 0x3005, 0x6215, 0x0213, 0xDA14, 0x501B, 0xED0A, 0x150A,
+		0xE203, 0x6809, 0x780B, 0xAD02, 0xA61C, 0x5712, 0xFFFF, 0x0704, 0xB10A, 0xCB16,
+		0xE60C, 0x3904, 0x4F0A, 0xFFFF, 0xAC18, 0xFFFF, 0x4A1C, 0xA412, 0x2813, 0x072D,
+		0xB702, 0x3912, 0xEA1C, 0x8224, 0xE416, 0xDC03, 0x8D24, 0xEC07, 0x450B, 0xCF23,
+		0xB713, 0x1E05, 0x4303, 0x1406, 0xC10C, 0x7609, 0xC509, 0x8B17, 0x7B0B, 0x040B,
+		0x5604, 0x6E0A, 0xA115, 0x261B, 0xCD1A, 0x5707, 0x7913, 0x5636, 0x5402, 0xD319,
+		0x8818, 0xE501, 0xDE2A, 0x2911, 0x2A11, 0x0B02, 0x0108, 0x3903, 0xE70B, 0x7C15,
+		0x0708, 0x8A02, 0xB509, 0xA917, 0xB60B, 0xCC24, 0x8211, 0x4D1B, 0x883A, 0x1F09,
+		0x001A, 0x3E1A, 0x3703, 0x8B29, 0xC505, 0xFFFF, 0x2823, 0xE002, 0xC615, 0x6F12,
+		0xC708, 0xAA03, 0x3303, 0xFFFF, 0x8403, 0x4C12, 0x3917, 0x9B05, 0xFFFF, 0xC911,
+		0x7D04, 0x2508, 0xEC03, 0xBE17, 0xF70B, 0x9913, 0x8C2D, 0xC717, 0x6629, 0x7504,
+		0x6405, 0xE127, 0xED03, 0x7E02, 0x0509, 0xE70A, 0xE107, 0x1A25, 0xFF3D, 0xE839,
+		0x461C, 0xFFFF, 0x8C03, 0xF602, 0x4E34, 0x6E27, 0x5B06, 0x9F05, 0x6025, 0xAF04,
+		0xF508, 0x3804, 0x830C, 0xC512, 0xD917, 0xEB3B, 0xBB3D, 0x1107, 0x9406, 0x761B,
+		0xBC04, 0x793B, 0x6102, 0xEA04, 0x9708, 0x0D08, 0xF616, 0x7307, 0x7A05, 0x4506,
+		0xA30A, 0xD60B, 0xA329, 0x7B03, 0xA409, 0xA607, 0x0504, 0x3A0A, 0xCC03, 0x070C,
+		0xFA38, 0x7A03, 0x440C, 0xD407, 0xD307, 0xF504, 0x1C0C, 0xFFFF, 0xAB02, 0xD213,
+		0x7D09, 0xE118, 0xCF0B, 0xC90A, 0x0514, 0x353D, 0xFF29, 0x6733, 0xC534, 0xFFFF,
+		0xB605, 0x8211, 0x5C02, 0xFFFF, 0xA209, 0x690C, 0xBB05, 0xFFFF, 0x8002, 0x1705,
+		0x9B05, 0x4104, 0x8C25, 0x8503, 0x4F05, 0xFA09, 0xFFFF, 0x9E28, 0x7E2A, 0x5427,
+		0xB312, 0x5402, 0x1B11, 0xDB0A, 0x1F07, 0x1323, 0xC005, 0x7807, 0x2E0A, 0x8D16,
+		0x3111, 0xD50B, 0xEF05, 0x4E37, 0xA729, 0xDC0B, 0xF70C, 0x9E11, 0xF609, 0xF609,
+		0x8012, 0xA105, 0xCE04, 0xFFFF, 0xA72D, 0xFFFF, 0x721C, 0x2A05, 0x2A11, 0x5B14,
+		0xC903, 0x5408, 0xE236, 0x3803, 0x0507, 0xF707, 0xE517, 0x3A16, 0xCB08, 0x4D2C,
+		0xB01A, 0x0B02, 0xAE08, 0x160A, 0xD502, 0xCD09, 0x3311, 0x0208, 0xF211, 0x1906,
+		0xE505, 0x311A, 0xCC16, 0x932B, 0x9F28, 0xEA19, 0xA61B, 0x900A, 0xC72C, 0x1304,
+		0xCF03, 0xCE0B, 0xAB19, 0x5605, 0xC40B, 0xC02D, 0xE518, 0xE705, 0xF206, 0x0A24,
+		0x8A19, 0x5A08, 0xB911, 0xFFFF, 0xFFFF, 0x0E19, 0x6008, 0x0111, 0x0A14, 0x3A0B,
+		0x5918, 0x9D05, 0x3905, 0x2023, 0x5703, 0x4E14, 0xFF2B, 0x740B, 0x2901, 0x9A0C,
+		0x9118, 0x840C, 0xE11A, 0xDC15, 0x0203, 0xB411, 0x1311, 0x8B04, 0x4803, 0x670B,
+		0x3B39, 0x4104, 0xF904, 0x8403, 0x8A08, 0x0025, 0xAD09, 0x7911, 0xE803, 0x0304,
+		0xBC0A, 0xE00C, 0x0B0A, 0x7E26, 0xE106, 0x9512, 0xFC07, 0x661B, 0x2934, 0xA819,
+		0xB60B, 0xF80C, 0x6503, 0x7013, 0xE726, 0x8E0C, 0xBC1B, 0x0B0A, 0xFF05, 0x0528,
+		0xA906, 0xFFFF, 0x8118, 0x4707, 0xFFFF, 0xFFFF, 0xDB18, 0x4B3D, 0xDD03, 0x290B,
+		0xFB07, 0x8108, 0xDB08, 0x3D02, 0x5306, 0xBA0B, 0x2F37, 0x321B, 0x2C05, 0xCE02,
+		0xD333, 0xED02, 0x050C, 0x8505, 0xF516, 0x1C03, 0x1608, 0xE504, 0xFFFF, 0x9417,
+		0xB727, 0xB10C, 0xD605, 0xD509, 0xCB09, 0xB603, 0x0107, 0x2F18, 0x961C, 0x4C08,
+		0x8F12, 0x8412, 0x2E03, 0x290A, 0x1029, 0x5006, 0x8B07, 0x010A, 0x9D26, 0xCE2B,
+		0xB238, 0xF403, 0x6D36, 0xC40B, 0x8536, 0x3316, 0x780A, 0x742C, 0xEE03, 0xAA39,
+		0x400B, 0x4002, 0x240B, 0xAD13, 0x872D, 0xDA25, 0x1E15, 0x2B08, 0xFFFF, 0x4302,
+		0xF603, 0x291B, 0x7905, 0xF40C, 0xBA14, 0x4A02, 0xD003, 0x570A, 0x2F11, 0xEA05,
+		0xBB33, 0x8604, 0xEB1B, 0xF202, 0xA907, 0xA908, 0x7B07, 0x9009, 0x4025, 0xCB09,
+		0x4037, 0xAB13, 0x2E07, 0xFFFF, 0x8A0B, 0x8C03, 0x522C, 0x470C, 0xFFFF, 0x230C,
+		0x2A12, 0xFFFF, 0xB606, 0x7618, 0x0503, 0x9C08, 0x1023, 0x7205, 0x7D08, 0xE117,
+		0xB51B, 0xBA18, 0xE003, 0x4207, 0xBB39, 0x2A12, 0xFFFF, 0x1B08, 0x9C0B, 0x1404,
+		0x540B, 0x643A, 0x5524, 0x3805, 0xF118, 0x9D05, 0xFFFF, 0x1902, 0x9D11, 0x6B04,
+		0x7E05, 0xB408, 0x3B18, 0xDB18, 0x210A, 0xFC06, 0xCD1A, 0x0304, 0xE40C, 0x3914,
+		0x2625, 0xB808, 0x3526, 0x9615, 0xCF05, 0x1029, 0xAB16, 0x5505, 0x0E08, 0xA805,
+		0x4C3B, 0xC21C, 0xA12D, 0x2806, 0x4D33, 0xCC3C, 0xFFFF, 0xFFFF, 0xAA0B, 0x9706,
+		0xAF2A, 0x8D08, 0xD107, 0xFE02, 0xC41C, 0xD927, 0x1F15, 0x000C, 0x3D09, 0xF003,
+		0x0109, 0x8202, 0xB50B, 0x2703, 0xBC0C, 0xEE09, 0x4503, 0xBB0A, 0x1E1C, 0x7C0B,
+		0x592B, 0xB327, 0x2E14, 0x4A13, 0x5712, 0xD819, 0x690C, 0x1104, 0x7701, 0x7929,
+		0x9305, 0x9C13, 0xEE2B, 0xB40B, 0xFFFF, 0x4007, 0x5F03, 0x2B13, 0xAC13, 0x991A,
+		0x9B2D, 0xAB34, 0x6413, 0x9E11, 0x4909, 0xD605, 0x8709, 0xBD03, 0x791B, 0xEE13,
+		0x300B, 0x2803, 0xF604, 0x070A, 0x8B3C, 0x0B03, 0xAE05, 0xC40B, 0xBF05, 0xFFFF,
+		0x1D08, 0xAB14, 0x2A02, 0x1114, 0xF108, 0xBB0B, 0xB835, 0x6B07, 0x9317, 0xFFFF,
+		0x0729, 0x4C0B, 0x4505, 0xED36, 0xEA12, 0xDB13, 0x6A06, 0x6403, 0x0C09, 0xCF0B,
+		0xC439, 0xFFFF, 0xEE0B, 0x820B, 0x1103, 0xA72D, 0xD209, 0xEE2C, 0xA00C, 0xFFFF,
+		0x122D, 0x1402, 0x5C11, 0xAD35, 0xFC27, 0x0A08, 0xB108, 0xF511, 0xD61B, 0x7003,
+		0x7F06, 0x8203, 0x9107, 0x5D02, 0x4323, 0x7603, 0x3F18, 0x6515, 0x4604, 0x9E16,
+		0x3128, 0x7D11, 0x4A27, 0x4E07, 0x4E24, 0x330A, 0x3108, 0xFB23, 0xDE14, 0x390C,
+		0x1F07, 0x4C1B, 0x0605, 0xC302, 0x1D03, 0xEC02, 0xEE05, 0x0B02, 0x2A28, 0x590B,
+		0x6D07, 0xFFFF, 0xAC07, 0x8A3D, 0x2A27, 0xED0A, 0x7311, 0x5203, 0x6514, 0x9C24,
+		0xD00B, 0xFFFF, 0x3A04, 0xE705, 0x5904, 0xAF02, 0x5A0A, 0x7E02, 0x7619, 0x7E04,
+		0x6B0B, 0x2B0C, 0xAB0A, 0x400B, 0x6018, 0x413C, 0x7E14, 0xDA04, 0x1204, 0x091C,
+		0xDC08, 0x9D37, 0x4416, 0x5A08, 0xAB01, 0x3F0B, 0xEE3A, 0x8008, 0x4102, 0x2C13,
+		0xFFFF, 0x5E03, 0x882D, 0x1A04, 0x9511, 0x0E23, 0xA43A, 0x8D3A, 0x7F0B, 0x7F37,
+		0x0408, 0x9703, 0x9304, 0x9809, 0xA008, 0xCB12, 0xD537, 0xFA11, 0x7B23, 0x4714,
+		0x8A11, 0xD20B, 0xF613, 0x7612, 0x6102, 0x3408, 0xC10C, 0xB302, 0x7715, 0xA405,
+		0x7B0A, 0x6C38, 0x450B, 0x3102, 0xA91C, 0xFD0B, 0xBF0A, 0x5C03, 0xE10A, 0x303D,
+		0x0C35, 0x7D27, 0x5315, 0x4103, 0x7904, 0x6809, 0xFA0A, 0x6109, 0xA006, 0xF10C,
+		0xF811, 0x0C36, 0x0B07, 0x4D0A, 0xF10B, 0xFFFF, 0x133B, 0x4005, 0x8B0A, 0x9F23,
+		0xE425, 0xDA14, 0x4605, 0x093A, 0x1814, 0x0407, 0x6236, 0x6903, 0xC119, 0xAE05,
+		0x881A, 0xFFFF, 0x2207, 0x5B0A, 0xA304, 0x6D05, 0xA803, 0x4917, 0x1F08, 0x0E0A,
+		0x0D12, 0x0A0B, 0x2D03, 0xE615, 0x9D07, 0x0A02, 0x2C03, 0x8F32, 0x4E17, 0xA212,
+		0x830B, 0x5904, 0xC002, 0x4D02, 0x680B, 0xC407, 0x0D14, 0xE411, 0xFD16, 0x211A,
+		0x1507, 0x1106, 0x152D, 0xA12A, 0x3E0B, 0xD112, 0x8719, 0x5F06, 0xF804, 0x0816,
+		0x940A, 0xC615, 0x2E05, 0xDF07, 0x4411, 0x5A08, 0x1F38, 0xFFFF, 0xBF1A, 0xF202,
+		0x9C06, 0xFE2A, 0xC61B, 0x0C17, 0x6102, 0x6C23, 0xA207, 0x2B2C, 0xF602, 0x3224,
+		0xEA0A, 0xFFFF, 0x680B, 0xD416, 0xBC09, 0xC211, 0xC517, 0xF91B, 0x9309, 0x0C05,
+		0x4915, 0x470C, 0x411B, 0x122D, 0xE50B, 0xBF05, 0xDF1B, 0x8705, 0x1104, 0x9D07,
+		0xBE11, 0xE425, 0x5B09, 0xE932, 0xFB09, 0x4B02, 0x0B0A, 0x5F07, 0x4F05, 0xFFFF,
+		0x3117, 0x2018, 0x7E16, 0x0712, 0xE20C, 0x0E36, 0xF007, 0xC116, 0xC613, 0x3A03,
+		0xE002, 0x6A07, 0xA52A, 0x4A06, 0xB11A, 0xAC0A, 0xBA04, 0x4713, 0xBD08, 0x5C1A,
+		0x7614, 0x6315, 0x4B0A, 0xFFFF, 0x2713, 0xA316, 0x0624, 0xD804, 0x6112, 0x6E1A,
+		0x2213, 0xBB34, 0x3D0C, 0x120A, 0x6112, 0xDB03, 0x510A, 0x4123, 0x2328, 0x1105,
+		0x5602, 0xAE33, 0x9E03, 0xA024, 0xAE17, 0xD316, 0x2503, 0xF111, 0x7418, 0x0A13,
+		0x211A, 0x9D09, 0xAF05, 0x7D14, 0x6F1C, 0x3D2B, 0x710B, 0x6403, 0x2605, 0x8E04,
+		0xEC04, 0x2614, 0x1F14, 0x9502, 0x0019, 0x1F36, 0xEB0B, 0x5405, 0x980A, 0xA402,
+		0x6F36, 0xA217, 0x1F18, 0x6C04, 0xA009, 0x8D03, 0x362B, 0xD116, 0xFFFF, 0xFFFF,
+		0x1C29, 0x4925, 0x0302, 0xFF17, 0x4E25, 0x7A09, 0xFFFF, 0x1803, 0x5F08, 0x7A07,
+		0xC207, 0x4703, 0x4E15, 0xEC03, 0xDF03, 0x3E08, 0x9405, 0xD31A, 0xEC23, 0x130B,
+		0x9611, 0xD204, 0xA606, 0x9504, 0xFFFF, 0xB928, 0xFE06, 0x6902, 0x6408, 0xBA0C,
+		0xE235, 0xB308, 0x6219, 0xC029, 0xF902, 0x4603, 0xEF17, 0x6C03, 0x3406, 0x3C14,
+		0xA912, 0x3306, 0xFA04, 0xFFFF, 0x6325, 0xF52D, 0xB60A, 0x5608, 0x0A01, 0x1B03,
+		0x0318, 0x473D, 0x3234, 0x190C, 0x783D, 0x8238, 0x5D1C, 0x5612, 0x5C04, 0x7412,
+		0xDF2A, 0xEF02, 0xFFFF, 0x870A, 0x4106, 0xD523, 0x6402, 0xE803, 0x0008, 0xDC15,
+		0xF03C, 0x0B35, 0x0916, 0xCE34, 0xC304, 0x7F34, 0x1725, 0xE809, 0x4506, 0x0506,
+		0xAA02, 0xC409, 0xA113, 0xEF03, 0x4D03, 0xDB25, 0xA602, 0x5F1A, 0x520B, 0x6D0B,
+		0xDB0C, 0xA308, 0xC202, 0xDF07, 0x3616, 0x1402, 0xFFFF, 0x7D03, 0x7A19, 0xDD36,
+		0xEC08, 0xC605, 0x7B07, 0x8702, 0x710B, 0xD119, 0x4A05, 0x650A, 0xBF1C, 0x8405,
+		0xA902, 0x0009, 0xFFFF, 0x4219, 0x5005, 0xE11B, 0x9F07, 0x9015, 0x5E13, 0x3008,
+		0x6C06, 0x7E07, 0x4709, 0xE61B, 0x2017, 0x2C0B, 0xD30C, 0x9D12, 0x4F03, 0x253D,
+		0x1F18, 0x480B, 0x4704, 0x0C1B, 0xBA09, 0x4A09, 0xD508, 0x1E07, 0xAC07, 0x0D17,
+		0xC335, 0xFFFF, 0xCF09, 0x5224, 0x8002, 0x9D14, 0x0603, 0x0311, 0xB401, 0x6A02,
+		0x201C, 0x6D02, 0xFD14, 0x2B2C, 0x2A39, 0x262D, 0xF827, 0xC418, 0x9519, 0x2B01,
+		0x3005, 0x3908, 0x1D06, 0xD605, 0x2305, 0xFF05, 0xEE04, 0x5828, 0xE406, 0xB324,
+		0xA708, 0x162B, 0x0936, 0x2F0C, 0x5205, 0xDE03, 0xBB07, 0x9709, 0x0908, 0xCE2B,
+		0x2E33, 0xCC08, 0xFFFF, 0x5417, 0x5719, 0x2A05, 0x7008, 0xFFFF, 0x5203, 0x753D,
+		0x8B03, 0xFFFF, 0x150A, 0x5323, 0xFF15, 0x2809, 0x580A, 0xB314, 0x4408, 0x0A13,
+		0xC914, 0x1718, 0x2303, 0x1E02, 0x3306, 0x6B3A, 0xF304, 0x6E03, 0xA83D, 0x9F13,
+		0x8E03, 0x6C11, 0x2734, 0xFFFF, 0x6615, 0x070B, 0x6904, 0x5C18, 0x5804, 0x3C0A,
+		0x370B, 0x390C, 0x2E26, 0xA936, 0xFFFF, 0x2314, 0xCF07, 0xDC06, 0x8C11, 0x1F32,
+		0xF409, 0x220B, 0xA029, 0xC411, 0x4815, 0x1416, 0x9B2D, 0x6434, 0x8839, 0xCE07,
+		0x7207, 0xFFFF, 0x2802, 0x3A2C, 0xD809, 0x0003, 0x8F11, 0xF224, 0x391A, 0x4B18,
+		0xFFFF, 0x1B07, 0x5B0C, 0x9C16, 0xCA07, 0x7B11, 0x0702, 0x0918, 0x1A25, 0x1A11,
+		0x5E05, 0xF408, 0xA209, 0x7D07, 0x9E04, 0xAA1B, 0xB816, 0x7C04, 0x1F07, 0xF815,
+		0x4A3D, 0x7A0B, 0xBF17, 0x4615, 0xFFFF, 0x2B2C, 0x9716, 0xFA04, 0xCB16, 0x0E02,
+		0xAD02, 0x2A18, 0x633C, 0xDB16, 0xE43D, 0xF802, 0x7632, 0x2208, 0x2202, 0xEB2D,
+		0xED0B, 0xC504, 0x9D03, 0xFFFF, 0xC802, 0x2E24, 0xEE0C, 0xE823, 0x422D, 0xCE11,
+		0xD13A, 0x7337, 0xFD2D, 0x6F13, 0x7B15, 0xA10B, 0xF008, 0x6505, 0xC711, 0x5D2C,
+		0xFFFF, 0x4B09, 0x9A06, 0xF505, 0xDA03, 0x4523, 0xA504, 0x061C, 0x3808, 0x0913,
+		0xFFFF, 0x620B, 0xE107, 0xA005, 0x3C16, 0xAE03, 0x840B, 0xC605, 0xF01B, 0xFFFF,
+		0x3409, 0xCB08, 0x4E17, 0x4504, 0xE709, 0x2B12, 0xD505, 0xD612, 0xA614, 0x7817,
+		0xFB08, 0xF606, 0x382C, 0xFFFF, 0xA405, 0x8D0B, 0xD41B, 0xCF03, 0xB206, 0x5C0A,
+		0x0B06, 0x3611, 0x9E16, 0x9E24, 0xAC0B, 0xFFFF, 0x8C24, 0xFE04, 0x1D08, 0x4803,
+		0x9603, 0x8508, 0x5B09, 0xD407, 0x8215, 0xCD1C, 0xBA03, 0x9E06, 0xA104, 0x2E32,
+		0x1218, 0xFFFF, 0xBF33, 0x2504, 0x622C, 0xFFFF, 0x3E05, 0x7203, 0x0206, 0x8518,
+		0x5A09, 0x0714, 0x3C09, 0x2B0A, 0xB00B, 0xBD14, 0xFFFF, 0xA61B, 0xFFFF, 0xC21C,
+		0xB502, 0xFFFF, 0xFF12, 0xE80C, 0x6907, 0x5716, 0xB604, 0xB81A, 0x9911, 0x3B11,
+		0x9712, 0x1F0C, 0x8B08, 0x2D19, 0x9B33, 0x1007, 0xFFFF, 0xF307, 0x8111, 0xE106,
+		0x0E0B, 0x1304, 0xB72C, 0xF712, 0x2F0B, 0x4909, 0x8709, 0x3503, 0x510C, 0xCA06,
+		0x5916, 0xE116, 0xA412, 0x0B29, 0x090C, 0x5C35, 0xB306, 0xFFFF, 0xDA05, 0x7D18,
+		0x8408, 0x1B3A, 0xC10B, 0x5802, 0xFF2C, 0xBB15, 0x5F07, 0x241A, 0x922D, 0x5A15,
+		0x1C3C, 0x5E07, 0x0A06, 0x7105, 0xA716, 0xFFFF, 0xBA2B, 0xF70A, 0xFB19, 0x8608,
+		0x5F3A, 0x1A25, 0x8306, 0x3105, 0x8C08, 0x923A, 0x6807, 0x5804, 0xAB06, 0xD423,
+		0x8126, 0xCE11, 0xD00B, 0x0E1A, 0x5101, 0xEC12, 0xDF23, 0x1913, 0x5923, 0x8D0C,
+		0xE906, 0xFFFF, 0xC907, 0xF838, 0xFFFF, 0xE20B, 0x7326, 0x9A05, 0x3527, 0x5808,
+		0x3E24, 0x5302, 0xE118, 0x070B, 0x6C02, 0xDC0C, 0x3719, 0x9023, 0xD211, 0x7412,
+		0x2311, 0x7B07, 0xA033, 0xE114, 0xEF08, 0xFFFF, 0x3609, 0xE21A, 0xEE09, 0x2709,
+		0xFE1B, 0xE003, 0x6D02, 0xD118, 0x4A0B, 0x2103, 0x740A, 0xB90B, 0x5232, 0x2B03,
+		0x0D29, 0xFB32, 0xA809, 0xF823, 0xF502, 0x7C28, 0xE82D, 0xFFFF, 0xFE03, 0xDE23,
+		0x360C, 0xD801, 0x6E16, 0x7312, 0x3B08, 0xBD38, 0x1006, 0x8704, 0xB006, 0xFFFF,
+		0xCD01, 0x9608, 0xD024, 0x3325, 0x8D05, 0xF71C, 0x7D18, 0xD509, 0x5012, 0x3002,
+		0x4F11, 0x5502, 0x442C, 0xB30A, 0xC903, 0x420B, 0x3E04, 0xE00A, 0xBE0B, 0xAD19,
+		0x1A01, 0x1406, 0x630B, 0x2803, 0xE403, 0xB411, 0x8835, 0xB209, 0x7705, 0x8B04,
+		0xF203, 0xDA19, 0xC209, 0x9C25, 0xE905, 0x6A07, 0x0037, 0xDF13, 0xD009, 0x6803,
+		0x8A09, 0xA514, 0x9E03, 0x3604, 0xF501, 0x2809, 0x5204, 0xE801, 0x6B03, 0x1F09,
+		0x2733, 0x4F0B, 0x0627, 0x8313, 0x921B, 0x6A17, 0xB904, 0x1203, 0x1B02, 0x4C14,
+		0x3802, 0x7C06, 0xAD12, 0xD904, 0x703D, 0xFFFF, 0x2937, 0xDB13, 0x7611, 0xAF13,
+		0xE41C, 0x4911, 0xDF1B, 0x602D, 0x4211, 0xFFFF, 0xAB18, 0xFFFF, 0xFFFF, 0xB606,
+		0x7406, 0xFFFF, 0xD804, 0xDC0C, 0xE302, 0x351C, 0x2024, 0x6D0B, 0x4D0B, 0xF20A,
+		0xBB16, 0x2502, 0x210A, 0xFFFF, 0x1826, 0x3B08, 0x2B08, 0xBB27, 0x211A, 0xBB06,
+		0xB41A, 0xE909, 0xC702, 0x8935, 0x7211, 0x8D11, 0x6423, 0x2718, 0xBD0A, 0xB20B,
+		0x8004, 0x8D14, 0xFFFF, 0x781B, 0x970A, 0x3336, 0x6B0B, 0xDD19, 0xA703, 0x3D16,
+		0xFFFF, 0xD102, 0x382A, 0x8314, 0xF80C, 0xFC05, 0x1202, 0x9D03, 0xF803, 0x9409,
+		0x8609, 0x7E1C, 0x3E37, 0x0B2D, 0xF001, 0xDF0C, 0x4B03, 0xEC02, 0xE207, 0x2916,
+		0x3A12, 0xF016, 0xFFFF, 0x473B, 0x9C02, 0x070B, 0xC317, 0xAA28, 0x7C13, 0xFFFF,
+		0xC61B, 0x9112, 0x9D13, 0x8C03, 0x5624, 0xA10B, 0xA003, 0xD013, 0x2E26, 0x5035,
+		0x3927, 0x0906, 0x1B39, 0x0C36, 0x2402, 0xDE1C, 0xE30B, 0xD415, 0x6E13, 0x9F24,
+		0xFC05, 0x1B0B, 0x1A03, 0xBA0C, 0x8A08, 0x5711, 0xD512, 0xC10C, 0x1009, 0x8E0A,
+		0xDB2D, 0xE906, 0xD513, 0x8303, 0x6819, 0x9005, 0x7109, 0x4C08, 0xEC34, 0xF203,
+		0xB81B, 0x4D06, 0x9909, 0x5809, 0xAE2C, 0x3906, 0x0923, 0x9229, 0xFFFF, 0xED05,
+		0x3407, 0xE329, 0x6F0C, 0xDD02, 0xED12, 0x7D0A, 0xA12B, 0xB718, 0x7C04, 0x0C02,
+		0x1D04, 0x9B17, 0x1724, 0xFFFF, 0xC313, 0x110C, 0xD207, 0x2A05, 0xFC04, 0x511B,
+		0x680A, 0xD918, 0x5A37, 0x1F0B, 0xA525, 0x5108, 0xF519, 0x9107, 0xA808, 0xCA17,
+		0x5706, 0x9B04, 0x1A09, 0xFC05, 0x8D15, 0x4609, 0xFFFF, 0x3123, 0xB737, 0x4C06,
+		0x9104, 0x4608, 0x2F18, 0x7F02, 0x9704, 0xD603, 0x1D29, 0xC602, 0xFFFF, 0xA703,
+		0xFFFF, 0xB81A, 0xEC17, 0xD71C, 0x630B, 0x8106, 0x1303, 0xC332, 0x1D11, 0x5A07,
+		0xD629, 0x930A, 0xD205, 0x211B, 0xE434, 0xFD03, 0xA20B, 0xE205, 0xCA07, 0x170B,
+		0x1A04, 0xF315, 0xE202, 0x8706, 0x810C, 0x5914, 0x0B16, 0xFFFF, 0x660B, 0x6E11,
+		0x3D17, 0x2C2B, 0xF113, 0xED2B, 0xB726, 0x3735, 0x451B, 0xE816, 0xF312, 0x4704,
+		0xA11C, 0xA414, 0x870A, 0xC539, 0xCB1A, 0xE414, 0x0803, 0xCE15, 0x7A15, 0x2F1C,
+		0xF812, 0x4305, 0x9A11, 0x8104, 0x5C28, 0x740B, 0x5106, 0x583D, 0xCF09, 0x0902,
+		0x4E25, 0xD804, 0x4605, 0x3D39, 0x5005, 0x192A, 0xC709, 0xC006, 0xC807, 0x271B,
+		0x2C13, 0x2302, 0x9B18, 0x8815, 0xFE23, 0x4212, 0x2A26, 0x9B04, 0xB107, 0xF90A,
+		0xBC02, 0x951B, 0xFA3D, 0x5A3D, 0x410B, 0x640A, 0x7133, 0xFFFF, 0xC034, 0x2E1C,
+		0x9D1B, 0x3328, 0xF209, 0xEF02, 0x1F14, 0x7705, 0xC605, 0x6814, 0x7E2D, 0xE732,
+		0xF803, 0xCC07, 0x5325, 0xBB03, 0xB31C, 0x1B06, 0xFB3D, 0x3518, 0x6206, 0x070A,
+		0x6823, 0x990B, 0xBD11, 0xD317, 0xB801, 0xA303, 0xF205, 0x6917, 0x890C, 0x6C08,
+		0xFFFF, 0x1702, 0x5717, 0x3004, 0xC002, 0x7314, 0xFFFF, 0x770B, 0x4A2A, 0xA22C,
+		0x0203, 0x3C11, 0xB502, 0x3611, 0x6F38, 0x8615, 0x1F39, 0x4306, 0x9C12, 0xB911,
+		0xB905, 0x7F07, 0xB929, 0xFFFF, 0xE916, 0x7C1C, 0x3B11, 0x7F0A, 0xFB0C, 0x4D16,
+		0x8B03, 0x6D0B, 0xBB08, 0x3718, 0xC235, 0xE40A, 0x2C02, 0xD23D, 0x3D17, 0x160A,
+		0x7814, 0x0902, 0xC80C, 0x7209, 0x5304, 0xF30A, 0xA42C, 0x9217, 0xFFFF, 0x5608,
+		0xAE15, 0x182A, 0x2F1C, 0x2102, 0x9339, 0x6F07, 0x120B, 0xCF0B, 0x5408, 0x1309,
+		0x8A17, 0x760B, 0x1A01, 0xBC03, 0xE20A, 0xB109, 0xFE07, 0x7302, 0xCB0B, 0xB626,
+		0x710C, 0x1018, 0x0433, 0xF704, 0xFA2A, 0x7402, 0x7C1B, 0x8E05, 0xF312, 0xE309,
+		0xFA02, 0x420B, 0x7D15, 0xDC08, 0xF517, 0x3F07, 0xEA03, 0x9F0B, 0x3503, 0x9704,
+		0xFFFF, 0xC404, 0x7D0C, 0xA803, 0x3A23, 0x6B05, 0x7102, 0x780C, 0x3902, 0x9211,
+		0xD605, 0xBE39, 0x150A, 0x5116, 0x4411, 0x9E06, 0xA11B, 0x8811, 0x0E0A, 0xD619,
+		0x7416, 0x3427, 0xF823, 0xF202, 0xD907, 0xEE17, 0x901A, 0x3019, 0xC105, 0x9109,
+		0xE805, 0x2333, 0xCE08, 0x5509, 0xBD06, 0xF63D, 0x4C2B, 0xED08, 0x9916, 0x0D16,
+		0xB535, 0x5E18, 0x0A02, 0x0703, 0xF506, 0xDD19, 0x9806, 0x7E14, 0xCD0B, 0x1602,
+		0x3B06, 0x4D15, 0xF00B, 0xBF36, 0x8E19, 0x8818, 0x8E27, 0x4719, 0x3E02, 0x890A,
+		0x8507, 0x8804, 0xDF07, 0xAC3D, 0xB303, 0xAA16, 0x0504, 0xC204, 0x0916, 0x200C,
+		0x1405, 0x141C, 0x950B, 0x4108, 0x2003, 0x273C, 0x8315, 0x4E16, 0x510B, 0xE737,
+		0xAD27, 0x0218, 0xCF08, 0xFFFF, 0x7323, 0xA305, 0xA00B, 0x6932, 0x801A, 0xFFFF,
+		0xFA0A, 0xFFFF, 0x9504, 0x7C0C, 0x2402, 0xE008, 0x9605, 0xBC2B, 0x1204, 0xB11A,
+		0xDE04, 0xEE24, 0xC708, 0x5F03, 0x4C09, 0x5905, 0x9E0B, 0xFFFF, 0x8D02, 0x960B,
+		0x6306, 0x170B, 0xDF03, 0x2539, 0xD914, 0x6634, 0x170A, 0x6A13, 0x3D02, 0xE406,
+		0x0D08, 0xFD0A, 0x9003, 0x8C09, 0xE308, 0x321C, 0xFFFF, 0x0016, 0x9902, 0x1B3D,
+		0xFFFF, 0x4408, 0x7104, 0x8D03, 0xDA08, 0xDE3D, 0xDB0B, 0x0A05, 0x5103, 0x131A,
+		0xFFFF, 0x6F13, 0x631C, 0x8A04, 0x3C0B, 0xC40B, 0x9408, 0x8505, 0x7803, 0xFFFF,
+		0x9111, 0x510B, 0xEB0A, 0x7211, 0xDD05, 0x991B, 0xBF1A, 0xCE3C, 0x3907, 0x0E04,
+		0x6B34, 0x3514, 0xF70A, 0x2D18, 0xE207, 0x0A16, 0x440B, 0x5B1C, 0xBB03, 0x460A,
+		0xFA37, 0xFFFF, 0x4524, 0xD30B, 0x0409, 0xA80B, 0x7802, 0xFFFF, 0x8819, 0x7A11,
+		0xE814, 0xFFFF, 0x592D, 0x3607, 0xFFFF, 0x1D0A, 0xFF14, 0x2804, 0xEE11, 0xC338,
+		0x0113, 0xB703, 0xAA37, 0x5602, 0xF202, 0x3429, 0x5F0A, 0xBB35, 0xDC02, 0x8C06,
+		0xC40B, 0x330A, 0xF524, 0xA51C, 0xD102, 0x7203, 0x8103, 0xC126, 0x2C05, 0x4806,
+		0xC611, 0xDD15, 0x243B, 0x4C04, 0x0811, 0x262C, 0xDC19, 0x9805, 0x7A08, 0xB908,
+		0xAC0C, 0xFFFF, 0xBC06, 0x1E12, 0xE60B, 0x2904, 0x1B08, 0xD118, 0x9B25, 0x3F0A,
+		0x4A0A, 0x3F09, 0x0614, 0x6D14, 0xEB12, 0x2605, 0x810B, 0x982B, 0xD504, 0xD603,
+		0xD408, 0xF41C, 0x0D16, 0x370B, 0x3713, 0xEE02, 0x9B13, 0xF903, 0x4402, 0xA80B,
+		0xAD19, 0x9A05, 0x030B, 0x8809, 0x0F1A, 0x9836, 0x4D03, 0xAD13, 0xD315, 0xBE17,
+		0x8D27, 0xB318, 0xB40A, 0x402B, 0x7038, 0xFC3A, 0xCD05, 0x620B, 0xD70B, 0x4036,
+		0xB006, 0xBC03, 0x571B, 0x160B, 0x1809, 0xFFFF, 0x4305, 0x9015, 0x0619, 0x7B04,
+		0x3004, 0x3603, 0x3E02, 0xFFFF, 0x7314, 0x2F02, 0x7A1A, 0x7C19, 0x3202, 0xAD04,
+		0xEA06, 0x9B3C, 0x1C28, 0x1E08, 0xF202, 0x2705, 0x3B19, 0x4703, 0xFFFF, 0xFFFF,
+		0x322D, 0xDD0C, 0x4506,
+};
+
+const BotTable botTable = { botDisplace, botEntries, 1024, 4353 };
+
+#endif /* BOT_TABLE */
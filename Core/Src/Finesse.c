@@ -0,0 +1,133 @@
+/*
+ * Finesse.c
+ *
+ *  Created on: Dec 21, 2024
+ *      Author: Will Fraser
+ */
+
+#include "Finesse.h"
+
+static uint16_t Finesse_Box(const GameState *game);
+static void Finesse_Track(FinesseTracker *tracker, const GameState *game);
+static void Finesse_Spawned(FinesseTracker *tracker, const GameState *game);
+
+// Start counting for a new game, on the block it spawned with
+void Finesse_Reset(FinesseTracker *tracker, const GameState *game) {
+	tracker->judged = 0;
+	tracker->faults = 0;
+	tracker->extraPresses = 0;
+	tracker->lastPresses = 0;
+	tracker->lastOptimal = 0;
+	Finesse_Spawned(tracker, game);
+}
+
+// After Engine_Input, a soft drop can lock the block in the input itself
+bool Finesse_Input(FinesseTracker *tracker, const GameState *game, uint8_t input) {
+	bool fault = Finesse_Update(tracker, game);
+
+	switch (input) {
+	case INPUT_MOVE_LEFT:
+	case INPUT_MOVE_RIGHT:
+	case INPUT_ROTATE_LEFT:
+	case INPUT_ROTATE_RIGHT:
+		tracker->presses++;
+		Finesse_Track(tracker, game);
+		break;
+
+	case INPUT_HOLD:
+		// the block from the hold slot or the queue starts over
+		Finesse_Spawned(tracker, game);
+		break;
+
+	default:
+		break;
+	}
+	return fault;
+}
+
+// After Engine_Advance, true when the block just locked took more touches than it needed
+bool Finesse_Update(FinesseTracker *tracker, const GameState *game) {
+	if (Engine_PiecesPlaced(game) == tracker->piece) {
+		return false;
+	}
+
+	// gravity never changes the column or rotation, the block locked where it was last seen
+	bool fault = false;
+	uint32_t path = Finesse_Path(tracker->blockNum, tracker->rotation, tracker->x);
+	if (!tracker->tucked && (FINESSE_PRESSES(path) != FINESSE_UNREACHABLE)) {
+		tracker->judged++;
+		tracker->lastPresses = tracker->presses;
+		tracker->lastOptimal = FINESSE_PRESSES(path);
+		if (tracker->presses > tracker->lastOptimal) {
+			tracker->faults++;
+			tracker->extraPresses += tracker->presses - tracker->lastOptimal;
+			fault = true;
+		}
+	}
+
+	Finesse_Spawned(tracker, game);
+	return fault;
+}
+
+// Shortest sequence from the spawn to a rotation and box column
+uint32_t Finesse_Path(uint8_t blockNum, uint8_t rotation, int8_t x) {
+	int8_t column = x + FINESSE_X_BIAS;
+
+	if ((column < 0) || (column >= FINESSE_COLUMNS)) {
+		return FINESSE_UNREACHABLE;
+	}
+	return finessePaths[blockNum - 1][rotation][column];
+}
+
+// The block's 4x4 box, bit y * 4 + x, parts off the grid are empty
+static uint16_t Finesse_Box(const GameState *game) {
+	uint16_t box = 0;
+
+	for (int8_t y = 0; y < BLOCK_SIZE; y++) {
+		for (int8_t x = 0; x < BLOCK_SIZE; x++) {
+			int8_t gridY = game->currentBlockY + y;
+			int8_t gridX = game->currentBlockX + x;
+			if ((gridY >= 0) && (gridY < GRID_ROWS) && (gridX >= 0) && (gridX < GRID_WIDTH)
+					&& (game->currentBlock[gridY][gridX] != EMPTY_CELL)) {
+				box |= 1 << (y * BLOCK_SIZE + x);
+			}
+		}
+	}
+	return box;
+}
+
+// Where the block is after a move or turn, and whether it could have dropped straight there
+static void Finesse_Track(FinesseTracker *tracker, const GameState *game) {
+	uint16_t box = Finesse_Box(game);
+
+	tracker->x = game->currentBlockX;
+	for (uint8_t r = 0; r < FINESSE_ROTATIONS; r++) {
+		if (finesseBoxes[tracker->blockNum - 1][r] == box) {
+			tracker->rotation = r;
+			break;
+		}
+	}
+
+	// every row from the spawn down to here has to be clear in this column and rotation
+	for (int8_t top = tracker->spawnY; (top < game->currentBlockY) && !tracker->tucked; top++) {
+		for (uint8_t y = 0; y < BLOCK_SIZE; y++) {
+			uint16_t row = (box >> (y * BLOCK_SIZE)) & 0xF;
+			uint16_t cells = (game->currentBlockX < 0) ? row >> -game->currentBlockX
+					: row << game->currentBlockX;
+			if ((top + y < GRID_ROWS) && (cells & game->gridRows[top + y])) {
+				tracker->tucked = true;
+			}
+		}
+	}
+}
+
+// A new block in play, nothing pressed yet
+static void Finesse_Spawned(FinesseTracker *tracker, const GameState *game) {
+	tracker->piece = Engine_PiecesPlaced(game);
+	tracker->blockNum = game->currentBlockNum;
+	tracker->rotation = 0;
+	tracker->x = game->currentBlockX;
+	tracker->spawnY = game->currentBlockY;
+	tracker->presses = 0;
+	tracker->tucked = false;
+}
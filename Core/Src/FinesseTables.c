@@ -0,0 +1,174 @@
+/*
+ * FinesseTables.c
+ *
+ * Generated by Tools/FinesseGen, do not edit.
+ */
+
+#include "Finesse.h"
+
+const uint16_t finesseBoxes[7][FINESSE_ROTATIONS] = {
+		{ 0x00F0, 0x4444, 0x0F00, 0x2222 },
+		{ 0x0660, 0x0660, 0x0660, 0x0660 },
+		{ 0x04C4, 0x4E00, 0x2320, 0x0072 },
+		{ 0x006C, 0x8C40, 0x3600, 0x0231 },
+		{ 0x00C6, 0x4C80, 0x6300, 0x0132 },
+		{ 0x08E0, 0x6440, 0x0710, 0x0226 },
+		{ 0x00E8, 0xC440, 0x1700, 0x0223 },
+};
+
+const uint32_t finessePaths[7][FINESSE_ROTATIONS][FINESSE_COLUMNS] = {
+		{
+				{
+						0x0000000F, 0x0000000F, 0x0000000F, 0x00000004, 0x00000003,
+						0x00000002, 0x00000001, 0x00000000, 0x00000011, 0x00000052,
+						0x00000153, 0x00000554, 0x0000000F, 0x0000000F, 0x0000000F,
+				},
+				{
+						0x0000000F, 0x00002006, 0x00002005, 0x00000804, 0x00000203,
+						0x00000082, 0x00000021, 0x00000031, 0x000000D2, 0x00000353,
+						0x00000D54, 0x00003555, 0x00007556, 0x0000000F, 0x0000000F,
+				},
+				{
+						0x0000000F, 0x0000000F, 0x0000000F, 0x00000004, 0x00000003,
+						0x00000002, 0x00000001, 0x00000000, 0x00000011, 0x00000052,
+						0x00000153, 0x00000554, 0x0000000F, 0x0000000F, 0x0000000F,
+				},
+				{
+						0x0000000F, 0x0000000F, 0x00002006, 0x00002005, 0x00000804,
+						0x00000203, 0x00000082, 0x00000021, 0x00000031, 0x000000D2,
+						0x00000353, 0x00000D54, 0x00003555, 0x00007556, 0x0000000F,
+				},
+		},
+		{
+				{
+						0x0000000F, 0x0000000F, 0x00000005, 0x00000004, 0x00000003,
+						0x00000002, 0x00000001, 0x00000000, 0x00000011, 0x00000052,
+						0x00000153, 0x00000554, 0x00001555, 0x0000000F, 0x0000000F,
+				},
+				{
+						0x0000000F, 0x0000000F, 0x00000005, 0x00000004, 0x00000003,
+						0x00000002, 0x00000001, 0x00000000, 0x00000011, 0x00000052,
+						0x00000153, 0x00000554, 0x00001555, 0x0000000F, 0x0000000F,
+				},
+				{
+						0x0000000F, 0x0000000F, 0x00000005, 0x00000004, 0x00000003,
+						0x00000002, 0x00000001, 0x00000000, 0x00000011, 0x00000052,
+						0x00000153, 0x00000554, 0x00001555, 0x0000000F, 0x0000000F,
+				},
+				{
+						0x0000000F, 0x0000000F, 0x00000005, 0x00000004, 0x00000003,
+						0x00000002, 0x00000001, 0x00000000, 0x00000011, 0x00000052,
+						0x00000153, 0x00000554, 0x00001555, 0x0000000F, 0x0000000F,
+				},
+		},
+		{
+				{
+						0x0000000F, 0x00000006, 0x00000005, 0x00000004, 0x00000003,
+						0x00000002, 0x00000001, 0x00000000, 0x00000011, 0x00000052,
+						0x00000153, 0x00000554, 0x0000000F, 0x0000000F, 0x0000000F,
+				},
+				{
+						0x0000000F, 0x0000000F, 0x0000C006, 0x00003005, 0x00000C04,
+						0x00000303, 0x000000C2, 0x00000031, 0x000000D2, 0x00000353,
+						0x00000D54, 0x00003555, 0x0000000F, 0x0000000F, 0x0000000F,
+				},
+				{
+						0x0000000F, 0x0000000F, 0x0000000F, 0x0000A006, 0x00002805,
+						0x00000A04, 0x00000283, 0x000000A2, 0x00000293, 0x00000A54,
+						0x00002955, 0x0000A556, 0x00026557, 0x00066558, 0x0000000F,
+				},
+				{
+						0x0000000F, 0x0000000F, 0x0000000F, 0x00002005, 0x00000804,
+						0x00000203, 0x00000082, 0x00000021, 0x00000092, 0x00000253,
+						0x00000954, 0x00002555, 0x00006556, 0x0000000F, 0x0000000F,
+				},
+		},
+		{
+				{
+						0x0000000F, 0x0000000F, 0x00000005, 0x00000004, 0x00000003,
+						0x00000002, 0x00000001, 0x00000000, 0x00000011, 0x00000052,
+						0x00000153, 0x00000554, 0x0000000F, 0x0000000F, 0x0000000F,
+				},
+				{
+						0x0000000F, 0x00002005, 0x00000804, 0x00000203, 0x00000082,
+						0x00000021, 0x000000C2, 0x00000031, 0x000000D2, 0x00000353,
+						0x00000D54, 0x00003555, 0x0000000F, 0x0000000F, 0x0000000F,
+				},
+				{
+						0x0000000F, 0x0000000F, 0x0000000F, 0x00000005, 0x00000004,
+						0x00000003, 0x00000002, 0x00000001, 0x00000000, 0x00000011,
+						0x00000052, 0x00000153, 0x00000554, 0x0000000F, 0x0000000F,
+				},
+				{
+						0x0000000F, 0x0000000F, 0x0000000F, 0x00002005, 0x00000804,
+						0x00000203, 0x00000082, 0x00000021, 0x00000092, 0x00000031,
+						0x000000D2, 0x00000353, 0x00000D54, 0x00003555, 0x0000000F,
+				},
+		},
+		{
+				{
+						0x0000000F, 0x0000000F, 0x00000005, 0x00000004, 0x00000003,
+						0x00000002, 0x00000001, 0x00000000, 0x00000011, 0x00000052,
+						0x00000153, 0x00000554, 0x0000000F, 0x0000000F, 0x0000000F,
+				},
+				{
+						0x0000000F, 0x00002005, 0x00000804, 0x00000203, 0x00000082,
+						0x00000021, 0x000000C2, 0x00000031, 0x000000D2, 0x00000353,
+						0x00000D54, 0x00003555, 0x0000000F, 0x0000000F, 0x0000000F,
+				},
+				{
+						0x0000000F, 0x0000000F, 0x0000000F, 0x00000005, 0x00000004,
+						0x00000003, 0x00000002, 0x00000001, 0x00000000, 0x00000011,
+						0x00000052, 0x00000153, 0x00000554, 0x0000000F, 0x0000000F,
+				},
+				{
+						0x0000000F, 0x0000000F, 0x0000000F, 0x00002005, 0x00000804,
+						0x00000203, 0x00000082, 0x00000021, 0x00000092, 0x00000031,
+						0x000000D2, 0x00000353, 0x00000D54, 0x00003555, 0x0000000F,
+				},
+		},
+		{
+				{
+						0x0000000F, 0x0000000F, 0x00000005, 0x00000004, 0x00000003,
+						0x00000002, 0x00000001, 0x00000000, 0x00000011, 0x00000052,
+						0x00000153, 0x00000554, 0x0000000F, 0x0000000F, 0x0000000F,
+				},
+				{
+						0x0000000F, 0x0000000F, 0x0000C006, 0x00003005, 0x00000C04,
+						0x00000303, 0x000000C2, 0x00000031, 0x000000D2, 0x00000353,
+						0x00000D54, 0x00003555, 0x00007556, 0x0000000F, 0x0000000F,
+				},
+				{
+						0x0000000F, 0x0000000F, 0x0000000F, 0x0000A006, 0x00002805,
+						0x00000A04, 0x00000283, 0x000000A2, 0x00000293, 0x00000A54,
+						0x00002955, 0x0000A556, 0x00026557, 0x0000000F, 0x0000000F,
+				},
+				{
+						0x0000000F, 0x0000000F, 0x00008006, 0x00002005, 0x00000804,
+						0x00000203, 0x00000082, 0x00000021, 0x00000092, 0x00000253,
+						0x00000954, 0x00002555, 0x00006556, 0x0000000F, 0x0000000F,
+				},
+		},
+		{
+				{
+						0x0000000F, 0x0000000F, 0x00000005, 0x00000004, 0x00000003,
+						0x00000002, 0x00000001, 0x00000000, 0x00000011, 0x00000052,
+						0x00000153, 0x00000554, 0x0000000F, 0x0000000F, 0x0000000F,
+				},
+				{
+						0x0000000F, 0x0000C007, 0x0000C006, 0x00003005, 0x00000C04,
+						0x00000303, 0x000000C2, 0x00000031, 0x000000D2, 0x00000353,
+						0x00000D54, 0x00003555, 0x0000000F, 0x0000000F, 0x0000000F,
+				},
+				{
+						0x0000000F, 0x0000000F, 0x0000000F, 0x0000A006, 0x00002805,
+						0x00000A04, 0x00000283, 0x000000A2, 0x00000293, 0x00000A54,
+						0x00002955, 0x0000A556, 0x00026557, 0x0000000F, 0x0000000F,
+				},
+				{
+						0x0000000F, 0x0000000F, 0x0000000F, 0x00002005, 0x00000804,
+						0x00000203, 0x00000082, 0x00000021, 0x00000092, 0x00000253,
+						0x00000954, 0x00002555, 0x00006556, 0x00016557, 0x0000000F,
+				},
+		},
+};
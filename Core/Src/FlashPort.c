@@ -0,0 +1,45 @@
+/*
+ * FlashPort.c
+ *
+ *  Created on: Dec 10, 2024
+ *      Author: Will Fraser
+ */
+
+#include "FlashPort.h"
+
+static const uint32_t sectorNumbers[STORE_SECTORS] = { STORE_SECTOR_A, STORE_SECTOR_B };
+static const uint32_t sectorAddresses[STORE_SECTORS] = { STORE_SECTOR_A_ADDR,
+		STORE_SECTOR_B_ADDR };
+
+// Code runs from bank 1, so erasing bank 2 does not stall instruction fetches
+static bool FlashPort_Erase(uint8_t sector) {
+	FLASH_EraseInitTypeDef eraseConfig = { 0 };
+	uint32_t sectorError = 0;
+
+	eraseConfig.TypeErase = FLASH_TYPEERASE_SECTORS;
+	eraseConfig.Sector = sectorNumbers[sector];
+	eraseConfig.NbSectors = 1;
+	eraseConfig.VoltageRange = FLASH_VOLTAGE_RANGE_3;
+
+	HAL_FLASH_Unlock();
+	HAL_StatusTypeDef status = HAL_FLASHEx_Erase(&eraseConfig, &sectorError);
+	HAL_FLASH_Lock();
+
+	return status == HAL_OK;
+}
+
+static bool FlashPort_Program(uint8_t sector, uint32_t offset, uint32_t word) {
+	HAL_FLASH_Unlock();
+	HAL_StatusTypeDef status = HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD,
+			sectorAddresses[sector] + offset, word);
+	HAL_FLASH_Lock();
+
+	return status == HAL_OK;
+}
+
+const FlashPort scoreFlash = {
+	.sector = { (const uint8_t*) STORE_SECTOR_A_ADDR, (const uint8_t*) STORE_SECTOR_B_ADDR },
+	.sectorSize = STORE_SECTOR_SIZE,
+	.erase = FlashPort_Erase,
+	.program = FlashPort_Program
+};
@@ -0,0 +1,818 @@
+/*
+ * GameEngine.c
+ *
+ *  Created on: Dec 8, 2024
+ *      Author: Will Fraser
+ */
+
+#include <string.h>
+
+#include "GameEngine.h"
+
+// define standard tetris blocks
+const TetrisBlock tetrisBlocks[7] = {
+		{ { { 0, 0, 0, 0 }, { 1, 1, 1, 1 }, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } } }, // I Block
+		{ { { 0, 0, 0, 0 }, { 0, 1, 1, 0 }, { 0, 1, 1, 0 }, { 0, 0, 0, 0 } } }, // O Block
+		{ { { 0, 0, 1, 0 }, { 0, 0, 1, 1 }, { 0, 0, 1, 0 }, { 0, 0, 0, 0 } } }, // T Block
+		{ { { 0, 0, 1, 1 }, { 0, 1, 1, 0 }, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } } }, // S Block
+		{ { { 0, 1, 1, 0 }, { 0, 0, 1, 1 }, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } } }, // Z Block
+		{ { { 0, 0, 0, 0 }, { 0, 1, 1, 1 }, { 0, 0, 0, 1 }, { 0, 0, 0, 0 } } }, // J Block
+		{ { { 0, 0, 0, 1 }, { 0, 1, 1, 1 }, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } } }  // L Block
+};
+
+/*
+ * Zobrist keys, one per column and block number, come from splitmix64 of their index
+ * so there is no table to keep. A row's hash is the XOR of the keys of its cells and
+ * does not depend on where the row is, the board hash is the XOR of every non-empty
+ * row's hash mixed with the row number. Placing a block only changes the rows it
+ * locks in, a clear moves the rows above the lowest full one, so the hash follows
+ * both in a few mixes instead of a pass over the grid.
+ */
+#define ZOBRIST_CELL(x, color) Zobrist_Mix((x) * 8u + (color))
+#define ZOBRIST_ROW(y)         ((uint64_t) ((y) + 1) * 0xD6E8FEB86659FD93ull)
+#define ZOBRIST_PIECE          (1ull << 60)	// salts of the position hash, above its fields
+#define ZOBRIST_HOLD           (2ull << 60)
+#define ZOBRIST_QUEUE          (3ull << 60)
+
+// Engine rows that are shown, a block locked with none of its cells in them is a lock out
+#define VISIBLE_ROWS (((1u << GRID_ROWS) - 1) ^ ((1u << GRID_HIDDEN_ROWS) - 1))
+
+// Shape row masks at SPAWN_X per block, bit x = column x, the rows of tetrisBlocks
+#define SPAWN_ROW(a, b, c, d) (((a) | (b) << 1 | (c) << 2 | (d) << 3) << SPAWN_X)
+
+static const uint16_t spawnMasks[7][BLOCK_SIZE] = {
+		{ SPAWN_ROW(0, 0, 0, 0), SPAWN_ROW(1, 1, 1, 1),
+				SPAWN_ROW(0, 0, 0, 0), SPAWN_ROW(0, 0, 0, 0) },	// I Block
+		{ SPAWN_ROW(0, 0, 0, 0), SPAWN_ROW(0, 1, 1, 0),
+				SPAWN_ROW(0, 1, 1, 0), SPAWN_ROW(0, 0, 0, 0) },	// O Block
+		{ SPAWN_ROW(0, 0, 1, 0), SPAWN_ROW(0, 0, 1, 1),
+				SPAWN_ROW(0, 0, 1, 0), SPAWN_ROW(0, 0, 0, 0) },	// T Block
+		{ SPAWN_ROW(0, 0, 1, 1), SPAWN_ROW(0, 1, 1, 0),
+				SPAWN_ROW(0, 0, 0, 0), SPAWN_ROW(0, 0, 0, 0) },	// S Block
+		{ SPAWN_ROW(0, 1, 1, 0), SPAWN_ROW(0, 0, 1, 1),
+				SPAWN_ROW(0, 0, 0, 0), SPAWN_ROW(0, 0, 0, 0) },	// Z Block
+		{ SPAWN_ROW(0, 0, 0, 0), SPAWN_ROW(0, 1, 1, 1),
+				SPAWN_ROW(0, 0, 0, 1), SPAWN_ROW(0, 0, 0, 0) },	// J Block
+		{ SPAWN_ROW(0, 0, 0, 1), SPAWN_ROW(0, 1, 1, 1),
+				SPAWN_ROW(0, 0, 0, 0), SPAWN_ROW(0, 0, 0, 0) }	// L Block
+};
+
+static void PreparePiece(const GameState *game, QueuedPiece *piece, uint8_t blockNum);
+static void SpawnPiece(GameState *game, const QueuedPiece *piece);
+static void CheckSpawn(const GameState *game, QueuedPiece *piece);
+static void RefreshSpawnChecks(GameState *game);
+static void AddFeatureCell(BoardFeatures *features, uint8_t x, uint8_t y);
+static void DropFeatureRows(GameState *game, uint32_t fullRows, uint8_t count);
+static uint64_t Zobrist_Mix(uint64_t x);
+static uint64_t Zobrist_Row(uint8_t y, uint64_t rowHash);
+
+// Start a new game, the same seed and inputs always give the same game
+void Engine_NewGame(GameState *game, uint32_t seed) {
+	InitGameGrid(game);
+	Bag_InitSeeded(&game->pieceBag, seed);
+
+	// fill the preview queue before the first spawn
+	for (uint8_t i = 0; i < PREVIEW_COUNT; i++) {
+		PreparePiece(game, &game->nextQueue[i], Bag_Next(&game->pieceBag));
+	}
+	game->nextHead = 0;
+	game->holdBlock = NO_BLOCK;
+	game->holdUsed = false;
+
+	for (uint8_t i = 0; i < 4; i++) {
+		game->score[i] = 0;
+	}
+	game->piecesPlaced = 0;
+
+	game->engineTime = 0;
+	game->endTime = 0;
+	game->nextGravity = FRAMERATE;
+	game->softDrop = false;
+	game->gameOver = false;
+
+	GenerateBlock(game, RANDOM_BLOCK);
+	game->changes = ENGINE_CHANGED_GRID | ENGINE_CHANGED_QUEUE;
+	game->clearedRows = 0;
+}
+
+// Run every gravity step that is due up to now
+void Engine_Advance(GameState *game, uint32_t now) {
+	while (!game->gameOver && ((int32_t) (now - game->nextGravity) >= 0)) {
+		game->engineTime = game->nextGravity;
+
+		if (MoveCurrentBlock(game, MOVE_DOWN)) {
+			// If move down returns true, place block
+			PlaceCurrentBlock(game);
+			if (!game->gameOver) {
+				GenerateBlock(game, RANDOM_BLOCK);
+			}
+		}
+		game->changes |= ENGINE_CHANGED_GRID;
+
+		game->nextGravity = game->engineTime + (game->softDrop ? SOFT_DROP_INTERVAL : FRAMERATE);
+	}
+}
+
+// Apply one player input, gravity due before it is run first
+void Engine_Input(GameState *game, uint8_t input, uint32_t now) {
+	Engine_Advance(game, now);
+	if (game->gameOver) {
+		return;
+	}
+	game->engineTime = now;
+
+	switch (input) {
+	case INPUT_MOVE_LEFT:
+		if (MoveCurrentBlock(game, MOVE_LEFT)) {
+			PlaceCurrentBlock(game);
+			if (!game->gameOver) {
+				GenerateBlock(game, RANDOM_BLOCK);
+			}
+		}
+		break;
+
+	case INPUT_MOVE_RIGHT:
+		if (MoveCurrentBlock(game, MOVE_RIGHT)) {
+			PlaceCurrentBlock(game);
+			if (!game->gameOver) {
+				GenerateBlock(game, RANDOM_BLOCK);
+			}
+		}
+		break;
+
+	case INPUT_ROTATE_LEFT:
+		RotateCurrentBlock(game, ROTATE_LEFT);
+		break;
+
+	case INPUT_ROTATE_RIGHT:
+		RotateCurrentBlock(game, ROTATE_RIGHT);
+		break;
+
+	case INPUT_HOLD:
+		HoldCurrentBlock(game);
+		break;
+
+	case INPUT_DROP_PRESS:
+		// drop one row straight away, then keep dropping at the soft drop rate
+		game->softDrop = true;
+		game->nextGravity = now;
+		Engine_Advance(game, now);
+		break;
+
+	case INPUT_DROP_RELEASE:
+		game->softDrop = false;
+		game->nextGravity = now + FRAMERATE;
+		break;
+
+	default:
+		return;
+	}
+
+	game->changes |= ENGINE_CHANGED_GRID;
+}
+
+bool Engine_IsOver(const GameState *game) {
+	return game->gameOver;
+}
+
+// Length of the game so far, or of the whole game once it is over
+uint32_t Engine_Elapsed(const GameState *game) {
+	return game->gameOver ? game->endTime : game->engineTime;
+}
+
+// Returns and clears the ENGINE_CHANGED_* flags so the caller only redraws what changed
+uint8_t Engine_TakeChanges(GameState *game) {
+	uint8_t taken = game->changes;
+	game->changes = 0;
+	return taken;
+}
+
+/*
+ * Visible rows removed since the last call, numbered as they were before the clear,
+ * so a renderer can slide the rows above down instead of repainting. Rows cleared in
+ * the hidden rows move nothing on screen and are left out. Two clears without a call
+ * in between give ENGINE_CLEARS_UNKNOWN.
+ */
+uint16_t Engine_TakeClearedRows(GameState *game) {
+	uint32_t taken = game->clearedRows;
+	game->clearedRows = 0;
+	return (taken == ENGINE_CLEARS_UNKNOWN) ? ENGINE_CLEARS_UNKNOWN : taken >> GRID_HIDDEN_ROWS;
+}
+
+// Block number shown at a visible cell, placed blocks first then the falling block
+uint8_t Engine_CellAt(const GameState *game, uint8_t x, uint8_t y) {
+	y += GRID_HIDDEN_ROWS;
+	if (game->gameGrid[y][x] != EMPTY_CELL) {
+		return game->gameGrid[y][x];
+	}
+	return game->currentBlock[y][x];
+}
+
+uint8_t Engine_PeekNext(const GameState *game, uint8_t index) {
+	return game->nextQueue[(game->nextHead + index) % PREVIEW_COUNT].blockNum;
+}
+
+uint8_t Engine_GetHold(const GameState *game) {
+	return game->holdBlock;
+}
+
+// Rows the falling block can still drop before it lands, only used to draw the ghost
+uint8_t Engine_GhostDrop(const GameState *game) {
+	uint16_t pieceRows[BLOCK_SIZE] = { 0 };
+	uint16_t anyRows = 0;
+	uint8_t drop = 0;
+
+	if (game->gameOver) {
+		return 0;
+	}
+
+	// falling block as row masks, rows of the box off the grid stay empty
+	for (int8_t y = 0; y < BLOCK_SIZE; y++) {
+		int8_t gridY = game->currentBlockY + y;
+		if ((gridY < 0) || (gridY >= GRID_ROWS)) {
+			continue;
+		}
+		for (uint8_t x = 0; x < GRID_WIDTH; x++) {
+			if (game->currentBlock[gridY][x] != EMPTY_CELL) {
+				pieceRows[y] |= 1 << x;
+			}
+		}
+		anyRows |= pieceRows[y];
+	}
+	if (anyRows == 0) {
+		return 0;
+	}
+
+	for (;;) {
+		for (int8_t y = 0; y < BLOCK_SIZE; y++) {
+			int8_t below = game->currentBlockY + y + drop + 1;
+			if ((pieceRows[y] != 0)
+					&& ((below >= GRID_ROWS) || (game->gridRows[below] & pieceRows[y]))) {
+				return drop;
+			}
+		}
+		drop++;
+	}
+}
+
+// Block number of the ghost at an empty visible cell, given the drop from Engine_GhostDrop
+uint8_t Engine_GhostAt(const GameState *game, uint8_t x, uint8_t y, uint8_t drop) {
+	y += GRID_HIDDEN_ROWS;
+	if ((drop == 0) || (y < drop) || (game->gameGrid[y][x] != EMPTY_CELL)
+			|| (game->currentBlock[y][x] != EMPTY_CELL)) {
+		return EMPTY_CELL;
+	}
+	return game->currentBlock[y - drop][x];
+}
+
+const uint16_t* Engine_GetScore(const GameState *game) {
+	return game->score;
+}
+
+// Pieces locked so far, for the pieces per second on the HUD
+uint32_t Engine_PiecesPlaced(const GameState *game) {
+	return game->piecesPlaced;
+}
+
+// Column heights, row fill, holes and stack height, maintained by the engine
+const BoardFeatures* Engine_GetFeatures(const GameState *game) {
+	return &game->features;
+}
+
+// FNV-1a over the placed blocks and score, used to check replays
+uint32_t Engine_BoardHash(const GameState *game) {
+	uint32_t hash = 2166136261u;
+
+	for (uint16_t y = 0; y < GRID_ROWS; y++) {
+		for (uint16_t x = 0; x < GRID_WIDTH; x++) {
+			hash = (hash ^ game->gameGrid[y][x]) * 16777619u;
+		}
+	}
+	for (uint8_t i = 0; i < 4; i++) {
+		hash = (hash ^ game->score[i]) * 16777619u;
+	}
+
+	return hash;
+}
+
+// Zobrist hash of the placed blocks and their colours, kept up to date as they lock and clear
+uint64_t Engine_Zobrist(const GameState *game) {
+	return game->zobrist;
+}
+
+// Engine_Zobrist with the falling block, hold slot and queue, for transposition tables
+uint64_t Engine_PositionHash(const GameState *game) {
+	uint64_t hash = game->zobrist;
+
+	hash ^= Zobrist_Mix(ZOBRIST_PIECE ^ game->currentBlockNum
+			^ (uint64_t) (uint8_t) game->currentBlockX << 8
+			^ (uint64_t) game->currentBlockY << 16 ^ (uint64_t) Engine_CurrentBox(game) << 24);
+	hash ^= Zobrist_Mix(ZOBRIST_HOLD ^ game->holdBlock ^ game->holdUsed << 4);
+	for (uint8_t i = 0; i < PREVIEW_COUNT; i++) {
+		hash ^= Zobrist_Mix(ZOBRIST_QUEUE + i * 8u + Engine_PeekNext(game, i));
+	}
+	return hash;
+}
+
+// The falling block's 4x4 box, bit y * 4 + x, parts off the grid are empty
+uint16_t Engine_CurrentBox(const GameState *game) {
+	uint16_t box = 0;
+
+	for (int8_t y = 0; y < BLOCK_SIZE; y++) {
+		for (int8_t x = 0; x < BLOCK_SIZE; x++) {
+			int8_t gridY = game->currentBlockY + y;
+			int8_t gridX = game->currentBlockX + x;
+			if ((gridY >= 0) && (gridY < GRID_ROWS) && (gridX >= 0) && (gridX < GRID_WIDTH)
+					&& (game->currentBlock[gridY][gridX] != EMPTY_CELL)) {
+				box |= 1 << (y * BLOCK_SIZE + x);
+			}
+		}
+	}
+	return box;
+}
+
+/*
+ * Everything the engine keeps about gameGrid worked out again from it: row masks,
+ * stack features, Zobrist hashes and the spawn checks of the queue. For a game put
+ * back together from a snapshot, whose grid and queue were written directly.
+ */
+void Engine_Rebuild(GameState *game) {
+	memset(&game->features, 0, sizeof(game->features));
+	game->zobrist = 0;
+
+	// bottom row first so columns grow upwards, as they do when blocks lock
+	for (int8_t y = GRID_ROWS - 1; y >= 0; y--) {
+		game->gridRows[y] = 0;
+		game->rowHashes[y] = 0;
+		for (uint8_t x = 0; x < GRID_WIDTH; x++) {
+			uint8_t color = game->gameGrid[y][x];
+			if (color != EMPTY_CELL) {
+				game->gridRows[y] |= 1 << x;
+				game->rowHashes[y] ^= ZOBRIST_CELL(x, color);
+				AddFeatureCell(&game->features, x, y);
+			}
+		}
+		game->zobrist ^= Zobrist_Row(y, game->rowHashes[y]);
+	}
+	for (uint8_t i = 0; i < PREVIEW_COUNT; i++) {
+		PreparePiece(game, &game->nextQueue[i], game->nextQueue[i].blockNum);
+	}
+}
+
+void InitGameGrid(GameState *game) {
+	for (uint16_t y = 0; y < GRID_ROWS; y++) {
+		for (uint16_t x = 0; x < GRID_WIDTH; x++) {
+			game->gameGrid[y][x] = EMPTY_CELL; // initialize all cells as empty
+			game->currentBlock[y][x] = EMPTY_CELL;
+		}
+		game->gridRows[y] = 0;
+		game->rowHashes[y] = 0;
+	}
+	memset(&game->features, 0, sizeof(game->features));
+	game->zobrist = 0;
+}
+
+// Create block in currentBlock array
+void GenerateBlock(GameState *game, uint8_t blockNum) {
+	// fixed blocks are only used by the menu, prepare them on the spot
+	if (blockNum != RANDOM_BLOCK) {
+		QueuedPiece piece;
+		PreparePiece(game, &piece, blockNum);
+		SpawnPiece(game, &piece);
+		return;
+	}
+
+	// take the precomputed head of the queue first, the rest is off the critical path
+	SpawnPiece(game, &game->nextQueue[game->nextHead]);
+
+	// replace it with a new piece at the back of the queue
+	PreparePiece(game, &game->nextQueue[game->nextHead], Bag_Next(&game->pieceBag));
+	game->nextHead = (game->nextHead + 1) % PREVIEW_COUNT;
+
+	game->changes |= ENGINE_CHANGED_QUEUE;
+}
+
+// Swap the falling block with the hold slot, once per placed block
+void HoldCurrentBlock(GameState *game) {
+	if (game->holdUsed) {
+		return;
+	}
+
+	// remove the falling block
+	for (uint16_t y = 0; y < GRID_ROWS; y++) {
+		for (uint16_t x = 0; x < GRID_WIDTH; x++) {
+			game->currentBlock[y][x] = EMPTY_CELL;
+		}
+	}
+
+	uint8_t heldBlock = game->holdBlock;
+	game->holdBlock = game->currentBlockNum;
+
+	if (heldBlock == NO_BLOCK) {
+		GenerateBlock(game, RANDOM_BLOCK);
+	} else {
+		QueuedPiece piece;
+		PreparePiece(game, &piece, heldBlock);
+		SpawnPiece(game, &piece);
+	}
+
+	game->holdUsed = true;
+	game->changes |= ENGINE_CHANGED_QUEUE;
+}
+
+// Fill in a queue entry with its spawn masks and spawn collision against the current stack
+static void PreparePiece(const GameState *game, QueuedPiece *piece, uint8_t blockNum) {
+	piece->blockNum = blockNum;
+	for (uint8_t y = 0; y < BLOCK_SIZE; y++) {
+		piece->spawnRows[y] = spawnMasks[blockNum - 1][y];
+	}
+	CheckSpawn(game, piece);
+}
+
+// The spawn rows against the top of the stack, at the spawn row and one row down
+static void CheckSpawn(const GameState *game, QueuedPiece *piece) {
+	piece->spawnBlocked = false;
+	piece->dropBlocked = false;
+	for (uint8_t y = 0; y < BLOCK_SIZE; y++) {
+		if (piece->spawnRows[y] & game->gridRows[y]) {
+			piece->spawnBlocked = true;
+		}
+		if (piece->spawnRows[y] & game->gridRows[y + 1]) {
+			piece->dropBlocked = true;
+		}
+	}
+}
+
+// Stack only changes when a block is placed, so the queue is rechecked there
+static void RefreshSpawnChecks(GameState *game) {
+	for (uint8_t i = 0; i < PREVIEW_COUNT; i++) {
+		CheckSpawn(game, &game->nextQueue[i]);
+	}
+}
+
+/*
+ * Copy a prepared piece into currentBlock at the top of the hidden rows and let
+ * it drop one row into view straight away unless the stack is in the way. A piece
+ * that overlaps the stack where it spawns is a block out and ends the game.
+ */
+static void SpawnPiece(GameState *game, const QueuedPiece *piece) {
+	if (piece->spawnBlocked) {
+		game->gameOver = true;
+		game->endTime = game->engineTime;
+		return;
+	}
+
+	// set block starting position
+	uint8_t top = piece->dropBlocked ? 0 : 1;
+	game->currentBlockNum = piece->blockNum;
+	game->currentBlockY = top;
+	game->currentBlockX = SPAWN_X;
+
+	// copy block data
+	for (uint8_t y = 0; y < BLOCK_SIZE; y++) {
+		for (uint8_t x = SPAWN_X; x < SPAWN_X + BLOCK_SIZE; x++) {
+			if (piece->spawnRows[y] & (1 << x)) {
+				game->currentBlock[top + y][x] = piece->blockNum;
+			}
+		}
+	}
+}
+
+bool MoveCurrentBlock(GameState *game, uint8_t direction) {
+	uint8_t tempBlock[GRID_ROWS][GRID_WIDTH] = { 0 }; // temp buffer to store the shifted block
+
+	switch (direction) {
+	case MOVE_DOWN:
+		for (uint16_t y = GRID_ROWS - 1; y > 0; y--) {
+			for (uint16_t x = 0; x < GRID_WIDTH; x++) {
+				if ((game->currentBlock[y - 1][x] != EMPTY_CELL)
+						&& (game->gameGrid[y][x] != EMPTY_CELL)) {
+					return true;
+				} else if ((game->currentBlock[y][x] != EMPTY_CELL)
+						&& (y == GRID_ROWS - 1)) {
+					return true;
+				}
+				// check if block can be moved and shift tempBlock
+				tempBlock[y][x] = game->currentBlock[y - 1][x];
+			}
+		}
+		game->currentBlockY++;
+		break;
+
+	case MOVE_UP:
+		for (uint16_t y = 0; y < GRID_ROWS - 1; y++) {
+			for (uint16_t x = 0; x < GRID_WIDTH; x++) {
+				if ((game->currentBlock[y + 1][x] != EMPTY_CELL)
+						&& (game->gameGrid[y][x] != EMPTY_CELL)) {
+					return true;
+				}
+				// check if block can be moved and shift tempBlock
+				tempBlock[y][x] = game->currentBlock[y + 1][x];
+
+			}
+		}
+		game->currentBlockY--;
+		break;
+
+	case MOVE_LEFT:
+		for (uint16_t y = 0; y < GRID_ROWS; y++) {
+			for (uint16_t x = 0; x < GRID_WIDTH - 1; x++) {
+				if ((game->currentBlock[y][x] != EMPTY_CELL) && (x == 0)) {
+					return false;
+				} else if ((game->currentBlock[y][x + 1] != EMPTY_CELL)
+						&& (game->gameGrid[y][x] != EMPTY_CELL)) {
+					return false;
+				}
+				// check if block can be rotated and shift tempBlock
+				tempBlock[y][x] = game->currentBlock[y][x + 1];
+
+			}
+		}
+		game->currentBlockX--;
+		break;
+
+	case MOVE_RIGHT:
+		for (uint16_t y = 0; y < GRID_ROWS; y++) {
+			for (uint16_t x = GRID_WIDTH - 1; x > 0; x--) {
+				if ((game->currentBlock[y][x] != EMPTY_CELL)
+						&& (x == GRID_WIDTH - 1)) {
+					return false;
+				} else if ((game->currentBlock[y][x - 1] != EMPTY_CELL)
+						&& (game->gameGrid[y][x] != EMPTY_CELL)) {
+					return false;
+				}
+				// check if block can be rotated and shift tempBlock
+				tempBlock[y][x] = game->currentBlock[y][x - 1];
+
+			}
+		}
+		game->currentBlockX++;
+		break;
+
+	default:
+		return false;
+	}
+
+	// Copy tempBlock back into currentBlock
+	for (uint16_t y = 0; y < GRID_ROWS; y++) {
+		for (uint16_t x = 0; x < GRID_WIDTH; x++) {
+			game->currentBlock[y][x] = tempBlock[y][x];
+		}
+	}
+
+	return false; // move successful
+}
+
+// Returns true if the rotation did not fit and the block was left as it was
+bool RotateCurrentBlock(GameState *game, uint8_t direction) {
+	// temp storage for the 4x4 block
+	uint8_t temp[BLOCK_SIZE][BLOCK_SIZE] = { 0 };
+
+	// extract the 4x4 section, parts of the box off the grid are always empty
+	for (int8_t y = 0; y < BLOCK_SIZE; y++) {
+		for (int8_t x = 0; x < BLOCK_SIZE; x++) {
+			int8_t gridY = game->currentBlockY + y;
+			int8_t gridX = game->currentBlockX + x;
+			if ((gridY >= 0) && (gridY < GRID_ROWS) && (gridX >= 0)
+					&& (gridX < GRID_WIDTH)) {
+				temp[y][x] = game->currentBlock[gridY][gridX];
+			}
+		}
+	}
+
+	//rotate into a new temporary array
+	uint8_t rotated[BLOCK_SIZE][BLOCK_SIZE] = { 0 };
+
+	if (direction == ROTATE_RIGHT) {
+		// rotate right: new[x][3 - y] = old[y][x]
+		for (uint8_t y = 0; y < BLOCK_SIZE; y++) {
+			for (uint8_t x = 0; x < BLOCK_SIZE; x++) {
+				rotated[x][BLOCK_SIZE - 1 - y] = temp[y][x];
+			}
+		}
+	} else {
+		// rotate left: new[3 - x][y] = old[y][x]
+		for (uint8_t y = 0; y < BLOCK_SIZE; y++) {
+			for (uint8_t x = 0; x < BLOCK_SIZE; x++) {
+				rotated[BLOCK_SIZE - 1 - x][y] = temp[y][x];
+			}
+		}
+	}
+
+	// check if rotated block fits on the grid and clear of the stack
+	for (int8_t y = 0; y < BLOCK_SIZE; y++) {
+		for (int8_t x = 0; x < BLOCK_SIZE; x++) {
+			if (rotated[y][x] == EMPTY_CELL) {
+				continue;
+			}
+			int8_t gridY = game->currentBlockY + y;
+			int8_t gridX = game->currentBlockX + x;
+			if ((gridY < 0) || (gridY >= GRID_ROWS) || (gridX < 0)
+					|| (gridX >= GRID_WIDTH)
+					|| (game->gameGrid[gridY][gridX] != EMPTY_CELL)) {
+				return true;
+			}
+		}
+	}
+
+	// if valid, copy rotated shape back into currentBlock
+	for (int8_t y = 0; y < BLOCK_SIZE; y++) {
+		for (int8_t x = 0; x < BLOCK_SIZE; x++) {
+			int8_t gridY = game->currentBlockY + y;
+			int8_t gridX = game->currentBlockX + x;
+			if ((gridY >= 0) && (gridY < GRID_ROWS) && (gridX >= 0)
+					&& (gridX < GRID_WIDTH)) {
+				game->currentBlock[gridY][gridX] = rotated[y][x];
+			}
+		}
+	}
+
+	return false;
+}
+
+void PlaceCurrentBlock(GameState *game) {
+	uint32_t blockRows = 0;		// rows the block locked in, bit y = row y
+
+	// the block only has cells inside its 4x4 box, bottom row first so columns grow upwards
+	for (int8_t y = BLOCK_SIZE - 1; y >= 0; y--) {
+		int8_t gridY = game->currentBlockY + y;
+		if ((gridY < 0) || (gridY >= GRID_ROWS)) {
+			continue;
+		}
+		for (int8_t x = 0; x < BLOCK_SIZE; x++) {
+			int8_t gridX = game->currentBlockX + x;
+			if ((gridX < 0) || (gridX >= GRID_WIDTH)
+					|| (game->currentBlock[gridY][gridX] == EMPTY_CELL)) {
+				continue;
+			}
+			if (!(blockRows & (1u << gridY))) {
+				game->zobrist ^= Zobrist_Row(gridY, game->rowHashes[gridY]);	// old row out
+			}
+			game->gameGrid[gridY][gridX] = game->currentBlock[gridY][gridX]; // copy currentBlock to gameGrid
+			game->gridRows[gridY] |= 1 << gridX;
+			game->rowHashes[gridY] ^= ZOBRIST_CELL(gridX, game->gameGrid[gridY][gridX]);
+			game->currentBlock[gridY][gridX] = EMPTY_CELL;				// erase currentBlock
+			AddFeatureCell(&game->features, gridX, gridY);
+			blockRows |= 1u << gridY;
+		}
+	}
+	for (uint32_t rows = blockRows; rows != 0; rows &= rows - 1) {
+		uint8_t y = __builtin_ctz(rows);
+		game->zobrist ^= Zobrist_Row(y, game->rowHashes[y]);			// new row in
+	}
+	game->piecesPlaced++;
+
+	// update score and clear lines
+	uint8_t linesCleared = ClearCompleteLines(game);
+
+	// update score based on lines cleared
+	switch (linesCleared) {
+	case 0:
+		game->score[0] += 0; // add 0 to score as a consolation prize
+		break;
+	case 1:
+		game->score[0]++;
+		break;
+	case 2:
+		game->score[1]++;
+		break;
+	case 3:
+		game->score[2]++;
+		break;
+	case 4:
+		game->score[3]++;
+		break;
+	default:
+		game->score[3]++;
+	}
+
+	// reset soft drop to prevent next block from being dropped
+	game->softDrop = false;
+	game->holdUsed = false;
+
+	RefreshSpawnChecks(game);
+
+	CheckGameEnd(game, blockRows);
+}
+
+uint8_t ClearCompleteLines(GameState *game) {
+	BoardFeatures *features = &game->features;
+	uint8_t top = GRID_ROWS - features->stackHeight;	// rows above the stack are empty
+	uint8_t linesCleared = 0;
+	uint32_t fullRows = 0;
+
+	// note which rows go before anything moves
+	for (uint8_t y = top; y < GRID_ROWS; y++) {
+		if (features->rowFill[y] == GRID_WIDTH) {
+			fullRows |= 1u << y;
+			linesCleared++;
+		}
+	}
+	if (fullRows == 0) {
+		return 0;
+	}
+	game->clearedRows = (game->clearedRows != 0) ? ENGINE_CLEARS_UNKNOWN : fullRows;
+
+	// every row from the top of the stack to the lowest full one changes place or goes
+	uint8_t bottom = 31 - __builtin_clz(fullRows);
+	for (uint8_t y = top; y <= bottom; y++) {
+		game->zobrist ^= Zobrist_Row(y, game->rowHashes[y]);
+	}
+
+	// move the kept rows down over the full ones in one pass from the bottom
+	int8_t to = GRID_ROWS - 1;
+	for (int8_t from = GRID_ROWS - 1; from >= top; from--) {
+		if (fullRows & (1u << from)) {
+			continue;
+		}
+		if (to != from) {
+			memcpy(game->gameGrid[to], game->gameGrid[from], GRID_WIDTH);
+			game->gridRows[to] = game->gridRows[from];
+			game->rowHashes[to] = game->rowHashes[from];
+			features->rowFill[to] = features->rowFill[from];
+		}
+		to--;
+	}
+
+	// the rows left at the top of the stack are empty
+	for (; to >= top; to--) {
+		memset(game->gameGrid[to], EMPTY_CELL, GRID_WIDTH);
+		game->gridRows[to] = 0;
+		game->rowHashes[to] = 0;
+		features->rowFill[to] = 0;
+	}
+	for (uint8_t y = top; y <= bottom; y++) {
+		game->zobrist ^= Zobrist_Row(y, game->rowHashes[y]);
+	}
+
+	DropFeatureRows(game, fullRows, linesCleared);
+
+	return linesCleared;
+}
+
+// A block locked entirely in the hidden rows is a lock out, blockRows are the rows it locked in
+void CheckGameEnd(GameState *game, uint32_t blockRows) {
+	if ((blockRows & VISIBLE_ROWS) == 0) {
+		// flag game over, the application moves on to the results screen
+		game->gameOver = true;
+		game->endTime = game->engineTime;
+	}
+}
+
+// A cell joined the stack: it either raises its column, making holes of the gap under
+// it, or fills a hole under an overhang it was slid into
+static void AddFeatureCell(BoardFeatures *features, uint8_t x, uint8_t y) {
+	uint8_t height = GRID_ROWS - y;
+
+	features->rowFill[y]++;
+	if (height <= features->columnHeights[x]) {
+		features->holes--;
+		return;
+	}
+	features->holes += height - 1 - features->columnHeights[x];
+	features->columnHeights[x] = height;
+	if (height > features->stackHeight) {
+		features->stackHeight = height;
+	}
+}
+
+/*
+ * Heights after count full rows went. Every column has a cell in every full row, so a
+ * column whose top is above them just comes down by count. A column whose top was in
+ * the highest full row is followed down to its next cell, and the holes it passes are
+ * open again. Rows were already moved, gridRows is the board after the clear.
+ */
+static void DropFeatureRows(GameState *game, uint32_t fullRows, uint8_t count) {
+	BoardFeatures *features = &game->features;
+	uint8_t clearedTop = GRID_ROWS - __builtin_ctz(fullRows);	// height of the highest full row
+
+	features->stackHeight = 0;
+	for (uint8_t x = 0; x < GRID_WIDTH; x++) {
+		uint8_t height = features->columnHeights[x] - count;
+
+		if (features->columnHeights[x] == clearedTop) {
+			uint8_t open = height;
+			while ((height > 0) && !(game->gridRows[GRID_ROWS - height] & (1 << x))) {
+				height--;
+			}
+			features->holes -= open - height;
+		}
+		features->columnHeights[x] = height;
+		if (height > features->stackHeight) {
+			features->stackHeight = height;
+		}
+	}
+}
+
+// splitmix64 finaliser, every key and salt goes through it
+static uint64_t Zobrist_Mix(uint64_t x) {
+	x += 0x9E3779B97F4A7C15ull;
+	x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+	x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+	return x ^ (x >> 31);
+}
+
+// A row's share of the board hash, empty rows add nothing
+static uint64_t Zobrist_Row(uint8_t y, uint64_t rowHash) {
+	return (rowHash == 0) ? 0 : Zobrist_Mix(rowHash ^ ZOBRIST_ROW(y));
+}
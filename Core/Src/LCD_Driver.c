@@ -15,22 +15,21 @@
 
 static LTDC_HandleTypeDef hltdc;
 static RCC_PeriphCLKInitTypeDef PeriphClkInitStruct;
-static FONT_t *LCD_Currentfonts;
-static uint16_t CurrentTextColor = 0xFFFF;
 
-/*
- * fb[y*W+x] OR fb[y][x]
- * Alternatively, we can modify the linker script to have an end address of 20013DFB instead of 2002FFFF, so it does not place variables in the same region as the frame buffer. In this case it is safe to just specify the raw address as frame buffer.
- */
-//uint32_t frameBuffer[(LCD_PIXEL_WIDTH*LCD_PIXEL_WIDTH)/2] = {0};		//16bpp pixel format. We can size to uint32. this ensures 32 bit alignment
-
-//Someone from STM said it was "often accessed" a 1-dim array, and not a 2d array. However you still access it like a 2dim array,  using fb[y*W+x] instead of fb[y][x].
-uint16_t frameBuffer[LCD_PIXEL_WIDTH * LCD_PIXEL_HEIGHT] = { 0 };//16bpp pixel format.
+// Scan line clock for ScanSync, see LCD_ScanClock
+static volatile uint32_t scanRefreshes;	// line 0 events taken
+static volatile uint16_t scanEventLine;	// line the event is armed at
 
 void LCD_Init(void) {
 	LTCD__Init();
 	LTCD_Layer_Init(0);
+	LTCD_Layer_Init(1);
 	LCD_Clear(0, LCD_COLOR_WHITE);
+
+	// line event at the start of every refresh, it counts the refreshes for the scan clock
+	HAL_NVIC_SetPriority(LTDC_IRQn, 0x0F, 0x00);
+	HAL_NVIC_EnableIRQ(LTDC_IRQn);
+	HAL_LTDC_ProgramLineEvent(&hltdc, 0);
 }
 
 void LCD_GPIO_Init(void) {
@@ -135,9 +134,108 @@ void LTCD_Layer_Init(uint8_t LayerIndex) {
 	pLayerCfg.Backcolor.Blue = 0;
 	pLayerCfg.Backcolor.Green = 0;
 	pLayerCfg.Backcolor.Red = 0;
+	if (LayerIndex == 1) {
+		// UI layer, L8 through the CLUT, the window is set by LCD_Ui_Apply
+		pLayerCfg.WindowY1 = UI_LAYER_BYTES / LCD_PIXEL_WIDTH;
+		pLayerCfg.PixelFormat = LTDC_PIXEL_FORMAT_L8;
+		pLayerCfg.Alpha = UI_ALPHA;
+		pLayerCfg.FBStartAdress = (uintptr_t) uiBuffer;
+		pLayerCfg.ImageHeight = pLayerCfg.WindowY1;
+	}
 	if (HAL_LTDC_ConfigLayer(&hltdc, &pLayerCfg, LayerIndex) != HAL_OK) {
 		LCD_Error_Handler();
 	}
+
+	if (LayerIndex == 1) {
+		uint32_t clut[UI_PALETTE_SIZE];
+		for (uint8_t i = 0; i < UI_PALETTE_SIZE; i++) {
+			clut[i] = Ui_PaletteRGB(i);
+		}
+		HAL_LTDC_ConfigCLUT(&hltdc, clut, UI_PALETTE_SIZE, 1);
+		HAL_LTDC_EnableCLUT(&hltdc, 1);
+
+		// UI_CLEAR pixels are dropped so layer 0 shows through
+		HAL_LTDC_ConfigColorKeying(&hltdc, UI_KEY_RGB, 1);
+		HAL_LTDC_EnableColorKeying(&hltdc, 1);
+
+		Ui_Hide();
+		LCD_Ui_Apply();
+	}
+}
+
+/*
+ * Hand the UI window to the LTDC. The registers are shadowed and only reloaded in
+ * the next vertical blanking, so a window never changes halfway down the screen.
+ */
+void LCD_Ui_Apply(void) {
+	if (uiWindow.visible) {
+		HAL_LTDC_SetWindowSize_NoReload(&hltdc, uiWindow.width, uiWindow.height, 1);
+		HAL_LTDC_SetWindowPosition_NoReload(&hltdc, uiWindow.x, uiWindow.y, 1);
+	} else {
+		__HAL_LTDC_LAYER_DISABLE(&hltdc, 1);
+	}
+	HAL_LTDC_Reload(&hltdc, LTDC_RELOAD_VERTICAL_BLANKING);
+}
+
+/*
+ * Scan lines since LCD_Init: the refreshes the line 0 event has counted and the line
+ * of the current one. A line 0 event that is pending but not taken yet, with
+ * interrupts masked, is a refresh that has started, so it is counted here too.
+ */
+uint32_t LCD_ScanClock(void) {
+	uint32_t primask = __get_PRIMASK();
+	uint32_t pending, line;
+	__disable_irq();
+
+	// the flag read on both sides of the line, so the line is from after a wrap it shows
+	do {
+		pending = LTDC->ISR & LTDC_ISR_LIF;
+		line = LTDC->CPSR & LTDC_CPSR_CYPOS;
+	} while (pending != (LTDC->ISR & LTDC_ISR_LIF));
+	uint32_t refreshes = scanRefreshes + ((pending && (scanEventLine == 0)) ? 1 : 0);
+	uint32_t clock = refreshes * SCAN_TOTAL_LINES + line;
+
+	__set_PRIMASK(primask);
+	return clock;
+}
+
+// Line event without the HAL lock, also called from the interrupt
+static void LCD_ArmLineEvent(uint16_t line) {
+	scanEventLine = line;
+	LTDC->LIPCR = line;
+	__HAL_LTDC_ENABLE_IT(&hltdc, LTDC_IT_LI);
+}
+
+/*
+ * Sleep until the scan clock gets to clock. The event only moves off line 0 to wake
+ * the wait at a line at least a line ahead in this refresh, and the interrupt puts it
+ * back on line 0 before the next refresh starts, so no refresh goes uncounted.
+ */
+void LCD_ScanWait(uint32_t clock) {
+	uint32_t now;
+
+	while ((now = LCD_ScanClock()) < clock) {
+		uint32_t primask = __get_PRIMASK();
+		__disable_irq();
+		if ((clock / SCAN_TOTAL_LINES == now / SCAN_TOTAL_LINES)
+				&& ((LTDC->CPSR & LTDC_CPSR_CYPOS) + 1 < clock % SCAN_TOTAL_LINES)
+				&& !(LTDC->ISR & LTDC_ISR_LIF)) {
+			LCD_ArmLineEvent(clock % SCAN_TOTAL_LINES);
+		}
+		__set_PRIMASK(primask);
+		__WFI();
+	}
+}
+
+void HAL_LTDC_LineEventCallback(LTDC_HandleTypeDef *handle) {
+	if (scanEventLine == 0) {
+		scanRefreshes++;
+	}
+	LCD_ArmLineEvent(0);
+}
+
+void LTDC_IRQHandler(void) {
+	HAL_LTDC_IRQHandler(&hltdc);
 }
 
 void clearScreen(void) {
@@ -193,110 +291,7 @@ void LTCD__Init(void) {
 	ili9341_Init();
 }
 
-/* START Draw functions */
-
-/*
- * This is really the only function needed.
- * All drawing consists of is manipulating the array.
- * Adding input sanitation should probably be done.
- */
-void LCD_Draw_Pixel(uint16_t x, uint16_t y, uint16_t color) {
-	frameBuffer[y * LCD_PIXEL_WIDTH + x] = color; //You cannot do x*y to set the pixel.
-}
-
-/*
- * These functions are simple examples. Most computer graphics like OpenGl and stm's graphics library use a state machine. Where you first call some function like SetColor(color), SetPosition(x,y), then DrawSqure(size)
- * Instead all of these are explicit where color, size, and position are passed in.
- * There is tons of ways to handle drawing. I dont think it matters too much.
- */
-void LCD_Draw_Circle_Fill(uint16_t Xpos, uint16_t Ypos, uint16_t radius,
-		uint16_t color) {
-	for (int16_t y = -radius; y <= radius; y++) {
-		for (int16_t x = -radius; x <= radius; x++) {
-			if (x * x + y * y <= radius * radius) {
-				LCD_Draw_Pixel(x + Xpos, y + Ypos, color);
-			}
-		}
-	}
-}
-
-// Added by will
-void LCD_Draw_Rectangle_Fill(uint16_t X1, uint16_t Y1, uint16_t X2, uint16_t Y2, uint16_t color)
-{
-	uint16_t startX = (X1 < X2) ? X1 : X2;
-	uint16_t endX = (X1 < X2) ? X2 : X1;
-
-	uint16_t startY = (Y1 < Y2) ? Y1 : Y2;
-	uint16_t endY = (Y1 < Y2) ? Y2 : Y1;
-
-	for (uint16_t y = startY; y <= endY; y++) {
-		for (uint16_t x = startX; x <= endX; x++) {
-			if ((x == startX) || (y == startY) || (x == endX) ||(y == endY)){
-				LCD_Draw_Pixel(x, y, LCD_COLOR_GREY);
-			} else {
-				LCD_Draw_Pixel(x, y, color);
-			}
-
-		}
-	}
-}
-
-void LCD_Draw_Vertical_Line(uint16_t x, uint16_t y, uint16_t len,
-		uint16_t color) {
-	for (uint16_t i = 0; i < len; i++) {
-		LCD_Draw_Pixel(x, i + y, color);
-	}
-}
-
-void LCD_Draw_Horizontal_Line(uint16_t x, uint16_t y, uint16_t len, uint16_t color) {
-	for (uint16_t i = 0; i < len; i++) {
-		LCD_Draw_Pixel(x + i, y, color);
-	}
-}
-
-void LCD_Clear(uint8_t LayerIndex, uint16_t Color) {
-	if (LayerIndex == 0) {
-		for (uint32_t i = 0; i < LCD_PIXEL_WIDTH * LCD_PIXEL_HEIGHT; i++) {
-			frameBuffer[i] = Color;
-		}
-	}
-	// TODO: Add more Layers if needed
-}
-
-//This was taken and adapted from stm32's mcu code
-void LCD_SetTextColor(uint16_t Color) {
-	CurrentTextColor = Color;
-}
-
-//This was taken and adapted from stm32's mcu code
-void LCD_SetFont(FONT_t *fonts) {
-	LCD_Currentfonts = fonts;
-}
-
-//This was taken and adapted from stm32's mcu code
-void LCD_Draw_Char(uint16_t Xpos, uint16_t Ypos, const uint16_t *c) {
-	uint32_t index = 0, counter = 0;
-	for (index = 0; index < LCD_Currentfonts->Height; index++) {
-		for (counter = 0; counter < LCD_Currentfonts->Width; counter++) {
-			if ((((c[index]
-					& ((0x80 << ((LCD_Currentfonts->Width / 12) * 8)) >> counter))
-					== 0x00) && (LCD_Currentfonts->Width <= 12))
-					|| (((c[index] & (0x1 << counter)) == 0x00)
-							&& (LCD_Currentfonts->Width > 12))) {
-				//Background If want to overrite text under then add a set color here
-			} else {
-				LCD_Draw_Pixel(counter + Xpos, index + Ypos, CurrentTextColor);
-			}
-		}
-	}
-}
-
-//This was taken and adapted from stm32's mcu code
-void LCD_DisplayChar(uint16_t Xpos, uint16_t Ypos, uint8_t Ascii) {
-	Ascii -= 32;
-	LCD_Draw_Char(Xpos, Ypos,
-			&LCD_Currentfonts->table[Ascii * LCD_Currentfonts->Height]);
-}
+// Drawing into the framebuffer lives in LCD_Graphics.c
 
 /**
  * @brief  This function is executed in case of error occurrence.
@@ -0,0 +1,458 @@
+/*
+ * LCD_Graphics.c
+ *
+ *  Created on: Dec 11, 2024
+ *      Author: Will Fraser
+ */
+
+#include "LCD_Graphics.h"
+#include "GlyphMasks.h"
+
+// Two pixels at once, may_alias because the framebuffer is declared as uint16_t
+typedef uint32_t __attribute__((may_alias)) PixelPair;
+
+static FONT_t *LCD_Currentfonts;
+static const GlyphSet *CurrentGlyphs;
+static uint16_t CurrentTextColor = 0xFFFF;
+static uint16_t FontProbe[16];			// bit of each column for fonts without masks
+static uint16_t FontColumns;
+
+/*
+ * fb[y*W+x] OR fb[y][x]
+ * Alternatively, we can modify the linker script to have an end address of 20013DFB instead of 2002FFFF, so it does not place variables in the same region as the frame buffer. In this case it is safe to just specify the raw address as frame buffer.
+ */
+//uint32_t frameBuffer[(LCD_PIXEL_WIDTH*LCD_PIXEL_WIDTH)/2] = {0};		//16bpp pixel format. We can size to uint32. this ensures 32 bit alignment
+
+//Someone from STM said it was "often accessed" a 1-dim array, and not a 2d array. However you still access it like a 2dim array,  using fb[y*W+x] instead of fb[y][x].
+uint16_t frameBuffer[LCD_PIXEL_WIDTH * LCD_PIXEL_HEIGHT] __attribute__((aligned(4))) = { 0 };//16bpp pixel format.
+
+/*
+ * Each nibble of a glyph row covers four pixels, two words of the framebuffer.
+ * The masks select the halfwords of the pixels that are set.
+ */
+static const uint32_t nibblePixels[16][2] = {
+		{ 0x00000000, 0x00000000 }, { 0x0000FFFF, 0x00000000 },
+		{ 0xFFFF0000, 0x00000000 }, { 0xFFFFFFFF, 0x00000000 },
+		{ 0x00000000, 0x0000FFFF }, { 0x0000FFFF, 0x0000FFFF },
+		{ 0xFFFF0000, 0x0000FFFF }, { 0xFFFFFFFF, 0x0000FFFF },
+		{ 0x00000000, 0xFFFF0000 }, { 0x0000FFFF, 0xFFFF0000 },
+		{ 0xFFFF0000, 0xFFFF0000 }, { 0xFFFFFFFF, 0xFFFF0000 },
+		{ 0x00000000, 0xFFFFFFFF }, { 0x0000FFFF, 0xFFFFFFFF },
+		{ 0xFFFF0000, 0xFFFFFFFF }, { 0xFFFFFFFF, 0xFFFFFFFF } };
+
+/* START Draw functions */
+
+/*
+ * This is really the only function needed.
+ * All drawing consists of is manipulating the array.
+ * Adding input sanitation should probably be done.
+ */
+void LCD_Draw_Pixel(uint16_t x, uint16_t y, uint16_t color) {
+	frameBuffer[y * LCD_PIXEL_WIDTH + x] = color; //You cannot do x*y to set the pixel.
+}
+
+/*
+ * These functions are simple examples. Most computer graphics like OpenGl and stm's graphics library use a state machine. Where you first call some function like SetColor(color), SetPosition(x,y), then DrawSqure(size)
+ * Instead all of these are explicit where color, size, and position are passed in.
+ * There is tons of ways to handle drawing. I dont think it matters too much.
+ */
+
+// Pixels x0..x1 of row y, clipped to the screen, two pixels per store in the middle
+static void LCD_Fill_Span(int32_t x0, int32_t x1, int32_t y, uint16_t color) {
+	if ((y < 0) || (y >= LCD_PIXEL_HEIGHT)) {
+		return;
+	}
+	if (x0 < 0) {
+		x0 = 0;
+	}
+	if (x1 >= LCD_PIXEL_WIDTH) {
+		x1 = LCD_PIXEL_WIDTH - 1;
+	}
+	if (x0 > x1) {
+		return;
+	}
+
+	uint16_t *pixel = &frameBuffer[y * LCD_PIXEL_WIDTH + x0];
+	uint32_t count = x1 - x0 + 1;
+	if (x0 & 1) {
+		*pixel++ = color;
+		count--;
+	}
+
+	PixelPair *pair = (PixelPair*) pixel;
+	uint32_t colorPair = color * 0x00010001u;
+	for (; count >= 2; count -= 2) {
+		*pair++ = colorPair;
+	}
+	if (count != 0) {
+		*(uint16_t*) pair = color;
+	}
+}
+
+/*
+ * Same pixels as testing x*x + y*y <= r*r over the bounding square, drawn as one
+ * span per row. The half width of each row is found from the one above it: moving
+ * down a row takes 2y - 1 off the slack r*r - y*y - w*w, and each pixel the span
+ * loses gives 2w - 1 back, so no multiplies or square roots are needed.
+ */
+void LCD_Draw_Circle_Fill(int16_t Xpos, int16_t Ypos, uint16_t radius,
+		uint16_t color) {
+	int32_t width = radius;
+	int32_t slack = 0;			// r*r - y*y - width*width
+
+	for (int32_t y = 0; y <= radius; y++) {
+		if (y > 0) {
+			slack -= 2 * y - 1;
+		}
+		while (slack < 0) {
+			slack += 2 * width - 1;
+			width--;
+		}
+
+		LCD_Fill_Span(Xpos - width, Xpos + width, Ypos + y, color);
+		if (y > 0) {
+			LCD_Fill_Span(Xpos - width, Xpos + width, Ypos - y, color);
+		}
+	}
+}
+
+// Added by will
+void LCD_Draw_Rectangle_Fill(uint16_t X1, uint16_t Y1, uint16_t X2, uint16_t Y2, uint16_t color)
+{
+	uint16_t startX = (X1 < X2) ? X1 : X2;
+	uint16_t endX = (X1 < X2) ? X2 : X1;
+
+	uint16_t startY = (Y1 < Y2) ? Y1 : Y2;
+	uint16_t endY = (Y1 < Y2) ? Y2 : Y1;
+
+	for (uint16_t y = startY; y <= endY; y++) {
+		for (uint16_t x = startX; x <= endX; x++) {
+			if ((x == startX) || (y == startY) || (x == endX) ||(y == endY)){
+				LCD_Draw_Pixel(x, y, LCD_COLOR_GREY);
+			} else {
+				LCD_Draw_Pixel(x, y, color);
+			}
+
+		}
+	}
+}
+
+void LCD_Draw_Vertical_Line(int16_t x, int16_t y, uint16_t len, uint16_t color) {
+	int32_t top = (y < 0) ? 0 : y;
+	int32_t bottom = y + len;
+
+	if ((x < 0) || (x >= LCD_PIXEL_WIDTH) || (len == 0)) {
+		return;
+	}
+	if (bottom > LCD_PIXEL_HEIGHT) {
+		bottom = LCD_PIXEL_HEIGHT;
+	}
+
+	uint16_t *pixel = &frameBuffer[top * LCD_PIXEL_WIDTH + x];
+	for (int32_t row = top; row < bottom; row++, pixel += LCD_PIXEL_WIDTH) {
+		*pixel = color;
+	}
+}
+
+void LCD_Draw_Horizontal_Line(int16_t x, int16_t y, uint16_t len, uint16_t color) {
+	if (len != 0) {
+		LCD_Fill_Span(x, (int32_t) x + len - 1, y, color);
+	}
+}
+
+// floor(a / b) and ceil(a / b) for b > 0, C division rounds towards zero
+static int64_t LCD_FloorDiv(int64_t a, int64_t b) {
+	return (a >= 0) ? a / b : -((-a + b - 1) / b);
+}
+
+static int64_t LCD_CeilDiv(int64_t a, int64_t b) {
+	return -LCD_FloorDiv(-a, b);
+}
+
+/*
+ * Bresenham line from (x0, y0) to (x1, y1), both ends drawn. Along the major axis
+ * step i puts the minor axis at floor((2 * i * minor + major) / (2 * major)), the
+ * nearest pixel with halves rounded away from the start. The steps that land on
+ * the screen are worked out up front, so only those are walked and each one is a
+ * store through a pointer that moves by a pixel or a line.
+ */
+void LCD_Draw_Line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+	int32_t dx = (x1 > x0) ? x1 - x0 : x0 - x1;
+	int32_t dy = (y1 > y0) ? y1 - y0 : y0 - y1;
+	int32_t sx = (x1 >= x0) ? 1 : -1;
+	int32_t sy = (y1 >= y0) ? 1 : -1;
+
+	// major axis first: start, delta, direction, screen size and pointer step
+	bool xMajor = dx >= dy;
+	int32_t major0 = xMajor ? x0 : y0, minor0 = xMajor ? y0 : x0;
+	int32_t major = xMajor ? dx : dy, minor = xMajor ? dy : dx;
+	int32_t majorSign = xMajor ? sx : sy, minorSign = xMajor ? sy : sx;
+	int32_t majorSize = xMajor ? LCD_PIXEL_WIDTH : LCD_PIXEL_HEIGHT;
+	int32_t minorSize = xMajor ? LCD_PIXEL_HEIGHT : LCD_PIXEL_WIDTH;
+	int32_t majorStep = xMajor ? sx : sy * LCD_PIXEL_WIDTH;
+	int32_t minorStep = xMajor ? sy * LCD_PIXEL_WIDTH : sx;
+
+	// steps with the major axis on screen
+	int64_t first = (majorSign > 0) ? -major0 : major0 - (majorSize - 1);
+	int64_t last = (majorSign > 0) ? majorSize - 1 - major0 : major0;
+
+	// minor offsets on screen, then the steps that have them
+	int64_t lowest = (minorSign > 0) ? -minor0 : minor0 - (minorSize - 1);
+	int64_t highest = (minorSign > 0) ? minorSize - 1 - minor0 : minor0;
+	if (minor == 0) {
+		if ((lowest > 0) || (highest < 0)) {
+			return;
+		}
+	} else {
+		int64_t from = LCD_CeilDiv(2 * (int64_t) major * lowest - major, 2 * (int64_t) minor);
+		int64_t to = LCD_CeilDiv(2 * (int64_t) major * (highest + 1) - major,
+				2 * (int64_t) minor) - 1;
+		first = (from > first) ? from : first;
+		last = (to < last) ? to : last;
+	}
+	first = (first > 0) ? first : 0;
+	last = (last < major) ? last : major;
+	if (first > last) {
+		return;
+	}
+
+	// Bresenham state at the first step on screen
+	int64_t offset = LCD_FloorDiv(2 * first * minor + major, 2 * (int64_t) major);
+	int32_t error = (int32_t) (2 * first * minor + major - 2 * major * offset);
+	int32_t x = xMajor ? major0 + majorSign * first : minor0 + minorSign * offset;
+	int32_t y = xMajor ? minor0 + minorSign * offset : major0 + majorSign * first;
+	uint16_t *pixel = &frameBuffer[y * LCD_PIXEL_WIDTH + x];
+
+	for (int64_t step = first;; step++) {
+		*pixel = color;
+		if (step == last) {
+			break;
+		}
+		pixel += majorStep;
+		error += 2 * minor;
+		if (error >= 2 * major) {
+			error -= 2 * major;
+			pixel += minorStep;
+		}
+	}
+}
+
+void LCD_Clear(uint8_t LayerIndex, uint16_t Color) {
+	if (LayerIndex == 0) {
+		for (uint32_t i = 0; i < LCD_PIXEL_WIDTH * LCD_PIXEL_HEIGHT; i++) {
+			frameBuffer[i] = Color;
+		}
+	}
+	// TODO: Add more Layers if needed
+}
+
+//This was taken and adapted from stm32's mcu code
+void LCD_SetTextColor(uint16_t Color) {
+	CurrentTextColor = Color;
+}
+
+// The fonts.c fonts have precomputed masks in GlyphMasks.c, anything else takes the slow path
+void LCD_SetFont(FONT_t *fonts) {
+	LCD_Currentfonts = fonts;
+	if (fonts == &Font16x24) {
+		CurrentGlyphs = &Glyphs16x24;
+	} else if (fonts == &Font12x12) {
+		CurrentGlyphs = &Glyphs12x12;
+	} else {
+		CurrentGlyphs = 0;
+	}
+
+	// bit tested for each column of the slow path, 12 wide and under is MSB first
+	FontColumns = (fonts->Width > 16) ? 16 : fonts->Width;
+	for (uint16_t counter = 0; counter < FontColumns; counter++) {
+		FontProbe[counter] = (fonts->Width <= 12) ?
+				(uint16_t) ((0x80 << ((fonts->Width / 12) * 8)) >> counter) :
+				(uint16_t) (0x1 << counter);
+	}
+}
+
+// Row of a font table without precomputed masks, in the bit 0 leftmost order
+static uint16_t LCD_Normalise_Row(uint16_t row) {
+	uint16_t mask = 0;
+
+	for (uint16_t counter = 0; counter < FontColumns; counter++) {
+		if (row & FontProbe[counter]) {
+			mask |= 1u << counter;
+		}
+	}
+	return mask;
+}
+
+// Write the set pixels of one normalised row, starting at an even pixel
+static inline void LCD_Blit_Row(PixelPair *pair, uint32_t mask, uint32_t color) {
+	for (; mask != 0; mask >>= 4, pair += 2) {
+		const uint32_t *select = nibblePixels[mask & 0x0F];
+		if (mask & 0x03) {
+			pair[0] = (pair[0] & ~select[0]) | (color & select[0]);
+		}
+		if (mask & 0x0C) {
+			pair[1] = (pair[1] & ~select[1]) | (color & select[1]);
+		}
+	}
+}
+
+/*
+ * Draw one glyph of the current font with word stores. An odd Xpos shifts the row
+ * masks over by a pixel so every store stays aligned. Text is drawn transparent,
+ * like before, so the pixels around the glyph are kept.
+ */
+static void LCD_Blit_Glyph(uint16_t Xpos, uint16_t Ypos, uint32_t glyph) {
+	const uint8_t *extent = &CurrentGlyphs->extent[glyph * 2];
+	const uint16_t *rows = &CurrentGlyphs->rows[glyph * CurrentGlyphs->height
+			+ extent[0]];
+	PixelPair *line = (PixelPair*) &frameBuffer[(Ypos + extent[0]) * LCD_PIXEL_WIDTH
+			+ (Xpos & ~1u)];
+	uint32_t shift = Xpos & 1;
+	uint32_t color = CurrentTextColor * 0x00010001u;
+
+	for (uint8_t row = 0; row < extent[1]; row++, line += LCD_PIXEL_WIDTH / 2) {
+		LCD_Blit_Row(line, (uint32_t) rows[row] << shift, color);
+	}
+}
+
+//This was taken and adapted from stm32's mcu code
+void LCD_Draw_Char(uint16_t Xpos, uint16_t Ypos, const uint16_t *c) {
+	const uint16_t *table = LCD_Currentfonts->table;
+	uint16_t height = LCD_Currentfonts->Height;
+
+	if ((CurrentGlyphs != 0) && (c >= table)
+			&& (c < table + CurrentGlyphs->count * height)
+			&& ((c - table) % height == 0)) {
+		LCD_Blit_Glyph(Xpos, Ypos, (uint32_t) (c - table) / height);
+		return;
+	}
+
+	// not a glyph of a known table, normalise the rows as they are drawn
+	PixelPair *line = (PixelPair*) &frameBuffer[Ypos * LCD_PIXEL_WIDTH + (Xpos & ~1u)];
+	uint32_t color = CurrentTextColor * 0x00010001u;
+	for (uint16_t index = 0; index < height; index++, line += LCD_PIXEL_WIDTH / 2) {
+		LCD_Blit_Row(line, (uint32_t) LCD_Normalise_Row(c[index]) << (Xpos & 1), color);
+	}
+}
+
+// Pixels from one character to the next in a string
+static uint16_t LCD_Advance(void) {
+	return LCD_Currentfonts->Width + LCD_CHAR_SPACING;
+}
+
+uint16_t LCD_StringWidth(const char *text) {
+	uint16_t length = 0;
+
+	while (text[length] != '\0') {
+		length++;
+	}
+	return (length == 0) ? 0 : length * LCD_Advance() - LCD_CHAR_SPACING;
+}
+
+/*
+ * Draw a string as one run: the font, color, row range and framebuffer line are set
+ * up once, then each glyph only needs its column offset. Unlike LCD_DisplayChar the
+ * run is clipped to the screen, glyphs hanging off an edge are cut at the edge.
+ */
+static void LCD_Blit_Run(int16_t Xpos, int16_t Ypos, const char *text) {
+	const GlyphSet *glyphs = CurrentGlyphs;
+	uint16_t width = LCD_Currentfonts->Width;
+	uint16_t height = LCD_Currentfonts->Height;
+	uint16_t advance = LCD_Advance();
+	uint32_t color = CurrentTextColor * 0x00010001u;
+	int16_t top = (Ypos < 0) ? -Ypos : 0;
+	int16_t bottom = LCD_PIXEL_HEIGHT - Ypos;
+
+	if ((bottom <= 0) || (top >= height)) {
+		return;
+	}
+
+	for (int16_t x = Xpos; *text != '\0'; text++, x += advance) {
+		uint8_t glyph = (uint8_t) (*text - GLYPH_FIRST_CHAR);
+		if ((*text < GLYPH_FIRST_CHAR) || ((glyphs != 0) && (glyph >= glyphs->count))
+				|| (x + width <= 0)) {
+			continue;
+		}
+		if (x >= LCD_PIXEL_WIDTH) {
+			break;
+		}
+
+		// columns inside the screen, a glyph hanging off the left starts at column 0
+		uint32_t columns = 0xFFFF;
+		uint16_t skip = (x < 0) ? -x : 0;
+		int16_t left = x + skip;
+		if (LCD_PIXEL_WIDTH - x < 16) {
+			columns = (1u << (LCD_PIXEL_WIDTH - x)) - 1;
+		}
+
+		// rows with pixels, the whole height when there are no masks
+		const uint16_t *rows;
+		int16_t first, last;
+		if (glyphs != 0) {
+			const uint8_t *extent = &glyphs->extent[glyph * 2];
+			rows = &glyphs->rows[glyph * height];
+			first = extent[0];
+			last = extent[0] + extent[1];
+		} else {
+			rows = &LCD_Currentfonts->table[glyph * height];
+			first = 0;
+			last = height;
+		}
+		if (first < top) {
+			first = top;
+		}
+		if (last > bottom) {
+			last = bottom;
+		}
+		if (first >= last) {
+			continue;
+		}
+
+		PixelPair *line = (PixelPair*) &frameBuffer[(Ypos + first) * LCD_PIXEL_WIDTH
+				+ (left & ~1)];
+		for (int16_t row = first; row < last; row++, line += LCD_PIXEL_WIDTH / 2) {
+			uint32_t mask = (glyphs != 0) ? rows[row] : LCD_Normalise_Row(rows[row]);
+			LCD_Blit_Row(line, ((mask & columns) >> skip) << (left & 1), color);
+		}
+	}
+}
+
+void LCD_DisplayString(int16_t Xpos, int16_t Ypos, const char *text, uint8_t align) {
+	if (align == LCD_ALIGN_CENTER) {
+		Xpos -= LCD_StringWidth(text) / 2;
+	} else if (align == LCD_ALIGN_RIGHT) {
+		Xpos -= LCD_StringWidth(text);
+	}
+	LCD_Blit_Run(Xpos, Ypos, text);
+}
+
+// Decimal digits of value into digits, returns the length, no libc formatting
+uint8_t LCD_FormatNumber(uint32_t value, char digits[LCD_NUMBER_DIGITS + 1]) {
+	char reversed[LCD_NUMBER_DIGITS];
+	uint8_t length = 0;
+
+	do {
+		reversed[length++] = '0' + value % 10;
+		value /= 10;
+	} while (value != 0);
+
+	for (uint8_t i = 0; i < length; i++) {
+		digits[i] = reversed[length - 1 - i];
+	}
+	digits[length] = '\0';
+	return length;
+}
+
+void LCD_DisplayNumber(int16_t Xpos, int16_t Ypos, uint32_t value, uint8_t align) {
+	char digits[LCD_NUMBER_DIGITS + 1];
+
+	LCD_FormatNumber(value, digits);
+	LCD_DisplayString(Xpos, Ypos, digits, align);
+}
+
+//This was taken and adapted from stm32's mcu code
+void LCD_DisplayChar(uint16_t Xpos, uint16_t Ypos, uint8_t Ascii) {
+	Ascii -= 32;
+	LCD_Draw_Char(Xpos, Ypos,
+			&LCD_Currentfonts->table[Ascii * LCD_Currentfonts->Height]);
+}
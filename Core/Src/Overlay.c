@@ -0,0 +1,177 @@
+/*
+ * Overlay.c
+ *
+ *  Created on: Dec 14, 2024
+ *      Author: Will Fraser
+ */
+
+#include "Overlay.h"
+
+/*
+ * The widgets of each screen and what each screen draws into the UI layer. The
+ * window only covers the pixels the screen needs, the playfield underneath is never
+ * drawn over. The art behind the menu and results comes from ScreenImages.c.
+ */
+
+_Static_assert((MENU_BUTTON_X2 - MENU_BUTTON_X1 + 1) * (MENU_BUTTON_Y2 - MENU_BUTTON_Y1 + 1)
+		<= UI_LAYER_BYTES, "the start button window does not fit in uiBuffer");
+_Static_assert(GRID_WIDTH * ATLAS_TILE_SIZE * HUD_HEIGHT <= UI_LAYER_BYTES,
+		"the HUD window does not fit in uiBuffer");
+
+static Widget menuWidgets[] = {
+	{ .type = WIDGET_BUTTON, .parent = WIDGET_NONE, .action = MENU_START,
+		.x = MENU_BUTTON_X1, .y = MENU_BUTTON_Y1,
+		.width = MENU_BUTTON_X2 - MENU_BUTTON_X1 + 1,
+		.height = MENU_BUTTON_Y2 - MENU_BUTTON_Y1 + 1, .color = UI_BLACK },
+	{ .type = WIDGET_LABEL, .parent = 0, .action = WIDGET_NO_ACTION,
+		.align = LCD_ALIGN_CENTER, .x = LCD_PIXEL_WIDTH / 2, .y = 241,
+		.color = UI_GREEN, .font = &Font16x24, .text = "GO" },
+};
+
+WidgetScreen menuScreen = { .surface = &widgetUi, .widgets = menuWidgets,
+		.count = sizeof(menuWidgets) / sizeof(menuWidgets[0]), .background = UI_CLEAR };
+
+#define HUD_TEXT(TYPE, X, Y, ALIGN, COLOR, TEXT) { .type = TYPE, .parent = WIDGET_NONE, \
+		.action = WIDGET_NO_ACTION, .align = ALIGN, .x = X, .y = Y, .color = COLOR, \
+		.font = &Font12x12, .text = TEXT }
+
+/*
+ * Left and right halves, rotating in the top half and moving in the bottom, hold in
+ * the corner. Then the HUD, labels first so long values are drawn over them: points
+ * between the hold slot and the preview, lines and level below them, time and pieces
+ * per second below that.
+ */
+static Widget gameWidgets[] = {
+	{ .type = WIDGET_ZONE, .parent = WIDGET_NONE, .action = INPUT_MOVE_LEFT,
+		.x = 0, .y = LCD_PIXEL_HEIGHT / 2, .width = LCD_PIXEL_WIDTH / 2,
+		.height = LCD_PIXEL_HEIGHT / 2 },
+	{ .type = WIDGET_ZONE, .parent = WIDGET_NONE, .action = INPUT_MOVE_RIGHT,
+		.x = LCD_PIXEL_WIDTH / 2, .y = LCD_PIXEL_HEIGHT / 2,
+		.width = LCD_PIXEL_WIDTH / 2, .height = LCD_PIXEL_HEIGHT / 2 },
+	{ .type = WIDGET_ZONE, .parent = WIDGET_NONE, .action = INPUT_ROTATE_LEFT,
+		.x = 0, .y = 0, .width = LCD_PIXEL_WIDTH / 2, .height = LCD_PIXEL_HEIGHT / 2 },
+	{ .type = WIDGET_ZONE, .parent = WIDGET_NONE, .action = INPUT_ROTATE_RIGHT,
+		.x = LCD_PIXEL_WIDTH / 2, .y = 0, .width = LCD_PIXEL_WIDTH / 2,
+		.height = LCD_PIXEL_HEIGHT / 2 },
+	{ .type = WIDGET_ZONE, .parent = WIDGET_NONE, .action = INPUT_HOLD,
+		.x = HOLD_X, .y = 0, .width = 2 * ATLAS_TILE_SIZE, .height = 2 * ATLAS_TILE_SIZE },
+	HUD_TEXT(WIDGET_LABEL, 20, 4, LCD_ALIGN_LEFT, UI_GREY, "PTS"),
+	HUD_TEXT(WIDGET_LABEL, 4, 24, LCD_ALIGN_LEFT, UI_GREY, "L"),
+	HUD_TEXT(WIDGET_LABEL, 88, 24, LCD_ALIGN_LEFT, UI_GREY, "LV"),
+	HUD_TEXT(WIDGET_LABEL, 4, 44, LCD_ALIGN_LEFT, UI_GREY, "T"),
+	HUD_TEXT(WIDGET_LABEL, 112, 44, LCD_ALIGN_LEFT, UI_GREY, "PPS"),
+	HUD_TEXT(WIDGET_NUMBER, 156, 4, LCD_ALIGN_RIGHT, UI_WHITE, 0),
+	HUD_TEXT(WIDGET_NUMBER, 76, 24, LCD_ALIGN_RIGHT, UI_WHITE, 0),
+	HUD_TEXT(WIDGET_NUMBER, 152, 24, LCD_ALIGN_RIGHT, UI_WHITE, 0),
+	HUD_TEXT(WIDGET_CLOCK, 96, 44, LCD_ALIGN_RIGHT, UI_WHITE, 0),
+	{ .type = WIDGET_NUMBER, .parent = WIDGET_NONE, .action = WIDGET_NO_ACTION,
+		.align = LCD_ALIGN_RIGHT, .x = 236, .y = 44, .color = UI_WHITE,
+		.font = &Font12x12, .decimals = 2 },
+};
+
+WidgetScreen gameScreen = { .surface = &widgetUi, .widgets = gameWidgets,
+		.count = sizeof(gameWidgets) / sizeof(gameWidgets[0]), .background = UI_CLEAR };
+
+#define RESULTS_TEXT(TYPE, X, Y, ALIGN, TEXT) { .type = TYPE, .parent = WIDGET_NONE, \
+		.action = WIDGET_NO_ACTION, .align = ALIGN, .x = X, .y = Y, \
+		.color = LCD_COLOR_WHITE, .font = &Font16x24, .text = TEXT }
+
+// In frameBuffer, the labels are the ones in ScreenResults so numbers can be drawn over them
+static Widget resultsWidgets[] = {
+	RESULTS_TEXT(WIDGET_NUMBER, LCD_PIXEL_WIDTH / 2, 121, LCD_ALIGN_CENTER, 0),
+	RESULTS_TEXT(WIDGET_NUMBER, RESULTS_VALUE_X, 181, LCD_ALIGN_RIGHT, 0),
+	RESULTS_TEXT(WIDGET_NUMBER, RESULTS_VALUE_X, 201, LCD_ALIGN_RIGHT, 0),
+	RESULTS_TEXT(WIDGET_NUMBER, RESULTS_VALUE_X, 221, LCD_ALIGN_RIGHT, 0),
+	RESULTS_TEXT(WIDGET_NUMBER, RESULTS_VALUE_X, 241, LCD_ALIGN_RIGHT, 0),
+	RESULTS_TEXT(WIDGET_NUMBER, RESULTS_VALUE_X, 281, LCD_ALIGN_RIGHT, 0),
+	RESULTS_TEXT(WIDGET_LABEL, LCD_PIXEL_WIDTH / 2, 61, LCD_ALIGN_CENTER, "TOTAL"),
+	RESULTS_TEXT(WIDGET_LABEL, LCD_PIXEL_WIDTH / 2, 81, LCD_ALIGN_CENTER, "TIME MS"),
+	RESULTS_TEXT(WIDGET_LABEL, RESULTS_LABEL_X, 181, LCD_ALIGN_LEFT, "SINGLES"),
+	RESULTS_TEXT(WIDGET_LABEL, RESULTS_LABEL_X, 201, LCD_ALIGN_LEFT, "DOUBLES"),
+	RESULTS_TEXT(WIDGET_LABEL, RESULTS_LABEL_X, 221, LCD_ALIGN_LEFT, "TRIPLES"),
+	RESULTS_TEXT(WIDGET_LABEL, RESULTS_LABEL_X, 241, LCD_ALIGN_LEFT, "TETRIS!"),
+	RESULTS_TEXT(WIDGET_LABEL, RESULTS_LABEL_X, 281, LCD_ALIGN_LEFT, "BEST"),
+};
+
+WidgetScreen resultsScreen = { .surface = &widgetFrame, .widgets = resultsWidgets,
+		.count = sizeof(resultsWidgets) / sizeof(resultsWidgets[0]),
+		.background = LCD_COLOR_BLACK };
+
+// Window over the start button, the title stays with the playfield art
+void Overlay_Menu(void) {
+	Ui_SetWindow(MENU_BUTTON_X1, MENU_BUTTON_Y1, MENU_BUTTON_X2 - MENU_BUTTON_X1 + 1,
+			MENU_BUTTON_Y2 - MENU_BUTTON_Y1 + 1);
+	Widget_InvalidateAll(&menuScreen);
+	Widget_Render(&menuScreen);
+}
+
+// Window over the HUD rows, clear apart from the hold slot, preview panel and HUD
+void Overlay_Game(const GameState *game) {
+	uint16_t score[4] = { 0, 0, 0, 0 };
+
+	Ui_SetWindow(0, 0, GRID_WIDTH * ATLAS_TILE_SIZE, HUD_HEIGHT);
+	Overlay_DrawPreview(game);
+	Overlay_SetHud(0, score, 0, 0);
+	Widget_InvalidateAll(&gameScreen);
+	Widget_Render(&gameScreen);
+}
+
+/*
+ * HUD values of the game so far, elapsed in ms. Only fields that change are marked,
+ * Widget_Render then redraws only the digits that differ.
+ */
+void Overlay_SetHud(uint32_t elapsed, const uint16_t *score, uint32_t points, uint32_t pieces) {
+	uint32_t lines = score[0] + 2 * score[1] + 3 * score[2] + 4 * score[3];
+
+	Widget_SetNumber(&gameScreen, HUD_SCORE, points);
+	Widget_SetNumber(&gameScreen, HUD_LINES, lines);
+	Widget_SetNumber(&gameScreen, HUD_LEVEL, lines / HUD_LEVEL_LINES + 1);
+	Widget_SetNumber(&gameScreen, HUD_TIME, elapsed / 1000);
+	// hundredths of a piece per second
+	Widget_SetNumber(&gameScreen, HUD_PPS,
+			(elapsed == 0) ? 0 : (uint32_t) ((uint64_t) pieces * 100000u / elapsed));
+}
+
+// Draw one block as mini cells in a preview slot
+static void Overlay_DrawSlot(uint16_t slotX, uint8_t blockNum) {
+	Ui_Box(slotX, 0, slotX + PREVIEW_SLOT_W - 1, ATLAS_TILE_SIZE - 1, UI_BLACK);
+
+	if (blockNum == NO_BLOCK) {
+		return;
+	}
+
+	const TetrisBlock *block = &tetrisBlocks[blockNum - 1];
+	uint16_t top = (ATLAS_TILE_SIZE - PREVIEW_SLOT_W) / 2;
+
+	for (uint8_t y = 0; y < BLOCK_SIZE; y++) {
+		for (uint8_t x = 0; x < BLOCK_SIZE; x++) {
+			if (block->shape[y][x] == 1) {
+				Ui_Fill(slotX + x * PREVIEW_CELL_SIZE, top + y * PREVIEW_CELL_SIZE,
+						PREVIEW_CELL_SIZE, PREVIEW_CELL_SIZE, blockNum);
+			}
+		}
+	}
+}
+
+// Redraws only the preview panel and hold slot
+void Overlay_DrawPreview(const GameState *game) {
+	Overlay_DrawSlot(HOLD_X, Engine_GetHold(game));
+
+	for (uint8_t i = 0; i < PREVIEW_COUNT; i++) {
+		Overlay_DrawSlot(PREVIEW_X + i * PREVIEW_SLOT_W, Engine_PeekNext(game, i));
+	}
+}
+
+// Results background from flash with the numbers of the game over it
+void Overlay_Results(uint32_t elapsed, const uint16_t *score, uint32_t best) {
+	Screen_Decode(&ScreenResults);
+
+	Widget_SetNumber(&resultsScreen, RESULTS_TIME, elapsed);
+	for (uint8_t i = 0; i < 4; i++) {
+		Widget_SetNumber(&resultsScreen, RESULTS_LINES + i, score[i]);
+	}
+	Widget_SetNumber(&resultsScreen, RESULTS_BEST, best);
+
+	Widget_InvalidateValues(&resultsScreen);
+	Widget_Render(&resultsScreen);
+}
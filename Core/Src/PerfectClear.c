@@ -0,0 +1,244 @@
+/*
+ * PerfectClear.c
+ *
+ *  Created on: Dec 22, 2024
+ *      Author: Will Fraser
+ */
+
+#include "PerfectClear.h"
+
+#include <string.h>
+
+#define FULL_ROW     ((1u << GRID_WIDTH) - 1)
+#define EVEN_COLUMNS (0x555u & FULL_ROW)
+
+static bool PcSolver_Search(PcSolver *solver, const uint16_t *rows, uint8_t height,
+		uint8_t depth, uint8_t next, uint8_t hold);
+
+// Placement_Init has to have run before the first search, the table is cleared per problem
+void PcSolver_Init(PcSolver *solver, uint64_t *table, uint32_t tableSize) {
+	solver->table = table;
+	solver->tableMask = tableSize - 1;
+	solver->clock = NULL;
+	solver->deadline = 0;
+	solver->countAll = false;
+	solver->rootFirst = 0;
+	solver->rootStride = 1;
+}
+
+// The board and the pieces a game shows, the block in play counted from its spawn
+void PcSolver_FromGame(const GameState *game, PcProblem *problem) {
+	memcpy(problem->rows, game->gridRows, sizeof(problem->rows));
+	problem->pieces[0] = game->currentBlockNum;
+	for (uint8_t i = 0; i < PREVIEW_COUNT; i++) {
+		problem->pieces[i + 1] = Engine_PeekNext(game, i);
+	}
+	problem->pieceCount = PREVIEW_COUNT + 1;
+	problem->hold = Engine_GetHold(game);
+	problem->holdUsed = game->holdUsed;
+}
+
+// Every height the pieces can fill from the lowest, true when a clear was found
+bool PcSolver_Solve(PcSolver *solver, const PcProblem *problem) {
+	uint16_t cells = 0;
+	uint8_t top = 0;
+
+	solver->problem = problem;
+	solver->nodes = 0;
+	solver->solutions = 0;
+	solver->timedOut = false;
+	solver->stop = false;
+	solver->height = 0;
+	solver->length = 0;
+	memset(solver->table, 0, (solver->tableMask + 1) * sizeof(solver->table[0]));
+
+	for (uint8_t y = 0; y < GRID_ROWS; y++) {
+		cells += __builtin_popcount(problem->rows[y]);
+		if ((problem->rows[y] != 0) && (top == 0)) {
+			top = GRID_ROWS - y;
+		}
+	}
+
+	for (uint8_t height = (top == 0) ? 1 : top; height <= PC_MAX_HEIGHT; height++) {
+		if ((height * GRID_WIDTH < cells) || ((height * GRID_WIDTH - cells) % BLOCK_SIZE != 0)) {
+			continue;
+		}
+		solver->rootMove = 0;
+		PcSolver_Search(solver, problem->rows, height, 0, 0, problem->hold);
+		if ((solver->solutions != 0) && (solver->height == 0)) {
+			solver->height = height;
+		}
+		if (solver->stop) {
+			break;
+		}
+	}
+	return solver->solutions != 0;
+}
+
+// Room for the pieces and column parity, see PerfectClear.h
+static bool PcSolver_Possible(const PcProblem *problem, const uint16_t *rows, uint8_t height,
+		uint8_t next, uint8_t hold) {
+	uint8_t pool[PC_MAX_PIECES + 1];
+	uint8_t poolCount = 0;
+	int8_t even = 0, odd = 0;
+
+	for (uint8_t y = GRID_ROWS - height; y < GRID_ROWS; y++) {
+		even += __builtin_popcount(~rows[y] & EVEN_COLUMNS);
+		odd += __builtin_popcount(~rows[y] & ~EVEN_COLUMNS & FULL_ROW);
+	}
+	uint8_t count = (even + odd) / BLOCK_SIZE;
+
+	// the pieces the next count placements can come from, one of them can stay in hold
+	if (hold != NO_BLOCK) {
+		pool[poolCount++] = hold;
+	}
+	for (uint8_t i = next; (i < problem->pieceCount) && (poolCount <= count); i++) {
+		pool[poolCount++] = problem->pieces[i];
+	}
+	if (poolCount < count) {
+		return false;
+	}
+
+	int8_t half = (even - odd) / 2;
+	half = (half < 0) ? -half : half;
+	for (uint8_t skip = 0; skip < poolCount; skip++) {
+		uint8_t bars = 0, tees = 0, hooks = 0;
+		for (uint8_t i = 0; i < poolCount; i++) {
+			if ((i == skip) && (poolCount > count)) {
+				continue;
+			}
+			bars += (pool[i] == I_BLOCK);
+			tees += (pool[i] == T_BLOCK);
+			hooks += (pool[i] == J_BLOCK) || (pool[i] == L_BLOCK);
+		}
+		if ((half <= 2 * bars + tees + hooks) && ((tees != 0) || ((half - hooks) % 2 == 0))) {
+			return true;
+		}
+		if (poolCount == count) {
+			break;
+		}
+	}
+	return false;
+}
+
+// The board under the top, the pieces left and the hold slot, never 0
+static uint64_t PcSolver_Key(const uint16_t *rows, uint8_t height, uint8_t next, uint8_t hold) {
+	uint64_t key = 14695981039346656037ull;
+
+	for (uint8_t y = GRID_ROWS - height; y < GRID_ROWS; y++) {
+		key = (key ^ rows[y]) * 1099511628211ull;
+	}
+	key = (key ^ (next | hold << 4 | height << 8)) * 1099511628211ull;
+	return key | 1;
+}
+
+// One piece at every placement under the top, then on to the next
+static bool PcSolver_Place(PcSolver *solver, const uint16_t *rows, uint8_t height,
+		uint8_t depth, uint8_t next, uint8_t hold, const PcStep *step) {
+	Placement *moves = solver->moves[depth];
+	uint8_t top = GRID_ROWS - height;
+	bool found = false;
+
+	Placement_FromSpawn(rows, step->blockNum, &solver->set);
+	uint16_t count = Placement_List(&solver->set, moves, PC_MAX_MOVES);
+
+	for (uint16_t m = 0; (m < count) && !solver->stop; m++) {
+		uint16_t cells[BLOCK_SIZE];
+		uint16_t after[GRID_ROWS];
+		uint8_t cleared = 0;
+
+		if ((depth == 0) && (solver->rootMove++ % solver->rootStride != solver->rootFirst)) {
+			continue;
+		}
+		Placement_Rows(step->blockNum, &moves[m], cells);
+		uint8_t first = 0;
+		while (cells[first] == 0) {
+			first++;
+		}
+		if (moves[m].y + first < top) {
+			continue;
+		}
+
+		// lock the block and drop the rows above any it completes
+		memset(after, 0, sizeof(after));
+		uint8_t write = GRID_ROWS;
+		for (int8_t y = GRID_ROWS - 1; y >= top; y--) {
+			uint16_t row = rows[y];
+			if ((y >= moves[m].y) && (y < moves[m].y + BLOCK_SIZE)) {
+				row |= cells[y - moves[m].y];
+			}
+			if (row == FULL_ROW) {
+				cleared++;
+			} else {
+				after[--write] = row;
+			}
+		}
+
+		solver->path[depth] = *step;
+		solver->path[depth].placement = moves[m];
+		found |= PcSolver_Search(solver, after, height - cleared, depth + 1, next, hold);
+	}
+	return found;
+}
+
+static bool PcSolver_Search(PcSolver *solver, const uint16_t *rows, uint8_t height,
+		uint8_t depth, uint8_t next, uint8_t hold) {
+	const PcProblem *problem = solver->problem;
+
+	if (height == 0) {
+		if (solver->solutions++ == 0) {
+			memcpy(solver->solution, solver->path, depth * sizeof(PcStep));
+			solver->length = depth;
+		}
+		solver->stop = !solver->countAll;
+		return true;
+	}
+
+	solver->nodes++;
+	if ((solver->clock != NULL) && (solver->nodes % PC_CLOCK_EVERY == 0)
+			&& ((int32_t) (solver->clock() - solver->deadline) >= 0)) {
+		solver->timedOut = true;
+		solver->stop = true;
+	}
+	if (solver->stop || !PcSolver_Possible(problem, rows, height, next, hold)) {
+		return false;
+	}
+
+	uint64_t key = PcSolver_Key(rows, height, next, hold);
+	uint64_t *slot = &solver->table[key & solver->tableMask];
+	if ((depth != 0) && (*slot == key)) {
+		return false;
+	}
+
+	// the block in play, or the hold slot in its place, or the one after it with it held
+	bool found = false;
+	bool canHold = (depth != 0) || !problem->holdUsed;
+	PcStep step;
+	if (next < problem->pieceCount) {
+		step.blockNum = problem->pieces[next];
+		step.hold = false;
+		found |= PcSolver_Place(solver, rows, height, depth, next + 1, hold, &step);
+
+		step.hold = true;
+		if (canHold && (hold != NO_BLOCK) && (hold != problem->pieces[next])) {
+			step.blockNum = hold;
+			found |= PcSolver_Place(solver, rows, height, depth, next + 1,
+					problem->pieces[next], &step);
+		} else if (canHold && (hold == NO_BLOCK) && (next + 1 < problem->pieceCount)) {
+			step.blockNum = problem->pieces[next + 1];
+			found |= PcSolver_Place(solver, rows, height, depth, next + 2,
+					problem->pieces[next], &step);
+		}
+	} else if (hold != NO_BLOCK) {
+		// the queue ends here, the held piece swaps with one that is not shown yet
+		step.blockNum = hold;
+		step.hold = true;
+		found |= PcSolver_Place(solver, rows, height, depth, next, NO_BLOCK, &step);
+	}
+
+	// only a search that ran to the end shows there is no clear from here
+	if (!found && !solver->stop) {
+		*slot = key;
+	}
+	return found;
+}
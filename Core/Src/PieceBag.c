@@ -0,0 +1,83 @@
+/*
+ * PieceBag.c
+ *
+ *  Created on: Dec 6, 2024
+ *      Author: Will Fraser
+ */
+
+#include "PieceBag.h"
+
+#define XORSHIFT_DEFAULT_SEED 0x2545F491 // xorshift32 must never hold 0
+
+static void Bag_Refill(PieceBag *bag);
+
+// Uses pooled hardware words, falls back to the PRNG if the pool is ever empty
+void Bag_InitHardware(PieceBag *bag, bool (*readWord)(uint32_t *word)) {
+	uint32_t seed = XORSHIFT_DEFAULT_SEED;
+
+	bag->mode = BAG_MODE_HARDWARE;
+	bag->readWord = readWord;
+	readWord(&seed);
+	bag->state = (seed != 0) ? seed : XORSHIFT_DEFAULT_SEED;
+	Bag_Refill(bag);
+}
+
+// Same seed gives the same piece sequence on every run and on the host
+void Bag_InitSeeded(PieceBag *bag, uint32_t seed) {
+	bag->mode = BAG_MODE_SEEDED;
+	bag->readWord = 0;
+	bag->state = (seed != 0) ? seed : XORSHIFT_DEFAULT_SEED;
+	Bag_Refill(bag);
+}
+
+uint8_t Bag_Next(PieceBag *bag) {
+	if (bag->next >= BAG_SIZE) {
+		Bag_Refill(bag);
+	}
+	return bag->pieces[bag->next++];
+}
+
+// Next random word, never blocks
+static uint32_t Bag_Word(PieceBag *bag) {
+	uint32_t word;
+
+	if ((bag->mode == BAG_MODE_HARDWARE) && bag->readWord(&word)) {
+		return word;
+	}
+
+	// xorshift32
+	word = bag->state;
+	word ^= word << 13;
+	word ^= word >> 17;
+	word ^= word << 5;
+	bag->state = word;
+	return word;
+}
+
+// Uniform value in [0, bound) using multiply-shift with rejection, no modulo bias
+static uint8_t Bag_Below(PieceBag *bag, uint8_t bound) {
+	uint32_t threshold = (uint32_t) (-(uint32_t) bound) % bound;
+
+	while (1) {
+		uint64_t product = (uint64_t) Bag_Word(bag) * bound;
+		if ((uint32_t) product >= threshold) {
+			return (uint8_t) (product >> 32);
+		}
+	}
+}
+
+// Fisher-Yates shuffle of one of each block
+static void Bag_Refill(PieceBag *bag) {
+	for (uint8_t i = 0; i < BAG_SIZE; i++) {
+		bag->pieces[i] = i + 1;
+	}
+
+	for (uint8_t i = BAG_SIZE - 1; i > 0; i--) {
+		uint8_t j = Bag_Below(bag, i + 1);
+		uint8_t temp = bag->pieces[i];
+		bag->pieces[i] = bag->pieces[j];
+		bag->pieces[j] = temp;
+	}
+
+	bag->next = 0;
+}
@@ -0,0 +1,332 @@
+/*
+ * Placement.c
+ *
+ *  Created on: Dec 20, 2024
+ *      Author: Will Fraser
+ */
+
+#include "Placement.h"
+
+#include <string.h>
+
+/*
+ * A board row is widened so bit x + PLACEMENT_X_BIAS is column x, with the columns
+ * off either side set as walls. A block cell in box column c blocks box position x
+ * when that bit of the row under it shifted down by c is set, so the positions a
+ * rotation fits at in a whole row come from one shift per block cell. Rows below the
+ * floor are solid. The box never goes above engine row 0, the engine has no up move.
+ */
+
+#define WALLS (((1u << PLACEMENT_X_BIAS) - 1) | (~0u << (GRID_WIDTH + PLACEMENT_X_BIAS)))
+
+typedef struct {
+	uint8_t rows[BLOCK_SIZE];				// box row masks, bit c = box column c
+	uint8_t cellRow[BLOCK_SIZE];			// the four cells
+	uint8_t cellColumn[BLOCK_SIZE];
+	uint8_t sameAs;							// first rotation with the same cells
+	int8_t shiftX, shiftY;					// box offset to the same cells in sameAs
+} PlacementShape;
+
+static PlacementShape shapes[7][PLACEMENT_ROTATIONS];
+
+// Rotations of every block from tetrisBlocks, turned the way RotateCurrentBlock turns them
+void Placement_Init(void) {
+	for (uint8_t block = 0; block < 7; block++) {
+		uint8_t cells[BLOCK_SIZE][BLOCK_SIZE];
+		int8_t minX[PLACEMENT_ROTATIONS], minY[PLACEMENT_ROTATIONS];
+
+		memcpy(cells, tetrisBlocks[block].shape, sizeof(cells));
+		for (uint8_t r = 0; r < PLACEMENT_ROTATIONS; r++) {
+			PlacementShape *shape = &shapes[block][r];
+			uint8_t count = 0;
+
+			minX[r] = BLOCK_SIZE;
+			minY[r] = BLOCK_SIZE;
+			for (uint8_t y = 0; y < BLOCK_SIZE; y++) {
+				shape->rows[y] = 0;
+				for (uint8_t x = 0; x < BLOCK_SIZE; x++) {
+					if (cells[y][x] == EMPTY_CELL) {
+						continue;
+					}
+					shape->rows[y] |= 1 << x;
+					shape->cellRow[count] = y;
+					shape->cellColumn[count] = x;
+					count++;
+					minX[r] = (x < minX[r]) ? x : minX[r];
+					minY[r] = (y < minY[r]) ? y : minY[r];
+				}
+			}
+
+			// the same cells as an earlier rotation once both are moved to the box corner
+			shape->sameAs = r;
+			shape->shiftX = 0;
+			shape->shiftY = 0;
+			for (uint8_t earlier = 0; earlier < r; earlier++) {
+				const PlacementShape *other = &shapes[block][earlier];
+				bool same = true;
+				for (uint8_t i = 0; i < BLOCK_SIZE; i++) {
+					if ((shape->cellRow[i] - minY[r] != other->cellRow[i] - minY[earlier])
+							|| (shape->cellColumn[i] - minX[r]
+									!= other->cellColumn[i] - minX[earlier])) {
+						same = false;
+					}
+				}
+				if (same) {
+					shape->sameAs = earlier;
+					shape->shiftX = minX[r] - minX[earlier];
+					shape->shiftY = minY[r] - minY[earlier];
+					break;
+				}
+			}
+
+			// rotate right: new[x][3 - y] = old[y][x]
+			uint8_t turned[BLOCK_SIZE][BLOCK_SIZE];
+			for (uint8_t y = 0; y < BLOCK_SIZE; y++) {
+				for (uint8_t x = 0; x < BLOCK_SIZE; x++) {
+					turned[x][BLOCK_SIZE - 1 - y] = cells[y][x];
+				}
+			}
+			memcpy(cells, turned, sizeof(cells));
+		}
+	}
+}
+
+// Box positions in each row a rotation fits at
+static void Placement_Fits(const uint32_t *wide, const PlacementShape *shape,
+		uint16_t fits[GRID_ROWS + 1]) {
+	for (uint8_t y = 0; y < GRID_ROWS; y++) {
+		uint32_t blocked = 0;
+		for (uint8_t i = 0; i < BLOCK_SIZE; i++) {
+			blocked |= wide[y + shape->cellRow[i]] >> shape->cellColumn[i];
+		}
+		fits[y] = ~blocked & PLACEMENT_COLUMNS;
+	}
+	fits[GRID_ROWS] = 0;
+}
+
+// Grow the positions in a row along the open positions next to them
+static uint16_t Placement_Spread(uint16_t reach, uint16_t open) {
+	uint16_t last;
+
+	reach &= open;
+	do {
+		last = reach;
+		reach |= ((reach << 1) | (reach >> 1)) & open;
+	} while (reach != last);
+	return reach;
+}
+
+/*
+ * Fold rotations with the same cells into the first of them and count what is left.
+ * A box that would have to sit above row 0 in the first rotation stays where it is.
+ */
+static uint16_t Placement_Merge(uint8_t blockNum, PlacementSet *set) {
+	const PlacementShape *rotations = shapes[blockNum - 1];
+	uint16_t count = 0;
+
+	for (uint8_t r = 1; r < PLACEMENT_ROTATIONS; r++) {
+		const PlacementShape *shape = &rotations[r];
+		if (shape->sameAs == r) {
+			continue;
+		}
+		for (uint8_t y = 0; y < GRID_ROWS; y++) {
+			if ((set->land[r][y] == 0) || (y + shape->shiftY < 0)) {
+				continue;
+			}
+			set->land[shape->sameAs][y + shape->shiftY] |= (shape->shiftX >= 0) ?
+					set->land[r][y] << shape->shiftX : set->land[r][y] >> -shape->shiftX;
+			set->land[r][y] = 0;
+		}
+	}
+
+	for (uint8_t r = 0; r < PLACEMENT_ROTATIONS; r++) {
+		for (uint8_t y = 0; y < GRID_ROWS; y++) {
+			count += __builtin_popcount(set->land[r][y]);
+		}
+	}
+	set->count = count;
+	return count;
+}
+
+/*
+ * All resting places of a block from start, over the rows as they are in gridRows.
+ * Moves never go up, so one pass from the start row down is enough: the positions
+ * reached in a row come down from the row above, are spread sideways and through
+ * turns until nothing changes, and those that cannot move down any more are where
+ * the block can rest. Returns the number of placements.
+ */
+uint16_t Placement_Generate(const uint16_t *gridRows, uint8_t blockNum, const Placement *start,
+		PlacementSet *set) {
+	const PlacementShape *rotations = shapes[blockNum - 1];
+	uint32_t wide[GRID_ROWS + BLOCK_SIZE];
+	uint16_t fits[PLACEMENT_ROTATIONS][GRID_ROWS + 1];
+	uint16_t reach[PLACEMENT_ROTATIONS] = { 0 };
+
+	for (uint8_t y = 0; y < GRID_ROWS; y++) {
+		wide[y] = ((uint32_t) gridRows[y] << PLACEMENT_X_BIAS) | WALLS;
+	}
+	for (uint8_t y = GRID_ROWS; y < GRID_ROWS + BLOCK_SIZE; y++) {
+		wide[y] = ~0u;
+	}
+	for (uint8_t r = 0; r < PLACEMENT_ROTATIONS; r++) {
+		Placement_Fits(wide, &rotations[r], fits[r]);
+	}
+
+	memset(set->land, 0, sizeof(set->land));
+	reach[start->rotation] = (1u << (start->x + PLACEMENT_X_BIAS))
+			& fits[start->rotation][start->y];
+
+	for (uint8_t y = start->y; y < GRID_ROWS; y++) {
+		bool any = false;
+
+		// down from the row above
+		if (y != start->y) {
+			for (uint8_t r = 0; r < PLACEMENT_ROTATIONS; r++) {
+				reach[r] &= fits[r][y];
+			}
+		}
+
+		// sideways and turns in this row until nothing new is reached
+		bool grew;
+		do {
+			grew = false;
+			for (uint8_t r = 0; r < PLACEMENT_ROTATIONS; r++) {
+				reach[r] = Placement_Spread(reach[r], fits[r][y]);
+				uint8_t right = (r + 1) % PLACEMENT_ROTATIONS;
+				uint8_t left = (r + PLACEMENT_ROTATIONS - 1) % PLACEMENT_ROTATIONS;
+				uint16_t turned = reach[r] & fits[right][y] & ~reach[right];
+				if (turned != 0) {
+					reach[right] |= turned;
+					grew = true;
+				}
+				turned = reach[r] & fits[left][y] & ~reach[left];
+				if (turned != 0) {
+					reach[left] |= turned;
+					grew = true;
+				}
+			}
+		} while (grew);
+
+		for (uint8_t r = 0; r < PLACEMENT_ROTATIONS; r++) {
+			set->land[r][y] = reach[r] & ~fits[r][y + 1];
+			any |= (reach[r] != 0);
+		}
+		if (!any) {
+			break;
+		}
+	}
+
+	return Placement_Merge(blockNum, set);
+}
+
+// One position at a time, cell by cell, as a reference for checks and benchmarks
+static bool Placement_FitsAt(const uint16_t *gridRows, const PlacementShape *shape, int8_t x,
+		int8_t y) {
+	for (uint8_t i = 0; i < BLOCK_SIZE; i++) {
+		int8_t gridX = x + shape->cellColumn[i];
+		int8_t gridY = y + shape->cellRow[i];
+		if ((gridX < 0) || (gridX >= GRID_WIDTH) || (gridY < 0) || (gridY >= GRID_ROWS)
+				|| (gridRows[gridY] & (1 << gridX))) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/*
+ * The same search as Placement_Generate, one position at a time: a breadth first walk
+ * over rotation, column and row with every move tested cell by cell against the grid.
+ * Slower, kept to check the bit masks against and to time them with. Its queue is
+ * static, so unlike the rest of the module it is for one caller at a time.
+ */
+uint16_t Placement_GenerateNaive(const uint16_t *gridRows, uint8_t blockNum,
+		const Placement *start, PlacementSet *set) {
+	static Placement queue[PLACEMENT_ROTATIONS * GRID_ROWS * 16];
+	static uint16_t seen[PLACEMENT_ROTATIONS][GRID_ROWS];
+	const PlacementShape *rotations = shapes[blockNum - 1];
+	uint16_t head = 0, tail = 0;
+
+	memset(set->land, 0, sizeof(set->land));
+	memset(seen, 0, sizeof(seen));
+	if (!Placement_FitsAt(gridRows, &rotations[start->rotation], start->x, start->y)) {
+		return Placement_Merge(blockNum, set);
+	}
+	queue[tail++] = *start;
+	seen[start->rotation][start->y] |= 1 << (start->x + PLACEMENT_X_BIAS);
+
+	while (head != tail) {
+		Placement at = queue[head++];
+		Placement next[5] = {
+			{ at.rotation, at.x - 1, at.y },
+			{ at.rotation, at.x + 1, at.y },
+			{ at.rotation, at.x, at.y + 1 },
+			{ (at.rotation + 1) % PLACEMENT_ROTATIONS, at.x, at.y },
+			{ (at.rotation + PLACEMENT_ROTATIONS - 1) % PLACEMENT_ROTATIONS, at.x, at.y },
+		};
+
+		for (uint8_t i = 0; i < 5; i++) {
+			bool fits = Placement_FitsAt(gridRows, &rotations[next[i].rotation], next[i].x,
+					next[i].y);
+			if ((i == 2) && !fits) {
+				set->land[at.rotation][at.y] |= 1 << (at.x + PLACEMENT_X_BIAS);
+			}
+			uint16_t bit = fits ? 1 << (next[i].x + PLACEMENT_X_BIAS) : 0;
+			if (!fits || (seen[next[i].rotation][next[i].y] & bit)) {
+				continue;
+			}
+			seen[next[i].rotation][next[i].y] |= bit;
+			queue[tail++] = next[i];
+		}
+	}
+
+	return Placement_Merge(blockNum, set);
+}
+
+/*
+ * Placements of a block that would spawn next on this board, as SpawnPiece puts it: a
+ * block that overlaps the stack at the top row is a block out and has no placements,
+ * otherwise it drops one row if it fits there.
+ */
+uint16_t Placement_FromSpawn(const uint16_t *gridRows, uint8_t blockNum, PlacementSet *set) {
+	const PlacementShape *shape = &shapes[blockNum - 1][0];
+	Placement start = { 0, SPAWN_X, 0 };
+
+	if (!Placement_FitsAt(gridRows, shape, start.x, start.y)) {
+		memset(set->land, 0, sizeof(set->land));
+		set->count = 0;
+		return 0;
+	}
+	if (Placement_FitsAt(gridRows, shape, start.x, start.y + 1)) {
+		start.y = 1;
+	}
+	return Placement_Generate(gridRows, blockNum, &start, set);
+}
+
+// The placements as a list, row by row from the top, at most max of them
+uint16_t Placement_List(const PlacementSet *set, Placement *list, uint16_t max) {
+	uint16_t count = 0;
+
+	for (uint8_t y = 0; y < GRID_ROWS; y++) {
+		for (uint8_t r = 0; r < PLACEMENT_ROTATIONS; r++) {
+			uint16_t land = set->land[r][y];
+			while ((land != 0) && (count < max)) {
+				list[count].rotation = r;
+				list[count].x = __builtin_ctz(land) - PLACEMENT_X_BIAS;
+				list[count].y = y;
+				count++;
+				land &= land - 1;
+			}
+		}
+	}
+	return count;
+}
+
+// Grid row masks of the block at a placement, rows y to y + 3
+void Placement_Rows(uint8_t blockNum, const Placement *placement, uint16_t rows[BLOCK_SIZE]) {
+	const PlacementShape *shape = &shapes[blockNum - 1][placement->rotation];
+
+	for (uint8_t i = 0; i < BLOCK_SIZE; i++) {
+		rows[i] = ((uint32_t) shape->rows[i] << (placement->x + PLACEMENT_X_BIAS))
+				>> PLACEMENT_X_BIAS;
+	}
+}
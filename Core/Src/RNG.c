@@ -1,6 +1,11 @@
 #include "RNG.h"
 
-__IO uint32_t aRandom32bit[NB_OF_GENERATED_RANDOM_NUMBERS];
+// ring buffer of random words, filled in the background by HASH_RNG_IRQHandler
+static __IO uint32_t randomPool[RNG_POOL_SIZE];
+static __IO uint8_t poolHead;	// next slot the interrupt writes
+static __IO uint8_t poolTail;	// next slot a reader takes
+
+static void RNG_StartPoolFill(void);
 
 void RNG_Init(void) {
 	LL_AHB2_GRP1_EnableClock(LL_AHB2_GRP1_PERIPH_RNG); // RNG clock
@@ -32,29 +37,72 @@ void RNG_Init(void) {
 	SysTick_Config(168000000 / 1000);
 
 	SystemCoreClock = 168000000;
+
+	// Prefill the pool so the first pieces never wait on the peripheral
+	poolHead = 0;
+	poolTail = 0;
+	HAL_NVIC_SetPriority(HASH_RNG_IRQn, 0x0F, 0x00);
+	HAL_NVIC_EnableIRQ(HASH_RNG_IRQn);
+	RNG_StartPoolFill();
+}
+
+// Turn the RNG and its data ready interrupt on, the IRQ stops it again once the pool is full
+static void RNG_StartPoolFill(void) {
+	LL_RNG_EnableIT(RNG);
+	LL_RNG_Enable(RNG);
 }
 
+// Blocking read, only waits if the pool has been drained
 uint32_t RandomNumbersGeneration(void) {
-	register uint8_t index = 0;
+	uint32_t word;
 
-	// init RNG perhiperal
-	LL_RNG_Enable(RNG);
+	while (!RNG_PoolRead(&word)) {
+	}
 
-	for (index = 0; index < NB_OF_GENERATED_RANDOM_NUMBERS; index++) {
+	return word;
+}
 
-		// wait for DRDY flag
-		while (!LL_RNG_IsActiveFlag_DRDY(RNG)) {
-		}
+// Non-blocking read of one pooled random word, returns false if the pool is empty
+bool RNG_PoolRead(uint32_t *word) {
+	if (poolTail == poolHead) {
+		RNG_StartPoolFill();
+		return false;
+	}
 
-		// read and store 32 bit random num
-		aRandom32bit[index] = LL_RNG_ReadRandData32(RNG);
-		return aRandom32bit[index];
+	*word = randomPool[poolTail & (RNG_POOL_SIZE - 1)];
+	poolTail++;
+
+	// top the pool back up in the background
+	RNG_StartPoolFill();
+
+	return true;
+}
+
+// RNG interrupt, pushes each new word into the pool and stops the peripheral when full
+void HASH_RNG_IRQHandler(void) {
+	// seed or clock error: clear the flag and restart the RNG as per the reference manual
+	if (LL_RNG_IsActiveFlag_SEIS(RNG) || LL_RNG_IsActiveFlag_CEIS(RNG)) {
+		LL_RNG_ClearFlag_SEIS(RNG);
+		LL_RNG_ClearFlag_CEIS(RNG);
+		LL_RNG_Disable(RNG);
+		LL_RNG_Enable(RNG);
+		return;
 	}
 
-	// stop RNG
-	LL_RNG_Disable(RNG);
+	if (LL_RNG_IsActiveFlag_DRDY(RNG)) {
+		uint32_t word = LL_RNG_ReadRandData32(RNG);
 
-	return 0;
+		if ((uint8_t) (poolHead - poolTail) < RNG_POOL_SIZE) {
+			randomPool[poolHead & (RNG_POOL_SIZE - 1)] = word;
+			poolHead++;
+		}
+	}
+
+	// pool full, stop the RNG until a reader takes a word
+	if ((uint8_t) (poolHead - poolTail) >= RNG_POOL_SIZE) {
+		LL_RNG_DisableIT(RNG);
+		LL_RNG_Disable(RNG);
+	}
 }
 
 uint32_t SetSystemToHSI(void) {
@@ -0,0 +1,235 @@
+/*
+ * Replay.c
+ *
+ *  Created on: Dec 8, 2024
+ *      Author: Will Fraser
+ */
+
+#include "Replay.h"
+
+// Recorder ring buffer, drained by Replay_Flush while the game goes on and at its end
+static uint8_t recordBuffer[REPLAY_BUFFER_SIZE];
+static uint32_t recordHead;		// total bytes written
+static uint32_t recordTail;		// total bytes flushed
+static uint32_t recordTime;		// time of the last recorded event
+static bool recording;
+static bool recordOverflow;		// bytes were dropped, the replay is incomplete
+
+static void Replay_PutByte(uint8_t byte) {
+	if (recordHead - recordTail >= REPLAY_BUFFER_SIZE) {
+		recordOverflow = true;
+		return;
+	}
+	recordBuffer[recordHead & (REPLAY_BUFFER_SIZE - 1)] = byte;
+	recordHead++;
+}
+
+// LEB128, 7 bits per byte, high bit set on all but the last byte
+static void Replay_PutVarint(uint32_t value) {
+	while (value >= 0x80) {
+		Replay_PutByte((uint8_t) (value | 0x80));
+		value >>= 7;
+	}
+	Replay_PutByte((uint8_t) value);
+}
+
+static void Replay_PutWord(uint32_t value) {
+	for (uint8_t i = 0; i < 4; i++) {
+		Replay_PutByte((uint8_t) (value >> (i * 8)));
+	}
+}
+
+static void Replay_PutEvent(uint8_t code, uint32_t time) {
+	Replay_PutVarint(((time - recordTime) << 3) | code);
+	recordTime = time;
+}
+
+// Starts a new recording, anything not flushed from the last one is dropped
+void Replay_StartRecording(uint32_t seed) {
+	recordHead = 0;
+	recordTail = 0;
+	recordTime = 0;
+	recordOverflow = false;
+	recording = true;
+
+	for (uint8_t i = 0; i < 4; i++) {
+		Replay_PutByte((uint8_t) REPLAY_MAGIC[i]);
+	}
+	Replay_PutByte(REPLAY_VERSION);
+	Replay_PutWord(seed);
+}
+
+// Time is ms since the start of the game, as passed to Engine_Input
+void Replay_RecordInput(uint8_t input, uint32_t time) {
+	if (recording) {
+		Replay_PutEvent(input, time);
+	}
+}
+
+// Closes the stream with the end time and the final board so the player can check itself
+void Replay_StopRecording(const GameState *game) {
+	if (!recording) {
+		return;
+	}
+
+	const uint16_t *score = Engine_GetScore(game);
+
+	Replay_PutEvent(REPLAY_END, Engine_Elapsed(game));
+	for (uint8_t i = 0; i < 4; i++) {
+		Replay_PutVarint(score[i]);
+	}
+	Replay_PutWord(Engine_BoardHash(game));
+
+	recording = false;
+}
+
+bool Replay_Overflowed(void) {
+	return recordOverflow;
+}
+
+// Bytes recorded and not flushed yet
+uint32_t Replay_Buffered(void) {
+	return recordHead - recordTail;
+}
+
+// Hands everything recorded so far to write, at most two calls when the ring wraps
+void Replay_Flush(void (*write)(const uint8_t *data, uint32_t length)) {
+	while (recordTail != recordHead) {
+		uint32_t start = recordTail & (REPLAY_BUFFER_SIZE - 1);
+		uint32_t length = recordHead - recordTail;
+
+		if (start + length > REPLAY_BUFFER_SIZE) {
+			length = REPLAY_BUFFER_SIZE - start;
+		}
+		write(&recordBuffer[start], length);
+		recordTail += length;
+	}
+}
+
+static bool Replay_GetVarint(ReplayPlayer *player, uint32_t *value) {
+	*value = 0;
+
+	for (uint8_t shift = 0; shift < 35; shift += 7) {
+		if (player->position >= player->length) {
+			return false;
+		}
+		uint8_t byte = player->data[player->position++];
+		*value |= (uint32_t) (byte & 0x7F) << shift;
+		if ((byte & 0x80) == 0) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static bool Replay_GetWord(ReplayPlayer *player, uint32_t *value) {
+	if (player->position + 4 > player->length) {
+		return false;
+	}
+
+	*value = 0;
+	for (uint8_t i = 0; i < 4; i++) {
+		*value |= (uint32_t) player->data[player->position++] << (i * 8);
+	}
+	return true;
+}
+
+// Checks the header, returns false if this is not a replay this build can play
+bool Replay_OpenPlayer(ReplayPlayer *player, const uint8_t *data, uint32_t length) {
+	player->data = data;
+	player->length = length;
+	player->position = 0;
+	player->time = 0;
+	player->ended = false;
+
+	if (length < REPLAY_HEADER_SIZE) {
+		return false;
+	}
+	for (uint8_t i = 0; i < 4; i++) {
+		if (data[i] != (uint8_t) REPLAY_MAGIC[i]) {
+			return false;
+		}
+	}
+	if (data[4] != REPLAY_VERSION) {
+		return false;
+	}
+
+	player->position = 5;
+	return Replay_GetWord(player, &player->seed);
+}
+
+// Next input and its time, returns false at REPLAY_END or if the stream is cut short
+bool Replay_NextEvent(ReplayPlayer *player, uint8_t *input, uint32_t *time) {
+	uint32_t event;
+
+	if (player->ended || !Replay_GetVarint(player, &event)) {
+		return false;
+	}
+
+	player->time += event >> 3;
+	*time = player->time;
+	*input = event & 0x07;
+
+	if (*input == REPLAY_END) {
+		player->ended = true;
+		return false;
+	}
+	return true;
+}
+
+// Recorded outcome, only valid once Replay_NextEvent has reached REPLAY_END
+bool Replay_ReadResult(ReplayPlayer *player, ReplayResult *result) {
+	if (!player->ended) {
+		return false;
+	}
+
+	result->endTime = player->time;
+	for (uint8_t i = 0; i < 4; i++) {
+		if (!Replay_GetVarint(player, &result->score[i])) {
+			return false;
+		}
+	}
+	return Replay_GetWord(player, &result->boardHash);
+}
+
+// Plays a whole replay through the engine as fast as possible and compares the outcome
+bool Replay_Run(GameState *game, const uint8_t *data, uint32_t length,
+		ReplayResult *expected, ReplayResult *actual) {
+	ReplayPlayer player;
+	uint8_t input;
+	uint32_t time;
+
+	if (!Replay_OpenPlayer(&player, data, length)) {
+		return false;
+	}
+
+	// same path as live play, each input goes through Engine_Input at its recorded time
+	Engine_NewGame(game, player.seed);
+	while (Replay_NextEvent(&player, &input, &time)) {
+		Engine_Input(game, input, time);
+	}
+	if (!Replay_ReadResult(&player, expected)) {
+		return false;
+	}
+	Engine_Advance(game, expected->endTime);
+
+	const uint16_t *score = Engine_GetScore(game);
+
+	actual->endTime = Engine_Elapsed(game);
+	for (uint8_t i = 0; i < 4; i++) {
+		actual->score[i] = score[i];
+	}
+	actual->boardHash = Engine_BoardHash(game);
+
+	if (!Engine_IsOver(game) || (actual->endTime != expected->endTime)
+			|| (actual->boardHash != expected->boardHash)) {
+		return false;
+	}
+	for (uint8_t i = 0; i < 4; i++) {
+		if (actual->score[i] != expected->score[i]) {
+			return false;
+		}
+	}
+	return true;
+}
@@ -0,0 +1,224 @@
+/*
+ * ScanSync.c
+ *
+ *  Created on: Dec 15, 2024
+ *      Author: Will Fraser
+ */
+
+#include "ScanSync.h"
+
+#include <string.h>
+
+static uint32_t (*ScanClock)(void);
+static void (*ScanWait)(uint32_t clock);
+static bool chasing;
+static ScanStats stats;
+
+static uint32_t updateStart;		// clock at Scan_Begin
+static uint32_t updateWaited;		// lines of the update spent in ScanWait
+
+// Band announced last, checked against the beam once it is written
+static bool pending;
+static uint16_t pendingTop, pendingBottom;
+static uint32_t pendingStart;
+
+void Scan_Init(uint32_t (*clock)(void), void (*waitUntil)(uint32_t clock)) {
+	ScanClock = clock;
+	ScanWait = waitUntil;
+	chasing = false;
+	pending = false;
+	memset(&stats, 0, sizeof(stats));
+}
+
+// Only takes effect with a clock and a wait to chase the beam with
+void Scan_SetChase(bool enabled) {
+	chasing = enabled && (ScanClock != 0) && (ScanWait != 0);
+}
+
+bool Scan_Chasing(void) {
+	return chasing;
+}
+
+// Framebuffer row the beam is on, negative in the sync and back porch
+static int32_t Scan_Row(uint32_t clock) {
+	return (int32_t) (clock % SCAN_TOTAL_LINES) - SCAN_FIRST_LINE;
+}
+
+// Whether the beam was on any row of [top, bottom) at some point from one clock to the other
+static bool Scan_Crossed(uint16_t top, uint16_t bottom, uint32_t from, uint32_t to) {
+	if (to - from >= SCAN_TOTAL_LINES) {
+		return true;
+	}
+	for (uint32_t clock = from; clock != to + 1; clock++) {
+		int32_t row = Scan_Row(clock);
+		if ((row >= top) && (row < bottom)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+// The last band is written, count it if the beam went over it meanwhile
+static void Scan_Finish(uint32_t now) {
+	if (pending && Scan_Crossed(pendingTop, pendingBottom, pendingStart, now)) {
+		stats.lateBands++;
+	}
+	pending = false;
+}
+
+void Scan_Begin(void) {
+	if (ScanClock == 0) {
+		return;
+	}
+	updateStart = ScanClock();
+	updateWaited = 0;
+}
+
+/*
+ * First of count bands of height rows to draw: the one below the beam when chasing,
+ * the top one otherwise or when the beam is outside the bands.
+ */
+uint8_t Scan_StartBand(uint16_t height, uint8_t count) {
+	if (!chasing) {
+		return 0;
+	}
+
+	int32_t row = Scan_Row(ScanClock());
+	if ((row < 0) || (row / height + 1 >= count)) {
+		return 0;
+	}
+	return row / height + 1;
+}
+
+/*
+ * How many rows at the bottom of [top, bottom) can be written with bytes spread evenly
+ * over the band, before the beam gets to the first of them: either it is above them
+ * and gets there after the write, or it is below the band and has to come round the
+ * next refresh first.
+ */
+static uint16_t Scan_Fit(uint16_t top, uint16_t bottom, uint32_t bytes, uint32_t now) {
+	int32_t row = Scan_Row(now);
+	int32_t span = (row < bottom) ? bottom - row : SCAN_TOTAL_LINES - row + bottom;
+	uint32_t height = bottom - top;
+	uint32_t rows = height;
+
+	// n rows take n * bytes / height / SCAN_BYTES_PER_LINE + SCAN_MARGIN_LINES lines
+	if (span <= SCAN_MARGIN_LINES) {
+		return 0;
+	}
+	if ((uint64_t) (span - SCAN_MARGIN_LINES) * SCAN_BYTES_PER_LINE * height
+			< (uint64_t) rows * (bytes + SCAN_BYTES_PER_LINE * height)) {
+		rows = (uint64_t) (span - SCAN_MARGIN_LINES) * SCAN_BYTES_PER_LINE * height
+				/ (bytes + SCAN_BYTES_PER_LINE * height);
+	}
+	while ((rows != 0) && ((int32_t) (rows + (uint64_t) rows * bytes / height
+			/ SCAN_BYTES_PER_LINE + SCAN_MARGIN_LINES) >= span)) {
+		rows--;
+	}
+	return rows;
+}
+
+// Wait for the beam to leave row bottom, it is in the band or about to be
+static uint32_t Scan_WaitBelow(uint16_t bottom, uint32_t now) {
+	int32_t row = Scan_Row(now);
+	uint32_t distance = (row < bottom) ? bottom - row : SCAN_TOTAL_LINES - row + bottom;
+	uint32_t before = now;
+
+	ScanWait(now + distance);
+	now = ScanClock();
+
+	stats.waits++;
+	stats.waitLines += now - before;
+	updateWaited += now - before;
+	return now;
+}
+
+static void Scan_Pending(uint16_t top, uint16_t bottom, uint32_t bytes, uint32_t now) {
+	pending = true;
+	pendingTop = top;
+	pendingBottom = bottom;
+	pendingStart = now;
+	stats.bands++;
+	stats.bytes += bytes;
+}
+
+/*
+ * Rows [top, bottom) are about to be written with about bytes bytes. When chasing,
+ * wait until the write can be done ahead of the beam, finishing before the beam gets
+ * to top, or behind it, finishing before the next refresh comes back to top.
+ * Otherwise the beam is in the band or about to be, and it leaves at bottom. A band
+ * that does not fit even then is taller than a refresh leaves time for, it is written
+ * anyway and counted, those have to go through Scan_BandPart.
+ */
+void Scan_Band(uint16_t top, uint16_t bottom, uint32_t bytes) {
+	if (ScanClock == 0) {
+		return;
+	}
+
+	uint32_t now = ScanClock();
+	Scan_Finish(now);
+
+	if (chasing && (Scan_Fit(top, bottom, bytes, now) < bottom - top)) {
+		now = Scan_WaitBelow(bottom, now);
+		if (Scan_Fit(top, bottom, bytes, now) < bottom - top) {
+			stats.tallBands++;
+		}
+	}
+	Scan_Pending(top, bottom, bytes, now);
+}
+
+/*
+ * Rows [top, bottom) are about to be written bottom up, as a move down the screen is,
+ * with about bytes bytes. Returns the first row of the part that can be written now
+ * without the beam going over it: the caller writes [part, bottom) and announces
+ * [top, part) next, until part is top. When nothing fits the beam is waited out below
+ * the band, and if the wait ran over, the part is a single row.
+ */
+uint16_t Scan_BandPart(uint16_t top, uint16_t bottom, uint32_t bytes) {
+	if (ScanClock == 0) {
+		return top;
+	}
+
+	uint32_t now = ScanClock();
+	uint16_t rows = bottom - top;
+	Scan_Finish(now);
+
+	if (chasing) {
+		rows = Scan_Fit(top, bottom, bytes, now);
+		if (rows == 0) {
+			now = Scan_WaitBelow(bottom, now);
+			rows = Scan_Fit(top, bottom, bytes, now);
+			rows = (rows == 0) ? 1 : rows;
+		}
+	}
+
+	uint32_t partBytes = (uint64_t) bytes * rows / (bottom - top);
+	Scan_Pending(bottom - rows, bottom, partBytes, now);
+	stats.parts++;
+	stats.partBytes += partBytes;
+	return bottom - rows;
+}
+
+void Scan_End(void) {
+	if (ScanClock == 0) {
+		return;
+	}
+
+	uint32_t now = ScanClock();
+	Scan_Finish(now);
+
+	uint32_t lines = now - updateStart - updateWaited;
+	stats.renderLines += lines;
+	if (lines > stats.maxRenderLines) {
+		stats.maxRenderLines = lines;
+	}
+	stats.updates++;
+}
+
+const ScanStats* Scan_GetStats(void) {
+	return &stats;
+}
+
+void Scan_ResetStats(void) {
+	memset(&stats, 0, sizeof(stats));
+}
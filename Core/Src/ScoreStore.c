@@ -0,0 +1,351 @@
+/*
+ * ScoreStore.c
+ *
+ *  Created on: Dec 10, 2024
+ *      Author: Will Fraser
+ */
+
+#include "ScoreStore.h"
+
+#include <string.h>
+
+#define RECORD_WORDS   (sizeof(ScoreRecord) / 4)
+#define ERASED_WORD    0xFFFFFFFF
+#define NO_RANK        0xFF
+#define PENDING_SIZE   4	// finished games waiting for idle time (power of 2)
+
+/*
+ * Each sector is a log of ScoreRecords. Slot 0 holds a STORE_RECORD_TOTALS header and
+ * slot 1 the STORE_RECORD_LINES that widens its line counts, then the leaderboard carried over as STORE_RECORD_RANKED, then one STORE_RECORD_GAME
+ * per game. When the active sector fills up the other one is erased, the carried over
+ * records are written from slot 1 and the header is written last, so a sector only
+ * becomes valid once it is complete. Alternating sectors spreads the erases over both.
+ */
+
+static const FlashPort *flash;
+
+// RAM index, built once by Store_Init
+static StoreTotals totals;
+static ScoreRecord leaderboard[STORE_LEADERBOARD_SIZE];	// best first
+static uint8_t leaderboardCount;
+static uint8_t lastRank;
+static uint8_t activeSector;
+static uint32_t writeSlot;				// next free slot in the active sector
+static uint32_t nextSequence;
+static uint32_t writtenBestTime;		// longest game actually in flash, pending ones excluded
+
+// Games waiting to be written from idle time
+static ScoreRecord pending[PENDING_SIZE];
+static uint8_t pendingHead;
+static uint8_t pendingTail;
+
+// Standard reflected CRC-32, a nibble at a time to keep the table small
+static uint32_t Store_Crc(const uint8_t *data, uint32_t length) {
+	static const uint32_t table[16] = { 0x00000000, 0x1DB71064, 0x3B6E20C8,
+			0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+			0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0,
+			0x86D3D2D4, 0xA00AE278, 0xBDBDF21C };
+	uint32_t crc = 0xFFFFFFFF;
+
+	for (uint32_t i = 0; i < length; i++) {
+		crc ^= data[i];
+		crc = (crc >> 4) ^ table[crc & 0x0F];
+		crc = (crc >> 4) ^ table[crc & 0x0F];
+	}
+	return ~crc;
+}
+
+static void Store_Seal(ScoreRecord *record) {
+	record->crc = Store_Crc((const uint8_t*) record, sizeof(ScoreRecord) - 4);
+}
+
+static const ScoreRecord* Store_Slot(uint8_t sector, uint32_t slot) {
+	return (const ScoreRecord*) (flash->sector[sector] + slot * sizeof(ScoreRecord));
+}
+
+static bool Store_IsErased(const ScoreRecord *record) {
+	const uint32_t *words = (const uint32_t*) record;
+
+	for (uint8_t i = 0; i < RECORD_WORDS; i++) {
+		if (words[i] != ERASED_WORD) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static bool Store_IsValid(const ScoreRecord *record) {
+	return Store_Crc((const uint8_t*) record, sizeof(ScoreRecord) - 4) == record->crc;
+}
+
+static bool Store_Write(uint8_t sector, uint32_t slot, const ScoreRecord *record) {
+	const uint32_t *words = (const uint32_t*) record;
+
+	for (uint8_t i = 0; i < RECORD_WORDS; i++) {
+		if (!flash->program(sector, slot * sizeof(ScoreRecord) + i * 4, words[i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// Insert into the sorted leaderboard, returns the rank or NO_RANK
+static uint8_t Store_Rank(const ScoreRecord *record) {
+	uint8_t rank = leaderboardCount;
+
+	while ((rank > 0) && (leaderboard[rank - 1].points < record->points)) {
+		rank--;
+	}
+	if (rank >= STORE_LEADERBOARD_SIZE) {
+		return NO_RANK;
+	}
+
+	uint8_t last = (leaderboardCount < STORE_LEADERBOARD_SIZE) ? leaderboardCount :
+			STORE_LEADERBOARD_SIZE - 1;
+	memmove(&leaderboard[rank + 1], &leaderboard[rank],
+			(last - rank) * sizeof(ScoreRecord));
+	leaderboard[rank] = *record;
+	if (leaderboardCount < STORE_LEADERBOARD_SIZE) {
+		leaderboardCount++;
+	}
+	return rank;
+}
+
+static void Store_AddToTotals(const ScoreRecord *record) {
+	totals.games++;
+	totals.timePlayed += record->elapsed;
+	for (uint8_t i = 0; i < 4; i++) {
+		totals.lines[i] += record->lines[i];
+	}
+	if (record->elapsed > totals.bestTime) {
+		totals.bestTime = record->elapsed;
+	}
+}
+
+// Scan the flash once and build the RAM index
+void Store_Init(const FlashPort *port) {
+	uint32_t slots = port->sectorSize / sizeof(ScoreRecord);
+	uint32_t bestHeader = 0;
+	bool found = false;
+
+	flash = port;
+	memset(&totals, 0, sizeof(totals));
+	leaderboardCount = 0;
+	lastRank = NO_RANK;
+	pendingHead = 0;
+	pendingTail = 0;
+	activeSector = 0;
+	writeSlot = 0;
+	nextSequence = 1;
+	writtenBestTime = 0;
+
+	// the valid sector with the newest header is the active one
+	for (uint8_t sector = 0; sector < STORE_SECTORS; sector++) {
+		const ScoreRecord *header = Store_Slot(sector, 0);
+		if (Store_IsValid(header) && (header->type == STORE_RECORD_TOTALS)
+				&& (!found || (header->sequence > bestHeader))) {
+			found = true;
+			bestHeader = header->sequence;
+			activeSector = sector;
+		}
+	}
+
+	if (!found) {
+		// blank or corrupt store, start over in sector 0 on the first write
+		writeSlot = slots;
+		activeSector = STORE_SECTORS - 1;
+		return;
+	}
+
+	const ScoreRecord *header = Store_Slot(activeSector, 0);
+	totals.games = header->points;
+	totals.timePlayed = header->elapsed;
+	totals.bestTime = header->seed;
+	writtenBestTime = header->seed;
+	const ScoreRecord *upper = Store_Slot(activeSector, 1);
+	bool wide = Store_IsValid(upper) && (upper->type == STORE_RECORD_LINES);
+	for (uint8_t i = 0; i < 4; i++) {
+		totals.lines[i] = header->lines[i] | (wide ? (uint32_t) upper->lines[i] << 16 : 0);
+	}
+	nextSequence = header->sequence + 1;
+
+	// replay the log, torn or corrupt records are skipped
+	for (writeSlot = 1; writeSlot < slots; writeSlot++) {
+		const ScoreRecord *record = Store_Slot(activeSector, writeSlot);
+		if (Store_IsErased(record)) {
+			break;
+		}
+		if (!Store_IsValid(record)) {
+			continue;
+		}
+		if (record->type == STORE_RECORD_GAME) {
+			Store_AddToTotals(record);
+			if (record->elapsed > writtenBestTime) {
+				writtenBestTime = record->elapsed;
+			}
+		}
+		if ((record->type == STORE_RECORD_GAME)
+				|| (record->type == STORE_RECORD_RANKED)) {
+			Store_Rank(record);
+		}
+		if (record->sequence >= nextSequence) {
+			nextSequence = record->sequence + 1;
+		}
+	}
+	lastRank = NO_RANK;
+}
+
+// Score used for ranking, the usual 100/300/500/800 per line clear
+uint32_t Store_Points(const uint16_t lines[4]) {
+	return lines[0] * 100u + lines[1] * 300u + lines[2] * 500u + lines[3] * 800u;
+}
+
+// Record a finished game, the index updates now and the flash write waits for Store_Service
+void Store_SubmitGame(uint32_t elapsed, const uint16_t lines[4], uint32_t seed) {
+	ScoreRecord record = { 0 };
+
+	record.type = STORE_RECORD_GAME;
+	record.sequence = nextSequence++;
+	record.elapsed = elapsed;
+	record.seed = seed;
+	for (uint8_t i = 0; i < 4; i++) {
+		record.lines[i] = lines[i];
+	}
+	record.points = Store_Points(lines);
+
+	Store_AddToTotals(&record);
+	lastRank = Store_Rank(&record);
+
+	// if idle time never comes the oldest unwritten game is lost, not the index
+	if ((uint8_t) (pendingHead - pendingTail) >= PENDING_SIZE) {
+		pendingTail++;
+	}
+	pending[pendingHead & (PENDING_SIZE - 1)] = record;
+	pendingHead++;
+}
+
+// Games still waiting in pending are written as STORE_RECORD_GAME later, not carried over
+static bool Store_IsPending(uint32_t sequence) {
+	for (uint8_t i = pendingTail; i != pendingHead; i++) {
+		if (pending[i & (PENDING_SIZE - 1)].sequence == sequence) {
+			return true;
+		}
+	}
+	return false;
+}
+
+// Move to the other sector: erase, carry the leaderboard over, then commit the header
+static bool Store_Rotate(void) {
+	uint8_t sector = (activeSector + 1) % STORE_SECTORS;
+	uint32_t slot = 2;
+	uint32_t lines[4];
+	ScoreRecord record;
+
+	if (!flash->erase(sector)) {
+		return false;
+	}
+
+	// totals cover every game written so far, pending games are not in the log yet
+	memcpy(lines, totals.lines, sizeof(lines));
+	for (uint8_t i = pendingTail; i != pendingHead; i++) {
+		for (uint8_t j = 0; j < 4; j++) {
+			lines[j] -= pending[i & (PENDING_SIZE - 1)].lines[j];
+		}
+	}
+
+	memset(&record, 0, sizeof(record));
+	record.type = STORE_RECORD_LINES;
+	record.sequence = nextSequence++;
+	for (uint8_t i = 0; i < 4; i++) {
+		record.lines[i] = (uint16_t) (lines[i] >> 16);
+	}
+	Store_Seal(&record);
+	if (!Store_Write(sector, 1, &record)) {
+		return false;
+	}
+
+	for (uint8_t rank = 0; rank < leaderboardCount; rank++) {
+		if (Store_IsPending(leaderboard[rank].sequence)) {
+			continue;
+		}
+		record = leaderboard[rank];
+		record.type = STORE_RECORD_RANKED;
+		record.sequence = nextSequence++;
+		Store_Seal(&record);
+		if (!Store_Write(sector, slot++, &record)) {
+			return false;
+		}
+	}
+
+	memset(&record, 0, sizeof(record));
+	record.type = STORE_RECORD_TOTALS;
+	record.sequence = nextSequence++;
+	record.points = totals.games;
+	record.elapsed = totals.timePlayed;
+	record.seed = writtenBestTime;
+	for (uint8_t i = 0; i < 4; i++) {
+		record.lines[i] = (uint16_t) lines[i];
+	}
+	for (uint8_t i = pendingTail; i != pendingHead; i++) {
+		record.points--;
+		record.elapsed -= pending[i & (PENDING_SIZE - 1)].elapsed;
+	}
+	Store_Seal(&record);
+	if (!Store_Write(sector, 0, &record)) {
+		return false;
+	}
+
+	activeSector = sector;
+	writeSlot = slot;
+	return true;
+}
+
+// Call from idle time only, writes at most one pending game, returns true if it wrote
+bool Store_Service(void) {
+	uint32_t slots;
+
+	if ((flash == 0) || (pendingTail == pendingHead)) {
+		return false;
+	}
+
+	slots = flash->sectorSize / sizeof(ScoreRecord);
+	if ((writeSlot >= slots) && !Store_Rotate()) {
+		return false;
+	}
+
+	ScoreRecord *record = &pending[pendingTail & (PENDING_SIZE - 1)];
+	Store_Seal(record);
+
+	// a failed program leaves a torn record that Store_Init skips, move past it
+	bool written = Store_Write(activeSector, writeSlot, record);
+	writeSlot++;
+	if (written) {
+		if (record->elapsed > writtenBestTime) {
+			writtenBestTime = record->elapsed;
+		}
+		pendingTail++;
+	}
+	return written;
+}
+
+bool Store_Pending(void) {
+	return pendingTail != pendingHead;
+}
+
+uint8_t Store_LeaderboardCount(void) {
+	return leaderboardCount;
+}
+
+// Rank 0 is the best game
+const ScoreRecord* Store_LeaderboardEntry(uint8_t rank) {
+	return (rank < leaderboardCount) ? &leaderboard[rank] : 0;
+}
+
+const StoreTotals* Store_GetTotals(void) {
+	return &totals;
+}
+
+// Rank of the last submitted game, 0xFF if it did not make the leaderboard
+uint8_t Store_LastRank(void) {
+	return lastRank;
+}
@@ -0,0 +1,89 @@
+/*
+ * ScreenImage.c
+ *
+ *  Created on: Dec 17, 2024
+ *      Author: Will Fraser
+ */
+
+#include "ScreenImage.h"
+
+#include <string.h>
+
+typedef uint32_t __attribute__((may_alias)) PixelPair;
+
+// count copies of color, two pixels per store in the middle
+static void Screen_Run(uint16_t *pixel, uint32_t count, uint16_t color) {
+	// black and white are one byte repeated, memset has the widest stores
+	if ((color >> 8) == (color & 0xFF)) {
+		memset(pixel, color & 0xFF, count * sizeof(uint16_t));
+		return;
+	}
+	if (((uintptr_t) pixel & 2) && (count != 0)) {
+		*pixel++ = color;
+		count--;
+	}
+
+	PixelPair *pair = (PixelPair*) pixel;
+	uint32_t colorPair = color * 0x00010001u;
+	for (; count >= 2; count -= 2) {
+		*pair++ = colorPair;
+	}
+	if (count != 0) {
+		*(uint16_t*) pair = color;
+	}
+}
+
+// Overlapping copies repeat the pixels between the source and the destination, done
+// a distance at a time so every memcpy reads pixels that are already written
+static void Screen_Copy(uint16_t *pixel, uint32_t distance, uint32_t count) {
+	while (count != 0) {
+		uint32_t chunk = (count < distance) ? count : distance;
+		memcpy(pixel, pixel - distance, chunk * sizeof(uint16_t));
+		pixel += chunk;
+		count -= chunk;
+	}
+}
+
+/*
+ * Write image into frameBuffer from the top left. Commands running past the end of
+ * the screen or the stream are cut short and a copy from before the first pixel ends
+ * the decode, returns whether the stream filled the screen exactly.
+ */
+bool Screen_Decode(const ScreenImage *image) {
+	const uint16_t *word = image->words;
+	const uint16_t *end = image->words + image->length;
+	uint32_t written = 0;
+	bool valid = true;
+
+	while ((word < end) && (written < LCD_PIXELS)) {
+		uint8_t op = *word >> SCREEN_OP_SHIFT;
+		uint32_t count = *word++ & SCREEN_COUNT_MASK;
+		uint16_t *pixel = &frameBuffer[written];
+
+		if (count > LCD_PIXELS - written) {
+			count = LCD_PIXELS - written;
+			valid = false;
+		}
+
+		if (op == SCREEN_LITERAL) {
+			if (count > (uint32_t) (end - word)) {
+				count = end - word;
+				valid = false;
+			}
+			memcpy(pixel, word, count * sizeof(uint16_t));
+			word += count;
+		} else if ((op == SCREEN_RUN) && (word < end)) {
+			Screen_Run(pixel, count, *word++);
+		} else if ((op == SCREEN_COPY) && (word < end)) {
+			uint16_t distance = *word++;
+			if ((distance == 0) || (distance > written)) {
+				return false;
+			}
+			Screen_Copy(pixel, distance, count);
+		} else {
+			return false;
+		}
+		written += count;
+	}
+	return valid && (word == end) && (written == LCD_PIXELS);
+}
@@ -0,0 +1,112 @@
+/*
+ * ScreenImages.c
+ *
+ * Generated by Tools/ScreenGen, do not edit.
+ */
+
+#include "ScreenImage.h"
+
+static const uint16_t TitleWords[267] = {
+		0x40F1, 0x18C3, 0x4012, 0x0000, 0x90CE, 0x0014, 0x41E0, 0x18C3, 0x812E, 0x0320, 0x400E, 0xFFFF,
+		0x0005, 0x0000, 0x0000, 0x18C3, 0x18C3, 0x0000, 0x800E, 0x0015, 0x801B, 0x0028, 0x800E, 0x0026,
+		0x800C, 0x0064, 0x0002, 0xFFFF, 0xFFFF, 0x8010, 0x0078, 0x0005, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+		0xFFFF, 0x80CA, 0x00F0, 0x0001, 0xFFFF, 0x801E, 0x00F0, 0x8018, 0x0118, 0x8078, 0x01F4, 0x800F,
+		0x00A0, 0x0002, 0xFFFF, 0xFFFF, 0x8025, 0x0028, 0x000D, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0x801E, 0x0050, 0x0001, 0xFFFF,
+		0x800C, 0x0017, 0x80C2, 0x00F0, 0x0001, 0x0000, 0x8020, 0x00F0, 0x800D, 0x0018, 0x81DA, 0x00F0,
+		0x8088, 0x05B4, 0x8067, 0x03C0, 0x809A, 0x00F0, 0x8025, 0x0578, 0x8031, 0x05A0, 0x80C9, 0x00F0,
+		0x801F, 0x0050, 0x800F, 0x00F2, 0x80BF, 0x02D0, 0x8013, 0x01B8, 0x8012, 0x00F0, 0x0004, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x8012, 0x0140, 0x80B6, 0x03C0, 0x8024, 0x01E0, 0x8016, 0x03E8, 0x80B7,
+		0x04B0, 0x801F, 0x0A50, 0x801A, 0x05C8, 0x80B7, 0x00F0, 0x8011, 0x0758, 0x8100, 0x00F0, 0x800E,
+		0x0029, 0x80E3, 0x0870, 0x0006, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x809A, 0x04B0,
+		0x8011, 0x0D20, 0x803D, 0x00F0, 0x80A2, 0x0D20, 0x8030, 0x00F0, 0x0003, 0x0000, 0xFFFF, 0xFFFF,
+		0x801C, 0x00F0, 0x0002, 0x0000, 0x0000, 0x8016, 0x07A8, 0x8034, 0x00B4, 0x830E, 0x12C0, 0x8FB2,
+		0x0014, 0x81F4, 0x12C0, 0x4012, 0x4D1F, 0x8016, 0x0014, 0x8028, 0x0244, 0x4012, 0x90E2, 0x803E,
+		0x0014, 0x8014, 0x0064, 0x4012, 0xA514, 0x802A, 0x00A0, 0x8FDC, 0x00F0, 0x81F4, 0x12C0, 0x8064,
+		0x02E4, 0x8050, 0x0014, 0x803C, 0x03C0, 0x8FDC, 0x00F0, 0x8208, 0x12C0, 0x8050, 0x0014, 0x4012,
+		0x0014, 0x8016, 0x0014, 0x8028, 0x02BC, 0x8050, 0x03C0, 0x8FC8, 0x00F0, 0x81F4, 0x12C0, 0x4012,
+		0x4D05, 0x802A, 0x02A8, 0x4012, 0x90F3, 0x8052, 0x02D0, 0x8050, 0x0014, 0x8FDC, 0x00F0, 0x8208,
+		0x12C0, 0x8028, 0x02E4, 0x8028, 0x02D0, 0x803C, 0x0014, 0x4012, 0x9AA3, 0x8052, 0x03C0, 0x8FC8,
+		0x00F0, 0x81F4, 0x12C0, 0x8028, 0x02E4, 0x8028, 0x02D0, 0x803C, 0x02E4, 0x8014, 0x02BC, 0x8028,
+		0x0014, 0x8050, 0x03D4, 0x8FB4, 0x00F0, 0x8208, 0x12C0, 0x90B8, 0x0014, 0xBFFF, 0x12C0, 0x8B01,
+		0x0014, 0xA66F, 0x12C0,
+};
+
+const ScreenImage ScreenTitle = { TitleWords, 267 };
+
+static const uint16_t ResultsWords[847] = {
+		0x7A69, 0x0000, 0x400E, 0xFFFF, 0x8010, 0x0018, 0x8022, 0x0028, 0x0002, 0x0000, 0x0000, 0x800F,
+		0x000F, 0x0001, 0x0000, 0x800F, 0x000F, 0x80A5, 0x00F0, 0x801C, 0x0012, 0x80BE, 0x00F0, 0x8015,
+		0x00A4, 0x0003, 0xFFFF, 0xFFFF, 0xFFFF, 0x8029, 0x00CC, 0x0002, 0xFFFF, 0xFFFF, 0x800F, 0x0016,
+		0x80B2, 0x00F0, 0x800E, 0x01D7, 0x80E4, 0x00F0, 0x8024, 0x001A, 0x80C9, 0x00F0, 0x801B, 0x00BF,
+		0x8012, 0x00CC, 0x0002, 0xFFFF, 0xFFFF, 0x8022, 0x0024, 0x81BB, 0x00F0, 0x0002, 0xFFFF, 0xFFFF,
+		0x801F, 0x0302, 0x82AE, 0x00F0, 0x8014, 0x0883, 0x81A1, 0x00F0, 0x802A, 0x0780, 0x0003, 0xFFFF,
+		0xFFFF, 0xFFFF, 0x8011, 0x000A, 0x80DC, 0x0960, 0x8015, 0x01D6, 0x80DB, 0x0B40, 0x80C8, 0x00F0,
+		0x8013, 0x0D20, 0x802A, 0x03DB, 0x8018, 0x003C, 0x809C, 0x00F0, 0x0001, 0x0000, 0x8011, 0x0F00,
+		0x80CE, 0x00F0, 0x42B6, 0x0000, 0x801C, 0x1194, 0x800F, 0x0028, 0x8012, 0x000C, 0x8018, 0x003B,
+		0x8012, 0x0064, 0x8018, 0x000C, 0x8071, 0x03D1, 0x802B, 0x00F0, 0x800C, 0x047D, 0x8030, 0x00F0,
+		0x8012, 0x003C, 0x0001, 0x0000, 0x807C, 0x04C3, 0x8014, 0x0075, 0x8025, 0x00F0, 0x8029, 0x0154,
+		0x8014, 0x012C, 0x802C, 0x0044, 0x80C3, 0x00F0, 0x801B, 0x007C, 0x8084, 0x00F0, 0x0003, 0x0000,
+		0xFFFF, 0xFFFF, 0x800F, 0x000A, 0x802A, 0x00F0, 0x801C, 0x003C, 0x80F0, 0x00F0, 0x4074, 0x0000,
+		0x8075, 0x00F0, 0x807B, 0x00F1, 0x8039, 0x00F0, 0x8025, 0x0565, 0x8015, 0x003C, 0x0001, 0x0000,
+		0x807C, 0x0A61, 0x8025, 0x00F0, 0x0003, 0x0000, 0xFFFF, 0xFFFF, 0x800C, 0x0009, 0x802D, 0x00F0,
+		0x8012, 0x003C, 0x807D, 0x00F2, 0x8039, 0x00F0, 0x8029, 0x005E, 0x8014, 0x00F0, 0x0003, 0x0000,
+		0x0000, 0x0000, 0x800C, 0x05BC, 0x80E5, 0x00F0, 0x8076, 0x03C9, 0x8026, 0x00F0, 0x0003, 0x0000,
+		0xFFFF, 0xFFFF, 0x800E, 0x174C, 0x802B, 0x00F0, 0x8010, 0x003C, 0x807E, 0x12DD, 0x8164, 0x00F0,
+		0x807C, 0x11ED, 0x8072, 0x00F0, 0x0002, 0x0000, 0xFFFF, 0x8012, 0x00F9, 0x8091, 0x00F0, 0x0004,
+		0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0x800C, 0x001B, 0x8029, 0x0D20, 0x8013, 0x003C, 0x80A1, 0x0D20,
+		0x8050, 0x00F0, 0x0001, 0x0000, 0x8017, 0x1310, 0x7FFF, 0x0000, 0x4E1F, 0x0000, 0x8016, 0x4E33,
+		0x8019, 0x6324, 0x800F, 0x614F, 0x8010, 0x003E, 0x8015, 0x004B, 0x8015, 0x4ED4, 0x8076, 0x4EAB,
+		0x8018, 0x4F5E, 0x801B, 0x65F4, 0x8014, 0x00C9, 0x8031, 0x00F0, 0x8077, 0x508C, 0x8019, 0x5D34,
+		0x8019, 0x56C5, 0x800E, 0x715D, 0x800F, 0x001D, 0x8017, 0x00F0, 0x802B, 0x0078, 0x8061, 0x00F0,
+		0x8017, 0x0095, 0x8022, 0x00F0, 0x8016, 0x01D6, 0x8029, 0x00F0, 0x801B, 0x001D, 0x8085, 0x00F0,
+		0x8011, 0x55E7, 0x800F, 0x7438, 0x80AF, 0x00F0, 0x8022, 0x04B0, 0x800F, 0x00F0, 0x8017, 0x04A7,
+		0x8030, 0x00F0, 0x8072, 0x04AF, 0x8028, 0x00F0, 0x0001, 0x0000, 0x8010, 0x544A, 0x8028, 0x0141,
+		0x801C, 0x03C0, 0x8074, 0x00F1, 0x8028, 0x0690, 0x803A, 0x00F0, 0x8019, 0x774A, 0x8076, 0x562A,
+		0x8025, 0x0690, 0x800D, 0x0005, 0x800F, 0x04B8, 0x800D, 0x623F, 0x8026, 0x00F0, 0x807C, 0x00F2,
+		0x0001, 0x0000, 0x8013, 0x5D34, 0x8015, 0x0870, 0x8015, 0x5CBA, 0x8023, 0x00F0, 0x802B, 0x0078,
+		0x8078, 0x03C9, 0x802A, 0x00F0, 0x8035, 0x04B0, 0x8077, 0x03C9, 0x801A, 0x0919, 0x8016, 0x000F,
+		0x8019, 0x621E, 0x802F, 0x00F0, 0x8078, 0x5CBC, 0x803B, 0x00F0, 0x8019, 0x6C98, 0x809E, 0x00F0,
+		0x8018, 0x0919, 0x8017, 0x000F, 0x800E, 0x66D9, 0x803B, 0x00F0, 0x8077, 0x5DAC, 0x8019, 0x5D34,
+		0x8022, 0x00F0, 0x800F, 0x69E6, 0x802E, 0x03C0, 0x8079, 0x5DAC, 0x8029, 0x0D20, 0x8013, 0x01D6,
+		0x801D, 0x0CF8, 0x8015, 0x0027, 0x8081, 0x0D20, 0x0002, 0x0000, 0x0000, 0x8025, 0x7044, 0x802C,
+		0x0F00, 0x8026, 0x00F0, 0x8018, 0x0078, 0x432E, 0x0000, 0x801A, 0x04AE, 0x8019, 0x1297, 0x8012,
+		0x823D, 0x801C, 0x03F8, 0x8020, 0x03C0, 0x8078, 0x00F0, 0x8022, 0x0474, 0x801A, 0x00F0, 0x8035,
+		0x13B0, 0x8076, 0x05A0, 0x8015, 0x0A1D, 0x8014, 0x77D8, 0x801C, 0x000A, 0x8022, 0x00F0, 0x8015,
+		0x0169, 0x8019, 0x001C, 0x8063, 0x00F0, 0x800F, 0x01B7, 0x8012, 0x000B, 0x801D, 0x00FA, 0x801F,
+		0x7D78, 0x808B, 0x11D0, 0x801E, 0x01C1, 0x8015, 0x0097, 0x80C7, 0x00F0, 0x801F, 0x0DE8, 0x8059,
+		0x00F0, 0x8070, 0x04B0, 0x8043, 0x00F0, 0x803C, 0x03C0, 0x80AE, 0x00F0, 0x8021, 0x7644, 0x800E,
+		0x0028, 0x8082, 0x12C0, 0x8046, 0x00F0, 0x802A, 0x0690, 0x8013, 0x0017, 0x80B2, 0x02D0, 0x8034,
+		0x03C0, 0x0006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8071, 0x12C0, 0x8046, 0x00F0,
+		0x801F, 0x10AF, 0x809E, 0x12C0, 0x8065, 0x00F0, 0x8082, 0x12C0, 0x803C, 0x0780, 0x80C0, 0x00F0,
+		0x8030, 0x0960, 0x8034, 0x00F0, 0x8076, 0x12C0, 0x8029, 0x0B40, 0x8014, 0x02EF, 0x803E, 0x0870,
+		0x8075, 0x12C0, 0x8029, 0x0D20, 0x801F, 0x11A8, 0x8028, 0x0028, 0x8082, 0x0D20, 0x8027, 0x0F00,
+		0x8014, 0x0014, 0x801C, 0x0756, 0x8370, 0x12C0, 0x0001, 0xFFFF, 0x800E, 0x182D, 0x8028, 0x24A4,
+		0x80B0, 0x2580, 0x801F, 0x00F0, 0x8022, 0x23B4, 0x8013, 0x05A0, 0x8026, 0x00F0, 0x808A, 0x760C,
+		0x8015, 0x087A, 0x8016, 0x00F0, 0x8013, 0x0028, 0x809F, 0x2580, 0x801D, 0x00F0, 0x8027, 0x1C34,
+		0x801C, 0x0033, 0x801A, 0x00F0, 0x801B, 0x001D, 0x81CC, 0x00F0, 0x4074, 0x0000, 0x8040, 0x03C0,
+		0x8035, 0x00F0, 0x8089, 0x832C, 0x802B, 0x05A0, 0x8013, 0x0018, 0x80A2, 0x2580, 0x801A, 0x00F0,
+		0x801F, 0x01A9, 0x8033, 0x0690, 0x8013, 0x0017, 0x8088, 0x02D0, 0x8024, 0x2774, 0x8028, 0x14A0,
+		0x801B, 0x007A, 0x808A, 0x04B0, 0x802B, 0x1FF4, 0x8039, 0x00F0, 0x8076, 0x03C9, 0x8028, 0x263B,
+		0x804A, 0x00F0, 0x8078, 0x11D0, 0x801D, 0x00F0, 0x8023, 0x2D14, 0x812A, 0x00F0, 0x808A, 0x832C,
+		0x8033, 0x0870, 0x8032, 0x03C0, 0x8079, 0x2580, 0x8052, 0x00F0, 0x80A0, 0x2580, 0x801B, 0x00F0,
+		0x8020, 0x9998, 0x803B, 0x00F0, 0x0001, 0x0000, 0x8359, 0x12C0, 0x8014, 0x0370, 0x803D, 0x12E8,
+		0x0002, 0x0000, 0x0000, 0x8026, 0x38A4, 0x80AA, 0x00F0, 0x801E, 0x07A8, 0x8028, 0x2B84, 0x806B,
+		0x00F6, 0x8026, 0x0087, 0x8039, 0x0F28, 0x8026, 0x38A4, 0x80A9, 0x00F0, 0x8028, 0x07A8, 0x8020,
+		0x0208, 0x81C0, 0x00F0, 0x8082, 0x04B0, 0x806D, 0x03C0, 0x809A, 0x00F0, 0x8025, 0x0578, 0x8031,
+		0x05A0, 0x80C9, 0x00F0, 0x8022, 0x00C8, 0x80CB, 0x0690, 0x8029, 0x01B8, 0x8022, 0x0208, 0x80A6,
+		0x03C0, 0x8024, 0x01E0, 0x8025, 0x03E8, 0x80A7, 0x00F0, 0x8020, 0x0848, 0x8029, 0x05C8, 0x80A8,
+		0x00F0, 0x801F, 0x0758, 0x80F2, 0x00F0, 0x8090, 0xA7C5, 0x8061, 0x0870, 0x807B, 0x12AC, 0x8025,
+		0x00F0, 0x8017, 0x066B, 0x8038, 0x02A8, 0x80A1, 0x0D20, 0x8030, 0x00F0, 0x8021, 0xB3DC, 0x8028,
+		0x07A8, 0x55F1, 0x0000, 0x801E, 0x3BC3, 0x801D, 0x37F0, 0x8015, 0x24CC, 0x80A8, 0x00F0, 0x8016,
+		0x3DA3, 0x801D, 0x2AD0, 0x80B7, 0x00F0, 0x800E, 0x0008, 0x8010, 0x000C, 0x0007, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8092, 0x2544, 0x803F, 0x00F0, 0x8020, 0x2F62, 0x8091,
+		0x2454, 0x8158, 0x00F0, 0x8029, 0x0019, 0x80C6, 0x03C0, 0x80C2, 0x00F0, 0x801C, 0x437F, 0x8023,
+		0x37F0, 0x80B8, 0x00F0, 0x8016, 0x0690, 0x8013, 0x002B, 0x80C6, 0x02D0, 0x8027, 0x3502, 0x808A,
+		0x2544, 0x8040, 0x00F0, 0x8028, 0xCA1B, 0x8088, 0x2544, 0x805E, 0x00F0, 0x8092, 0x2454, 0x8150,
+		0x00F0, 0x8027, 0x5DE8, 0x80A9, 0x00F0, 0x8021, 0x0870, 0x8026, 0x5DE8, 0x80A2, 0x00F0, 0x803F,
+		0x37F0, 0x80CE, 0x0870, 0x8022, 0x37F0, 0x943D, 0x2544,
+};
+
+const ScreenImage ScreenResults = { ResultsWords, 847 };
+
@@ -0,0 +1,199 @@
+/*
+ * Snapshot.c
+ *
+ *  Created on: Dec 25, 2024
+ *      Author: Will Fraser
+ */
+
+#include "Snapshot.h"
+
+#include <string.h>
+
+#define X_BIAS (BLOCK_SIZE - 1)		// the box can sit up to 3 columns off the left wall
+
+typedef struct {
+	uint8_t *bytes;
+	uint16_t position;				// in bits
+} SnapshotWriter;
+
+typedef struct {
+	const uint8_t *bytes;
+	uint16_t position;
+} SnapshotReader;
+
+_Static_assert(SNAPSHOT_SIZE < 128, "a snapshot has to stay under 128 bytes");
+
+static void Snapshot_Put(SnapshotWriter *writer, uint32_t value, uint8_t bits);
+static uint32_t Snapshot_Get(SnapshotReader *reader, uint8_t bits);
+static uint16_t Snapshot_RankBag(const uint8_t *pieces);
+static void Snapshot_UnrankBag(uint16_t rank, uint8_t *pieces);
+
+// False if the game cannot be kept in a snapshot, it is then left as it was
+bool Snapshot_Save(const GameState *game, Snapshot *snapshot) {
+	SnapshotWriter writer = { snapshot->bytes, 0 };
+	uint32_t gravity = game->nextGravity - game->engineTime;
+	uint16_t cells = 0;
+
+	for (uint8_t y = 0; y < GRID_ROWS; y++) {
+		cells += __builtin_popcount(game->gridRows[y]);
+	}
+	if ((game->pieceBag.mode != BAG_MODE_SEEDED) || (gravity >= (1u << SNAPSHOT_GRAVITY_BITS))
+			|| (cells > SNAPSHOT_MAX_CELLS) || (game->currentBlockY < 0)) {
+		return false;
+	}
+
+	memset(snapshot->bytes, 0, SNAPSHOT_SIZE);
+	Snapshot_Put(&writer, game->engineTime, 32);
+	Snapshot_Put(&writer, gravity, SNAPSHOT_GRAVITY_BITS);
+	for (uint8_t i = 0; i < 4; i++) {
+		Snapshot_Put(&writer, game->score[i], 16);
+	}
+
+	Snapshot_Put(&writer, game->pieceBag.state, 32);
+	Snapshot_Put(&writer, Snapshot_RankBag(game->pieceBag.pieces), 13);
+	Snapshot_Put(&writer, game->pieceBag.next, 3);
+
+	Snapshot_Put(&writer, game->holdUsed, 1);
+	Snapshot_Put(&writer, game->softDrop, 1);
+	Snapshot_Put(&writer, game->gameOver, 1);
+	Snapshot_Put(&writer, game->holdBlock, 3);
+	for (uint8_t i = 0; i < PREVIEW_COUNT; i++) {
+		Snapshot_Put(&writer, Engine_PeekNext(game, i), 3);
+	}
+
+	Snapshot_Put(&writer, game->currentBlockNum, 3);
+	Snapshot_Put(&writer, game->currentBlockX + X_BIAS, 4);
+	Snapshot_Put(&writer, game->currentBlockY, 5);
+	Snapshot_Put(&writer, Engine_CurrentBox(game), BLOCK_SIZE * BLOCK_SIZE);
+
+	for (uint8_t y = 0; y < GRID_ROWS; y++) {
+		Snapshot_Put(&writer, game->gridRows[y], GRID_WIDTH);
+	}
+	for (uint8_t y = 0; y < GRID_ROWS; y++) {
+		for (uint16_t row = game->gridRows[y]; row != 0; row &= row - 1) {
+			Snapshot_Put(&writer, game->gameGrid[y][__builtin_ctz(row)], 3);
+		}
+	}
+	return true;
+}
+
+/*
+ * The game as it was saved. Row masks, stack features, hashes and the queue's spawn
+ * checks come from Engine_Rebuild, the screen is told everything changed and the
+ * clear in progress, if any, is forgotten.
+ */
+void Snapshot_Restore(GameState *game, const Snapshot *snapshot) {
+	SnapshotReader reader = { snapshot->bytes, 0 };
+
+	game->engineTime = Snapshot_Get(&reader, 32);
+	game->nextGravity = game->engineTime + Snapshot_Get(&reader, SNAPSHOT_GRAVITY_BITS);
+	for (uint8_t i = 0; i < 4; i++) {
+		game->score[i] = Snapshot_Get(&reader, 16);
+	}
+
+	game->pieceBag.mode = BAG_MODE_SEEDED;
+	game->pieceBag.readWord = 0;
+	game->pieceBag.state = Snapshot_Get(&reader, 32);
+	Snapshot_UnrankBag(Snapshot_Get(&reader, 13), game->pieceBag.pieces);
+	game->pieceBag.next = Snapshot_Get(&reader, 3);
+
+	game->holdUsed = Snapshot_Get(&reader, 1);
+	game->softDrop = Snapshot_Get(&reader, 1);
+	game->gameOver = Snapshot_Get(&reader, 1);
+	game->endTime = game->gameOver ? game->engineTime : 0;	// nothing moves the clock after
+	game->holdBlock = Snapshot_Get(&reader, 3);
+	game->nextHead = 0;
+	for (uint8_t i = 0; i < PREVIEW_COUNT; i++) {
+		game->nextQueue[i].blockNum = Snapshot_Get(&reader, 3);
+	}
+
+	game->currentBlockNum = Snapshot_Get(&reader, 3);
+	game->currentBlockX = (int8_t) Snapshot_Get(&reader, 4) - X_BIAS;
+	game->currentBlockY = Snapshot_Get(&reader, 5);
+	uint16_t box = Snapshot_Get(&reader, BLOCK_SIZE * BLOCK_SIZE);
+	memset(game->currentBlock, EMPTY_CELL, sizeof(game->currentBlock));
+	for (int8_t y = 0; y < BLOCK_SIZE; y++) {
+		for (int8_t x = 0; x < BLOCK_SIZE; x++) {
+			if (box & (1 << (y * BLOCK_SIZE + x))) {
+				game->currentBlock[game->currentBlockY + y][game->currentBlockX + x] =
+						game->currentBlockNum;
+			}
+		}
+	}
+
+	uint16_t rows[GRID_ROWS];
+	for (uint8_t y = 0; y < GRID_ROWS; y++) {
+		rows[y] = Snapshot_Get(&reader, GRID_WIDTH);
+	}
+	memset(game->gameGrid, EMPTY_CELL, sizeof(game->gameGrid));
+	uint32_t placedCells = 0;
+	for (uint8_t y = 0; y < GRID_ROWS; y++) {
+		for (uint16_t row = rows[y]; row != 0; row &= row - 1) {
+			game->gameGrid[y][__builtin_ctz(row)] = Snapshot_Get(&reader, 3);
+			placedCells++;
+		}
+	}
+
+	// every block put 4 cells down and every line took 12 away
+	uint32_t lines = game->score[0] + 2 * game->score[1] + 3 * game->score[2] + 4 * game->score[3];
+	game->piecesPlaced = (placedCells + GRID_WIDTH * lines) / BLOCK_SIZE;
+
+	Engine_Rebuild(game);
+	game->changes = ENGINE_CHANGED_GRID | ENGINE_CHANGED_QUEUE;
+	game->clearedRows = 0;
+}
+
+bool Snapshot_Equal(const Snapshot *a, const Snapshot *b) {
+	return memcmp(a->bytes, b->bytes, SNAPSHOT_SIZE) == 0;
+}
+
+static void Snapshot_Put(SnapshotWriter *writer, uint32_t value, uint8_t bits) {
+	for (uint8_t i = 0; i < bits; i++, writer->position++) {
+		if (value & (1u << i)) {
+			writer->bytes[writer->position >> 3] |= 1 << (writer->position & 7);
+		}
+	}
+}
+
+static uint32_t Snapshot_Get(SnapshotReader *reader, uint8_t bits) {
+	uint32_t value = 0;
+
+	for (uint8_t i = 0; i < bits; i++, reader->position++) {
+		if (reader->bytes[reader->position >> 3] & (1 << (reader->position & 7))) {
+			value |= 1u << i;
+		}
+	}
+	return value;
+}
+
+// Lehmer code of the bag order, 7! = 5040 orders in 13 bits
+static uint16_t Snapshot_RankBag(const uint8_t *pieces) {
+	uint16_t rank = 0;
+
+	for (uint8_t i = 0; i < BAG_SIZE; i++) {
+		uint8_t smaller = 0;
+		for (uint8_t j = i + 1; j < BAG_SIZE; j++) {
+			smaller += pieces[j] < pieces[i];
+		}
+		rank = rank * (BAG_SIZE - i) + smaller;
+	}
+	return rank;
+}
+
+static void Snapshot_UnrankBag(uint16_t rank, uint8_t *pieces) {
+	uint8_t digits[BAG_SIZE];
+	bool used[BAG_SIZE + 1] = { false };
+
+	for (int8_t i = BAG_SIZE - 1; i >= 0; i--) {
+		digits[i] = rank % (BAG_SIZE - i);
+		rank /= BAG_SIZE - i;
+	}
+	for (uint8_t i = 0; i < BAG_SIZE; i++) {
+		uint8_t block = 0;
+		for (uint8_t skip = digits[i] + 1; skip > 0; skip -= !used[block]) {
+			block++;
+		}
+		used[block] = true;
+		pieces[i] = block;
+	}
+}
@@ -0,0 +1,118 @@
+/*
+ * TileAtlas.c
+ *
+ *  Created on: Dec 12, 2024
+ *      Author: Will Fraser
+ */
+
+#include "TileAtlas.h"
+
+#include <string.h>
+
+/*
+ * Every cell of one color looks the same, so each one is rendered once by Atlas_Init
+ * and drawing a cell is a row copy per line. The tiles are only ever read by the CPU,
+ * so they live in CCM RAM where they do not compete with the LTDC for SRAM. The
+ * section is NOLOAD, so the tiles take no room in flash and the startup code neither
+ * copies nor clears them: Atlas_Init must run before any drawing.
+ */
+
+#define ATLAS_SECTION __attribute__((section(".ccmnoload")))
+
+#define TILE_PIXELS (ATLAS_TILE_SIZE * ATLAS_TILE_SIZE)
+
+// Color of each cell value, EMPTY_CELL then I_BLOCK..L_BLOCK
+static const uint16_t blockColors[ATLAS_COLORS] = { LCD_COLOR_BLACK, I_BLOCK_COLOR,
+		O_BLOCK_COLOR, T_BLOCK_COLOR, S_BLOCK_COLOR, Z_BLOCK_COLOR,
+		J_BLOCK_COLOR, L_BLOCK_COLOR };
+
+static uint16_t cellTiles[ATLAS_COLORS][TILE_PIXELS] ATLAS_SECTION;
+static uint16_t ghostTiles[ATLAS_COLORS][TILE_PIXELS] ATLAS_SECTION;
+static uint16_t miniTiles[ATLAS_COLORS][ATLAS_MINI_SIZE * ATLAS_MINI_SIZE] ATLAS_SECTION;
+
+#ifdef ATLAS_BEVEL
+// Move each RGB565 channel towards white (amount > 0) or black (amount < 0) in eighths
+static uint16_t Atlas_Shade(uint16_t color, int8_t amount) {
+	int16_t red = color >> 11, green = (color >> 5) & 0x3F, blue = color & 0x1F;
+
+	if (amount > 0) {
+		red += (0x1F - red) * amount / 8;
+		green += (0x3F - green) * amount / 8;
+		blue += (0x1F - blue) * amount / 8;
+	} else {
+		red += red * amount / 8;
+		green += green * amount / 8;
+		blue += blue * amount / 8;
+	}
+	return (uint16_t) ((red << 11) | (green << 5) | blue);
+}
+#endif
+
+// The same cell LCD_Draw_Rectangle_Fill draws, a grey border around the color
+static void Atlas_BuildCell(uint16_t *tile, uint16_t color) {
+	for (uint16_t y = 0; y < ATLAS_TILE_SIZE; y++) {
+		for (uint16_t x = 0; x < ATLAS_TILE_SIZE; x++) {
+			uint16_t pixel = color;
+			if ((x == 0) || (y == 0) || (x == ATLAS_TILE_SIZE - 1)
+					|| (y == ATLAS_TILE_SIZE - 1)) {
+				pixel = LCD_COLOR_GREY;
+			}
+#ifdef ATLAS_BEVEL
+			// lit from the top left, empty cells stay flat
+			else if ((color != LCD_COLOR_BLACK) && ((x <= 2) || (y <= 2))) {
+				pixel = Atlas_Shade(color, 4);
+			} else if ((color != LCD_COLOR_BLACK)
+					&& ((x >= ATLAS_TILE_SIZE - 3) || (y >= ATLAS_TILE_SIZE - 3))) {
+				pixel = Atlas_Shade(color, -3);
+			}
+#endif
+			tile[y * ATLAS_TILE_SIZE + x] = pixel;
+		}
+	}
+}
+
+// Ghost of the falling block: an empty cell with a ring of the block color inside the border
+static void Atlas_BuildGhost(uint16_t *tile, uint16_t color) {
+	Atlas_BuildCell(tile, LCD_COLOR_BLACK);
+	for (uint16_t i = 2; i < ATLAS_TILE_SIZE - 2; i++) {
+		tile[2 * ATLAS_TILE_SIZE + i] = color;
+		tile[(ATLAS_TILE_SIZE - 3) * ATLAS_TILE_SIZE + i] = color;
+		tile[i * ATLAS_TILE_SIZE + 2] = color;
+		tile[i * ATLAS_TILE_SIZE + ATLAS_TILE_SIZE - 3] = color;
+	}
+}
+
+void Atlas_Init(void) {
+	for (uint8_t i = 0; i < ATLAS_COLORS; i++) {
+		Atlas_BuildCell(cellTiles[i], blockColors[i]);
+		Atlas_BuildGhost(ghostTiles[i], blockColors[i]);
+		for (uint8_t p = 0; p < ATLAS_MINI_SIZE * ATLAS_MINI_SIZE; p++) {
+			miniTiles[i][p] = blockColors[i];
+		}
+	}
+}
+
+uint16_t Atlas_Color(uint8_t blockNum) {
+	return blockColors[blockNum & (ATLAS_COLORS - 1)];
+}
+
+// One row copy per line, x is kept even by callers so the copies stay word aligned
+static inline void Atlas_Blit(uint16_t x, uint16_t y, const uint16_t *tile, uint16_t size) {
+	uint16_t *line = &frameBuffer[y * LCD_PIXEL_WIDTH + x];
+
+	for (uint16_t row = 0; row < size; row++, line += LCD_PIXEL_WIDTH, tile += size) {
+		memcpy(line, tile, size * sizeof(uint16_t));
+	}
+}
+
+void Atlas_DrawCell(uint16_t x, uint16_t y, uint8_t blockNum) {
+	Atlas_Blit(x, y, cellTiles[blockNum & (ATLAS_COLORS - 1)], ATLAS_TILE_SIZE);
+}
+
+void Atlas_DrawGhost(uint16_t x, uint16_t y, uint8_t blockNum) {
+	Atlas_Blit(x, y, ghostTiles[blockNum & (ATLAS_COLORS - 1)], ATLAS_TILE_SIZE);
+}
+
+void Atlas_DrawMini(uint16_t x, uint16_t y, uint8_t blockNum) {
+	Atlas_Blit(x, y, miniTiles[blockNum & (ATLAS_COLORS - 1)], ATLAS_MINI_SIZE);
+}
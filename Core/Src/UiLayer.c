@@ -0,0 +1,178 @@
+/*
+ * UiLayer.c
+ *
+ *  Created on: Dec 14, 2024
+ *      Author: Will Fraser
+ */
+
+#include "UiLayer.h"
+#include "GlyphMasks.h"
+
+#include <string.h>
+
+uint8_t uiBuffer[UI_LAYER_BYTES] __attribute__((aligned(4)));
+UiWindow uiWindow;
+
+// RGB565 of each palette index, the same colors the single layer screens used
+static const uint16_t uiColors[UI_PALETTE_SIZE] = { 0, I_BLOCK_COLOR,
+		O_BLOCK_COLOR, T_BLOCK_COLOR, S_BLOCK_COLOR, Z_BLOCK_COLOR, J_BLOCK_COLOR,
+		L_BLOCK_COLOR, LCD_COLOR_BLACK, LCD_COLOR_WHITE, LCD_COLOR_GREY,
+		LCD_COLOR_GREEN };
+
+static FONT_t *UiFont;
+static const GlyphSet *UiGlyphs;
+static uint8_t UiTextColor = UI_WHITE;
+
+/*
+ * Move the window and clear it. Returns false, leaving the window as it was, when
+ * the window does not fit in uiBuffer or on the screen.
+ */
+bool Ui_SetWindow(uint16_t x, uint16_t y, uint16_t width, uint16_t height) {
+	if (((uint32_t) width * height > UI_LAYER_BYTES) || (width == 0) || (height == 0)
+			|| (x + width > LCD_PIXEL_WIDTH) || (y + height > LCD_PIXEL_HEIGHT)) {
+		return false;
+	}
+
+	uiWindow.x = x;
+	uiWindow.y = y;
+	uiWindow.width = width;
+	uiWindow.height = height;
+	uiWindow.visible = true;
+	memset(uiBuffer, UI_CLEAR, (uint32_t) width * height);
+	return true;
+}
+
+void Ui_Hide(void) {
+	uiWindow.visible = false;
+}
+
+// The LTDC widens RGB565 by repeating the top bits of each channel, the CLUT matches it
+uint32_t Ui_ExpandRGB565(uint16_t color) {
+	uint32_t red = color >> 11, green = (color >> 5) & 0x3F, blue = color & 0x1F;
+
+	red = (red << 3) | (red >> 2);
+	green = (green << 2) | (green >> 4);
+	blue = (blue << 3) | (blue >> 2);
+	return (red << 16) | (green << 8) | blue;
+}
+
+// CLUT entry of a palette index
+uint32_t Ui_PaletteRGB(uint8_t index) {
+	if ((index == UI_CLEAR) || (index >= UI_PALETTE_SIZE)) {
+		return UI_KEY_RGB;
+	}
+	return Ui_ExpandRGB565(uiColors[index]);
+}
+
+void Ui_Fill(int16_t x, int16_t y, uint16_t width, uint16_t height, uint8_t index) {
+	int16_t left = x - uiWindow.x, top = y - uiWindow.y;
+	int16_t right = left + width, bottom = top + height;
+
+	if (left < 0) {
+		left = 0;
+	}
+	if (top < 0) {
+		top = 0;
+	}
+	if (right > uiWindow.width) {
+		right = uiWindow.width;
+	}
+	if (bottom > uiWindow.height) {
+		bottom = uiWindow.height;
+	}
+	if ((left >= right) || (top >= bottom)) {
+		return;
+	}
+
+	uint8_t *line = &uiBuffer[top * uiWindow.width + left];
+	for (int16_t row = top; row < bottom; row++, line += uiWindow.width) {
+		memset(line, index, right - left);
+	}
+}
+
+// Same box as LCD_Draw_Rectangle_Fill, corners inclusive with a grey border
+void Ui_Box(int16_t X1, int16_t Y1, int16_t X2, int16_t Y2, uint8_t index) {
+	int16_t startX = (X1 < X2) ? X1 : X2, endX = (X1 < X2) ? X2 : X1;
+	int16_t startY = (Y1 < Y2) ? Y1 : Y2, endY = (Y1 < Y2) ? Y2 : Y1;
+
+	Ui_Fill(startX, startY, endX - startX + 1, endY - startY + 1, UI_GREY);
+	if ((endX - startX > 1) && (endY - startY > 1)) {
+		Ui_Fill(startX + 1, startY + 1, endX - startX - 1, endY - startY - 1, index);
+	}
+}
+
+// Only the fonts with masks in GlyphMasks.c can be drawn into the layer
+void Ui_SetFont(FONT_t *fonts) {
+	UiFont = fonts;
+	if (fonts == &Font16x24) {
+		UiGlyphs = &Glyphs16x24;
+	} else if (fonts == &Font12x12) {
+		UiGlyphs = &Glyphs12x12;
+	} else {
+		UiGlyphs = 0;
+	}
+}
+
+void Ui_SetTextColor(uint8_t index) {
+	UiTextColor = index;
+}
+
+/*
+ * Draw a string like LCD_DisplayString, clipped to the window. Each set bit of a
+ * glyph row is one byte of the layer, the clear pixels around it are kept.
+ */
+void Ui_DisplayString(int16_t Xpos, int16_t Ypos, const char *text, uint8_t align) {
+	if (UiGlyphs == 0) {
+		return;
+	}
+
+	uint16_t width = UiFont->Width, height = UiGlyphs->height;
+	uint16_t advance = width + LCD_CHAR_SPACING;
+	uint16_t length = strlen(text);
+
+	if (align == LCD_ALIGN_CENTER) {
+		Xpos -= (length * advance - LCD_CHAR_SPACING) / 2;
+	} else if (align == LCD_ALIGN_RIGHT) {
+		Xpos -= length * advance - LCD_CHAR_SPACING;
+	}
+
+	// window relative, rows outside the window are cut
+	int16_t x = Xpos - uiWindow.x, y = Ypos - uiWindow.y;
+	int16_t top = (y < 0) ? -y : 0;
+	int16_t bottom = uiWindow.height - y;
+
+	for (; *text != '\0'; text++, x += advance) {
+		uint8_t glyph = (uint8_t) (*text - GLYPH_FIRST_CHAR);
+		if ((*text < GLYPH_FIRST_CHAR) || (glyph >= UiGlyphs->count)
+				|| (x + width <= 0)) {
+			continue;
+		}
+		if (x >= uiWindow.width) {
+			break;
+		}
+
+		const uint8_t *extent = &UiGlyphs->extent[glyph * 2];
+		const uint16_t *rows = &UiGlyphs->rows[glyph * height];
+		int16_t first = (extent[0] < top) ? top : extent[0];
+		int16_t last = extent[0] + extent[1];
+		if (last > bottom) {
+			last = bottom;
+		}
+
+		// columns inside the window
+		uint32_t columns = 0xFFFF;
+		if (x < 0) {
+			columns &= 0xFFFFu << -x;
+		}
+		if (uiWindow.width - x < 16) {
+			columns &= (1u << (uiWindow.width - x)) - 1;
+		}
+
+		for (int16_t row = first; row < last; row++) {
+			uint8_t *line = &uiBuffer[(y + row) * uiWindow.width];
+			for (uint32_t mask = rows[row] & columns; mask != 0; mask &= mask - 1) {
+				line[x + __builtin_ctz(mask)] = UiTextColor;
+			}
+		}
+	}
+}
@@ -0,0 +1,476 @@
+/*
+ * Widget.c
+ *
+ *  Created on: Dec 18, 2024
+ *      Author: Will Fraser
+ */
+
+#include "Widget.h"
+#include "UiLayer.h"
+
+#include <string.h>
+
+static void Frame_Box(int16_t X1, int16_t Y1, int16_t X2, int16_t Y2, uint16_t color) {
+	LCD_Draw_Rectangle_Fill(X1, Y1, X2, Y2, color);
+}
+
+static void Frame_Fill(int16_t x, int16_t y, uint16_t width, uint16_t height,
+		uint16_t color) {
+	for (uint16_t row = 0; row < height; row++) {
+		LCD_Draw_Horizontal_Line(x, y + row, width, color);
+	}
+}
+
+static void Frame_Text(int16_t x, int16_t y, const char *text, uint8_t align, FONT_t *font,
+		uint16_t color) {
+	LCD_SetFont(font);
+	LCD_SetTextColor(color);
+	LCD_DisplayString(x, y, text, align);
+}
+
+static void Ui_BoxColor(int16_t X1, int16_t Y1, int16_t X2, int16_t Y2, uint16_t color) {
+	Ui_Box(X1, Y1, X2, Y2, color);
+}
+
+static void Ui_FillColor(int16_t x, int16_t y, uint16_t width, uint16_t height,
+		uint16_t color) {
+	Ui_Fill(x, y, width, height, color);
+}
+
+static void Ui_Text(int16_t x, int16_t y, const char *text, uint8_t align, FONT_t *font,
+		uint16_t color) {
+	Ui_SetFont(font);
+	Ui_SetTextColor(color);
+	Ui_DisplayString(x, y, text, align);
+}
+
+const WidgetSurface widgetFrame = { Frame_Box, Frame_Fill, Frame_Text, sizeof(uint16_t) };
+const WidgetSurface widgetUi = { Ui_BoxColor, Ui_FillColor, Ui_Text, sizeof(uint8_t) };
+
+static bool Widget_IsText(const Widget *widget) {
+	return (widget->type == WIDGET_LABEL) || (widget->type == WIDGET_NUMBER)
+			|| (widget->type == WIDGET_CLOCK);
+}
+
+static bool Widget_IsBox(const Widget *widget) {
+	return (widget->type == WIDGET_PANEL) || (widget->type == WIDGET_BUTTON);
+}
+
+static uint16_t Widget_Advance(const Widget *widget) {
+	return widget->font->Width + LCD_CHAR_SPACING;
+}
+
+static uint8_t Widget_Length(const char *text) {
+	uint8_t length = 0;
+
+	while (text[length] != '\0') {
+		length++;
+	}
+	return length;
+}
+
+// value with decimals digits after the point, zeros in front so 5 with 2 decimals is 0.05
+static void Widget_FormatFixed(uint32_t value, uint8_t decimals, char *text) {
+	char digits[LCD_NUMBER_DIGITS + 1];
+	uint8_t length = LCD_FormatNumber(value, digits);
+	uint8_t width = (length > decimals) ? length : decimals + 1;
+	uint8_t out = 0;
+
+	for (uint8_t i = 0; i < width; i++) {
+		if ((decimals != 0) && (i == width - decimals)) {
+			text[out++] = '.';
+		}
+		text[out++] = (i < width - length) ? '0' : digits[i - (width - length)];
+	}
+	text[out] = '\0';
+}
+
+// Seconds as minutes and two digits of seconds
+static void Widget_FormatClock(uint32_t seconds, char *text) {
+	uint8_t length = LCD_FormatNumber(seconds / 60, text);
+
+	text[length++] = ':';
+	text[length++] = '0' + (seconds % 60) / 10;
+	text[length++] = '0' + seconds % 10;
+	text[length] = '\0';
+}
+
+// Text and left edge of what the widget shows now, into current and left
+static void Widget_Format(Widget *widget) {
+	if (widget->type == WIDGET_NUMBER) {
+		Widget_FormatFixed(widget->value, widget->decimals, widget->current);
+	} else if (widget->type == WIDGET_CLOCK) {
+		Widget_FormatClock(widget->value, widget->current);
+	} else {
+		const char *text = (widget->text != 0) ? widget->text : "";
+		uint8_t length = 0;
+		for (; (length < WIDGET_TEXT_MAX) && (text[length] != '\0'); length++) {
+			widget->current[length] = text[length];
+		}
+		widget->current[length] = '\0';
+	}
+
+	// the same rounding as LCD_DisplayString and Ui_DisplayString
+	uint8_t length = Widget_Length(widget->current);
+	int16_t width = (length == 0) ? 0 : length * Widget_Advance(widget) - LCD_CHAR_SPACING;
+	widget->left = widget->x;
+	if (widget->align == LCD_ALIGN_CENTER) {
+		widget->left -= width / 2;
+	} else if (widget->align == LCD_ALIGN_RIGHT) {
+		widget->left -= width;
+	}
+}
+
+// Glyph cells first to last of text starting at left, one rectangle with the gaps between
+static WidgetRect Widget_Cells(const Widget *widget, int16_t left, uint8_t first,
+		uint8_t last) {
+	uint16_t advance = Widget_Advance(widget);
+	WidgetRect rect = { left + first * advance, widget->y,
+			(last - first) * advance + widget->font->Width, widget->font->Height };
+	return rect;
+}
+
+static bool Widget_Empty(const WidgetRect *rect) {
+	return (rect->width == 0) || (rect->height == 0);
+}
+
+static WidgetRect Widget_Union(const WidgetRect *a, const WidgetRect *b) {
+	if (Widget_Empty(a)) {
+		return *b;
+	}
+	if (Widget_Empty(b)) {
+		return *a;
+	}
+
+	int16_t left = (a->x < b->x) ? a->x : b->x;
+	int16_t top = (a->y < b->y) ? a->y : b->y;
+	int16_t right = (a->x + a->width > b->x + b->width) ? a->x + a->width : b->x + b->width;
+	int16_t bottom = (a->y + a->height > b->y + b->height) ? a->y + a->height :
+			b->y + b->height;
+	WidgetRect rect = { left, top, right - left, bottom - top };
+	return rect;
+}
+
+static bool Widget_Overlaps(const WidgetRect *a, const WidgetRect *b) {
+	return (a->x < b->x + b->width) && (b->x < a->x + a->width)
+			&& (a->y < b->y + b->height) && (b->y < a->y + a->height);
+}
+
+// Overlapping or touching
+static bool Widget_Meets(const WidgetRect *a, const WidgetRect *b) {
+	return (a->x <= b->x + b->width) && (b->x <= a->x + a->width)
+			&& (a->y <= b->y + b->height) && (b->y <= a->y + a->height);
+}
+
+static bool Widget_Contains(const WidgetRect *outer, const WidgetRect *inner) {
+	return (inner->x >= outer->x) && (inner->y >= outer->y)
+			&& (inner->x + inner->width <= outer->x + outer->width)
+			&& (inner->y + inner->height <= outer->y + outer->height);
+}
+
+static WidgetRect Widget_Box(const Widget *widget) {
+	WidgetRect rect = { widget->x, widget->y, widget->width, widget->height };
+	return rect;
+}
+
+// Inside the border of a box, where all of it is the fill color
+static bool Widget_InFill(const Widget *widget, const WidgetRect *rect) {
+	WidgetRect fill = { widget->x + 1, widget->y + 1, widget->width - 2, widget->height - 2 };
+	return Widget_IsBox(widget) && (widget->width > 2) && (widget->height > 2)
+			&& Widget_Contains(&fill, rect);
+}
+
+/*
+ * Take in what merged cuts through: whole boxes unless it lies in their fill, and
+ * single glyph cells of the text. Returns whether merged grew.
+ */
+static bool Widget_Grow(const WidgetScreen *screen, WidgetRect *merged) {
+	bool grown = false;
+
+	for (uint8_t i = 0; i < screen->count; i++) {
+		const Widget *widget = &screen->widgets[i];
+
+		if (Widget_IsBox(widget)) {
+			WidgetRect box = Widget_Box(widget);
+			if (!Widget_Empty(&box) && Widget_Overlaps(&box, merged)
+					&& !Widget_Contains(merged, &box) && !Widget_InFill(widget, merged)) {
+				*merged = Widget_Union(&box, merged);
+				grown = true;
+			}
+		} else if (Widget_IsText(widget)) {
+			uint8_t length = Widget_Length(widget->current);
+			if ((length == 0) || (widget->y >= merged->y + merged->height)
+					|| (widget->y + widget->font->Height <= merged->y)) {
+				continue;
+			}
+			for (uint8_t c = 0; c < length; c++) {
+				WidgetRect cell = Widget_Cells(widget, widget->left, c, c);
+				if (Widget_Overlaps(&cell, merged) && !Widget_Contains(merged, &cell)) {
+					*merged = Widget_Union(&cell, merged);
+					grown = true;
+				}
+			}
+		}
+	}
+	return grown;
+}
+
+/*
+ * Grow rect until everything it cuts through is either inside it or a box it lies in
+ * the fill of, and merge it with any damage it meets. A rectangle redrawn that way
+ * gives the same pixels as drawing the whole screen again.
+ */
+static void Widget_AddDamage(WidgetScreen *screen, const WidgetRect *rect) {
+	WidgetRect merged = *rect;
+	bool grown = true;
+
+	if (Widget_Empty(rect)) {
+		return;
+	}
+
+	while (grown) {
+		grown = false;
+		for (uint8_t i = 0; i < screen->damageCount;) {
+			if (Widget_Meets(&screen->damage[i], &merged)) {
+				merged = Widget_Union(&screen->damage[i], &merged);
+				screen->damage[i] = screen->damage[--screen->damageCount];
+				grown = true;
+			} else {
+				i++;
+			}
+		}
+		grown |= Widget_Grow(screen, &merged);
+	}
+
+	// full, taken out together with the last one, which may then meet others
+	if (screen->damageCount == WIDGET_DAMAGE_RECTS) {
+		merged = Widget_Union(&screen->damage[--screen->damageCount], &merged);
+		Widget_AddDamage(screen, &merged);
+		return;
+	}
+	screen->damage[screen->damageCount++] = merged;
+}
+
+/*
+ * Damage what changed between the text on screen and the text to show. When both
+ * sit on the same grid of cells only the cells whose character differs are damaged,
+ * one rectangle per run of them, so 129 to 130 is two glyphs and 99 to 100 right
+ * aligned is all three. Text that moved off the grid is damaged old and new.
+ */
+static void Widget_DamageText(WidgetScreen *screen, const Widget *widget) {
+	uint16_t advance = Widget_Advance(widget);
+	uint8_t shownLength = Widget_Length(widget->shown);
+	uint8_t length = Widget_Length(widget->current);
+	int16_t offset = widget->shownLeft - widget->left;
+
+	if ((shownLength == 0) || (length == 0) || (offset % advance != 0)) {
+		WidgetRect old = Widget_Cells(widget, widget->shownLeft, 0, shownLength - 1);
+		WidgetRect now = Widget_Cells(widget, widget->left, 0, length - 1);
+		if (shownLength != 0) {
+			Widget_AddDamage(screen, &old);
+		}
+		if (length != 0) {
+			Widget_AddDamage(screen, &now);
+		}
+		return;
+	}
+
+	// cells on the grid of current, the text on screen starts shift cells in
+	int16_t shift = offset / advance;
+	int16_t first = (shift < 0) ? shift : 0;
+	int16_t end = (shift + shownLength > length) ? shift + shownLength : length;
+	int16_t runStart = 0;
+	bool inRun = false;
+
+	for (int16_t cell = first; cell <= end; cell++) {
+		char was = ((cell >= shift) && (cell < shift + shownLength)) ?
+				widget->shown[cell - shift] : '\0';
+		char is = ((cell >= 0) && (cell < length)) ? widget->current[cell] : '\0';
+		bool differs = (cell < end) && (was != is);
+
+		if (differs && !inRun) {
+			runStart = cell;
+			inRun = true;
+		} else if (!differs && inRun) {
+			WidgetRect run = { widget->left + runStart * advance, widget->y,
+					(cell - runStart) * advance - LCD_CHAR_SPACING, widget->font->Height };
+			Widget_AddDamage(screen, &run);
+			inRun = false;
+		}
+	}
+}
+
+// Mark a widget to be drawn again
+void Widget_Invalidate(WidgetScreen *screen, uint8_t index) {
+	screen->widgets[index].dirty = true;
+	screen->dirty = true;
+}
+
+// The pixels under the screen were replaced, draw every widget from scratch
+void Widget_InvalidateAll(WidgetScreen *screen) {
+	for (uint8_t i = 0; i < screen->count; i++) {
+		screen->widgets[i].shown[0] = '\0';
+		screen->widgets[i].dirty = true;
+	}
+	screen->dirty = true;
+}
+
+/*
+ * The screen underneath is a ScreenImage with the boxes and labels already on it,
+ * only the numbers are drawn.
+ */
+void Widget_InvalidateValues(WidgetScreen *screen) {
+	for (uint8_t i = 0; i < screen->count; i++) {
+		Widget *widget = &screen->widgets[i];
+
+		Widget_Format(widget);
+		widget->dirty = (widget->type == WIDGET_NUMBER) || (widget->type == WIDGET_CLOCK);
+		if (widget->dirty) {
+			widget->shown[0] = '\0';
+		} else {
+			memcpy(widget->shown, widget->current, sizeof(widget->shown));
+			widget->shownLeft = widget->left;
+		}
+	}
+	screen->dirty = true;
+}
+
+void Widget_SetNumber(WidgetScreen *screen, uint8_t index, uint32_t value) {
+	Widget *widget = &screen->widgets[index];
+
+	if (widget->value != value) {
+		widget->value = value;
+		Widget_Invalidate(screen, index);
+	}
+}
+
+void Widget_SetText(WidgetScreen *screen, uint8_t index, const char *text) {
+	Widget *widget = &screen->widgets[index];
+
+	if (widget->text != text) {
+		widget->text = text;
+		Widget_Invalidate(screen, index);
+	}
+}
+
+// Clear rect to what is behind it and draw everything inside it, in array order
+static void Widget_Repaint(WidgetScreen *screen, const WidgetRect *rect) {
+	const WidgetSurface *surface = screen->surface;
+	uint16_t background = screen->background;
+
+	for (uint8_t i = 0; i < screen->count; i++) {
+		if (Widget_InFill(&screen->widgets[i], rect)) {
+			background = screen->widgets[i].color;
+		}
+	}
+	surface->fill(rect->x, rect->y, rect->width, rect->height, background);
+
+	for (uint8_t i = 0; i < screen->count; i++) {
+		const Widget *widget = &screen->widgets[i];
+
+		if (Widget_IsBox(widget)) {
+			WidgetRect box = Widget_Box(widget);
+			if (!Widget_Empty(&box) && Widget_Contains(rect, &box)) {
+				surface->box(widget->x, widget->y, widget->x + widget->width - 1,
+						widget->y + widget->height - 1, widget->color);
+			}
+		} else if (Widget_IsText(widget) && (widget->y >= rect->y)
+				&& (widget->y + widget->font->Height <= rect->y + rect->height)) {
+			// the cells inside rect are a run of the text, damage never cuts one
+			uint16_t advance = Widget_Advance(widget);
+			uint8_t length = Widget_Length(widget->current);
+			char run[WIDGET_TEXT_MAX + 1];
+			uint8_t first = 0, count = 0;
+
+			for (uint8_t c = 0; c < length; c++) {
+				int16_t x = widget->left + c * advance;
+				if ((x >= rect->x) && (x + widget->font->Width <= rect->x + rect->width)) {
+					first = (count == 0) ? c : first;
+					run[count++] = widget->current[c];
+				}
+			}
+			if (count != 0) {
+				run[count] = '\0';
+				surface->text(widget->left + first * advance, widget->y, run, LCD_ALIGN_LEFT,
+						widget->font, widget->color);
+			}
+		}
+	}
+}
+
+/*
+ * Redraw what the dirty widgets changed: whole boxes and the glyph cells that differ
+ * make up the damage rectangles, each announced to ScanSync and repainted on its own.
+ * Returns whether anything was drawn, a screen with nothing dirty returns straight away
+ * and a value set to one that reads the same draws nothing.
+ */
+bool Widget_Render(WidgetScreen *screen) {
+	if (!screen->dirty) {
+		return false;
+	}
+
+	// all text has to be current before any damage is grown over it
+	for (uint8_t i = 0; i < screen->count; i++) {
+		if (screen->widgets[i].dirty && Widget_IsText(&screen->widgets[i])) {
+			Widget_Format(&screen->widgets[i]);
+		}
+	}
+
+	screen->damageCount = 0;
+	for (uint8_t i = 0; i < screen->count; i++) {
+		Widget *widget = &screen->widgets[i];
+
+		if (!widget->dirty) {
+			continue;
+		}
+		if (Widget_IsBox(widget)) {
+			WidgetRect box = Widget_Box(widget);
+			Widget_AddDamage(screen, &box);
+		} else if (Widget_IsText(widget)) {
+			Widget_DamageText(screen, widget);
+		}
+	}
+
+	if (screen->damageCount != 0) {
+		Scan_Begin();
+		for (uint8_t d = 0; d < screen->damageCount; d++) {
+			const WidgetRect *rect = &screen->damage[d];
+
+			Scan_Band(rect->y, rect->y + rect->height,
+					(uint32_t) rect->width * rect->height * screen->surface->pixelBytes);
+			Widget_Repaint(screen, rect);
+			screen->damagePixels += (uint32_t) rect->width * rect->height;
+		}
+		Scan_End();
+	}
+
+	for (uint8_t i = 0; i < screen->count; i++) {
+		Widget *widget = &screen->widgets[i];
+
+		if (widget->dirty && Widget_IsText(widget)) {
+			memcpy(widget->shown, widget->current, sizeof(widget->shown));
+			widget->shownLeft = widget->left;
+		}
+		widget->dirty = false;
+	}
+	screen->dirty = false;
+	screen->renders += (screen->damageCount != 0);
+	return screen->damageCount != 0;
+}
+
+// Action of the topmost button or zone under the point, WIDGET_NO_ACTION if none
+uint8_t Widget_HitTest(const WidgetScreen *screen, int16_t x, int16_t y) {
+	for (uint8_t i = screen->count; i-- > 0;) {
+		const Widget *widget = &screen->widgets[i];
+		if ((widget->action != WIDGET_NO_ACTION) && (x >= widget->x) && (y >= widget->y)
+				&& (x < widget->x + widget->width) && (y < widget->y + widget->height)) {
+			return widget->action;
+		}
+	}
+	return WIDGET_NO_ACTION;
+}
+
+void Widget_ResetStats(WidgetScreen *screen) {
+	screen->damagePixels = 0;
+	screen->renders = 0;
+}
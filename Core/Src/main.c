@@ -50,6 +50,10 @@ int main(void) {
 		} else if (gameState & RESULTS) {
 			displayResultsScreen();			// Results
 		}
+
+		if ((gameState & GAME) == 0) {
+			ApplicationIdle();				// Flash writes, never during a game
+		}
 	}
 }
 
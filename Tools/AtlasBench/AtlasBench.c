@@ -0,0 +1,110 @@
+/*
+ * AtlasBench.c
+ *
+ *  Created on: Dec 12, 2024
+ *      Author: Will Fraser
+ *
+ * Host tool, checks that a tile from TileAtlas.c gives exactly the pixels
+ * LCD_Draw_Rectangle_Fill gives for the same cell, then times both for single
+ * cells and for a whole playfield redraw.
+ *
+ * Build from the repository root:
+ *   gcc -O2 -ICore/Inc Tools/AtlasBench/AtlasBench.c Core/Src/TileAtlas.c
+ *       Core/Src/LCD_Graphics.c Core/Src/GlyphMasks.c Core/Src/fonts.c -o atlas_bench
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "TileAtlas.h"
+
+#define GRID_COLUMNS (LCD_PIXEL_WIDTH / ATLAS_TILE_SIZE)
+#define GRID_ROWS    (LCD_PIXEL_HEIGHT / ATLAS_TILE_SIZE)
+
+static uint16_t referenceBuffer[LCD_PIXELS];
+
+static double Bench_Seconds(void) {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+static void Bench_RectCell(uint16_t column, uint16_t row, uint8_t blockNum) {
+	LCD_Draw_Rectangle_Fill(column * ATLAS_TILE_SIZE, row * ATLAS_TILE_SIZE,
+			(column + 1) * ATLAS_TILE_SIZE - 1, (row + 1) * ATLAS_TILE_SIZE - 1,
+			Atlas_Color(blockNum));
+}
+
+static int Bench_Compare(void) {
+	int errors = 0;
+
+	for (uint8_t blockNum = 0; blockNum < ATLAS_COLORS; blockNum++) {
+		memset(frameBuffer, 0x5A, sizeof(referenceBuffer));
+		for (uint16_t row = 0; row < GRID_ROWS; row++) {
+			for (uint16_t column = 0; column < GRID_COLUMNS; column++) {
+				Bench_RectCell(column, row, blockNum);
+			}
+		}
+		memcpy(referenceBuffer, frameBuffer, sizeof(referenceBuffer));
+
+		memset(frameBuffer, 0x5A, sizeof(referenceBuffer));
+		for (uint16_t row = 0; row < GRID_ROWS; row++) {
+			for (uint16_t column = 0; column < GRID_COLUMNS; column++) {
+				Atlas_DrawCell(column * ATLAS_TILE_SIZE, row * ATLAS_TILE_SIZE, blockNum);
+			}
+		}
+
+		if (memcmp(frameBuffer, referenceBuffer, sizeof(referenceBuffer)) != 0) {
+			printf("block %u: tile differs from LCD_Draw_Rectangle_Fill\n", blockNum);
+			errors++;
+		}
+	}
+	printf("%u tiles %s\n", ATLAS_COLORS, errors ? "FAILED" : "match");
+	return errors;
+}
+
+static void Bench_Speed(void) {
+	const unsigned frames = 20000;
+	double start, fill, tile;
+	unsigned cell = 0;
+
+	start = Bench_Seconds();
+	for (unsigned frame = 0; frame < frames; frame++) {
+		for (uint16_t row = 0; row < GRID_ROWS; row++) {
+			for (uint16_t column = 0; column < GRID_COLUMNS; column++) {
+				Bench_RectCell(column, row, (uint8_t) (cell++ % ATLAS_COLORS));
+			}
+		}
+	}
+	fill = Bench_Seconds() - start;
+
+	start = Bench_Seconds();
+	for (unsigned frame = 0; frame < frames; frame++) {
+		for (uint16_t row = 0; row < GRID_ROWS; row++) {
+			for (uint16_t column = 0; column < GRID_COLUMNS; column++) {
+				Atlas_DrawCell(column * ATLAS_TILE_SIZE, row * ATLAS_TILE_SIZE,
+						(uint8_t) (cell++ % ATLAS_COLORS));
+			}
+		}
+	}
+	tile = Bench_Seconds() - start;
+
+	double cells = (double) frames * GRID_ROWS * GRID_COLUMNS;
+	printf("rectangle fill %10.0f cells/s %8.0f grids/s\n", cells / fill, frames / fill);
+	printf("tile blit      %10.0f cells/s %8.0f grids/s  %.1fx\n", cells / tile,
+			frames / tile, fill / tile);
+}
+
+int main(void) {
+	int errors;
+
+	Atlas_Init();
+#ifdef ATLAS_BEVEL
+	printf("ATLAS_BEVEL set, tiles are not expected to match\n");
+#endif
+	errors = Bench_Compare();
+	Bench_Speed();
+
+	return errors ? 1 : 0;
+}
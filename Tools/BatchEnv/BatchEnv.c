@@ -0,0 +1,235 @@
+/*
+ * BatchEnv.c
+ *
+ *  Created on: Dec 19, 2024
+ *      Author: Will Fraser
+ *
+ * The games are plain GameStates stepped with the engine's own block operations, so
+ * the rules are the ones on the board. Worker threads stay up for the life of the
+ * batch and each steps a fixed slice of the games between two barriers; the calling
+ * thread takes the first slice. Nothing is allocated after BatchEnv_Create.
+ *
+ * Build from the repository root:
+ *   gcc -O2 -shared -fPIC -pthread -ICore/Inc -ITools/BatchEnv Tools/BatchEnv/BatchEnv.c
+ *       Core/Src/GameEngine.c Core/Src/PieceBag.c -o libbatchenv.so
+ *
+ * Tools/BatchEnv/BatchEnvBench.c measures steps per second against batch size.
+ */
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "BatchEnv.h"
+
+#define SEED_STRIDE 2654435761u		// spreads the seeds of neighbouring games
+
+typedef struct {
+	BatchEnv *env;
+	uint32_t first;
+	uint32_t end;
+} BatchSlice;
+
+struct BatchEnv {
+	BatchEnvBuffers buffers;
+	GameState *games;
+	uint32_t *seeds;				// seed of the game in progress
+	uint32_t baseSeed;
+
+	const uint16_t *actions;		// of the step being run
+	bool stopping;
+	uint32_t threads;
+	pthread_t workers[BATCH_MAX_THREADS];
+	BatchSlice slices[BATCH_MAX_THREADS];
+	pthread_barrier_t start;
+	pthread_barrier_t done;
+};
+
+static uint32_t Batch_Lines(const GameState *game) {
+	const uint16_t *score = Engine_GetScore(game);
+	return score[0] + 2 * score[1] + 3 * score[2] + 4 * score[3];
+}
+
+// Leftmost column of the falling block, currentBlock is a whole grid layer
+static uint8_t Batch_Left(const GameState *game) {
+	for (uint8_t x = 0; x < GRID_WIDTH; x++) {
+		for (uint8_t y = 0; y < GRID_ROWS; y++) {
+			if (game->currentBlock[y][x] != EMPTY_CELL) {
+				return x;
+			}
+		}
+	}
+	return 0;
+}
+
+static void Batch_Observe(BatchEnv *env, uint32_t index) {
+	const GameState *game = &env->games[index];
+	uint8_t *pieces = &env->buffers.pieces[index * BATCH_PIECES];
+
+	memcpy(&env->buffers.rows[index * GRID_ROWS], game->gridRows, sizeof(game->gridRows));
+	pieces[0] = game->currentBlockNum;
+	pieces[1] = Engine_GetHold(game);
+	for (uint8_t i = 0; i < PREVIEW_COUNT; i++) {
+		pieces[2 + i] = Engine_PeekNext(game, i);
+	}
+}
+
+static void Batch_NewGame(BatchEnv *env, uint32_t index) {
+	Engine_NewGame(&env->games[index], env->seeds[index]);
+	Batch_Observe(env, index);
+}
+
+// Turn, shift and drop the falling block the way the engine moves it on the board
+static void Batch_Place(GameState *game, uint16_t action) {
+	uint8_t rotation = (action / GRID_WIDTH) % 4;
+	uint8_t column = action % GRID_WIDTH;
+
+	for (uint8_t r = 0; r < rotation; r++) {
+		RotateCurrentBlock(game, ROTATE_RIGHT);
+	}
+
+	uint8_t left = Batch_Left(game);
+	while (left != column) {
+		int8_t before = game->currentBlockX;
+		MoveCurrentBlock(game, (left > column) ? MOVE_LEFT : MOVE_RIGHT);
+		if (game->currentBlockX == before) {
+			break;					// blocked, dropped where it is
+		}
+		left += (left > column) ? -1 : 1;
+	}
+
+	while (!MoveCurrentBlock(game, MOVE_DOWN)) {
+	}
+	PlaceCurrentBlock(game);
+	if (!game->gameOver) {
+		GenerateBlock(game, RANDOM_BLOCK);
+	}
+}
+
+static void Batch_StepSlice(BatchEnv *env, const BatchSlice *slice) {
+	for (uint32_t i = slice->first; i < slice->end; i++) {
+		GameState *game = &env->games[i];
+		uint32_t lines = Batch_Lines(game);
+
+		Batch_Place(game, env->actions[i]);
+		env->buffers.rewards[i] = (float) (Batch_Lines(game) - lines);
+		env->buffers.dones[i] = game->gameOver;
+		if (game->gameOver) {
+			env->seeds[i] += env->buffers.count;
+			Batch_NewGame(env, i);
+		} else {
+			Batch_Observe(env, i);
+		}
+	}
+}
+
+static void* Batch_Worker(void *argument) {
+	BatchSlice *slice = argument;
+	BatchEnv *env = slice->env;
+
+	for (;;) {
+		pthread_barrier_wait(&env->start);
+		if (env->stopping) {
+			return NULL;
+		}
+		Batch_StepSlice(env, slice);
+		pthread_barrier_wait(&env->done);
+	}
+}
+
+/*
+ * count games split over threads (the caller counts as one), seeded from seed. Each
+ * thread gets at least one game. Returns NULL if anything could not be allocated.
+ */
+BatchEnv* BatchEnv_Create(uint32_t count, uint32_t threads, uint32_t seed) {
+	BatchEnv *env = calloc(1, sizeof(BatchEnv));
+
+	if ((env == NULL) || (count == 0)) {
+		free(env);
+		return NULL;
+	}
+	threads = (threads == 0) ? 1 : threads;
+	threads = (threads > BATCH_MAX_THREADS) ? BATCH_MAX_THREADS : threads;
+	threads = (threads > count) ? count : threads;
+
+	env->buffers.count = count;
+	env->buffers.rows = calloc((size_t) count * GRID_ROWS, sizeof(uint16_t));
+	env->buffers.pieces = calloc((size_t) count * BATCH_PIECES, sizeof(uint8_t));
+	env->buffers.rewards = calloc(count, sizeof(float));
+	env->buffers.dones = calloc(count, sizeof(uint8_t));
+	env->games = calloc(count, sizeof(GameState));
+	env->seeds = calloc(count, sizeof(uint32_t));
+	env->baseSeed = seed;
+	env->threads = threads;
+	if ((env->buffers.rows == NULL) || (env->buffers.pieces == NULL)
+			|| (env->buffers.rewards == NULL) || (env->buffers.dones == NULL)
+			|| (env->games == NULL) || (env->seeds == NULL)) {
+		env->threads = 1;
+		BatchEnv_Destroy(env);
+		return NULL;
+	}
+
+	for (uint32_t t = 0; t < threads; t++) {
+		env->slices[t].env = env;
+		env->slices[t].first = (uint32_t) ((uint64_t) count * t / threads);
+		env->slices[t].end = (uint32_t) ((uint64_t) count * (t + 1) / threads);
+	}
+	if (threads > 1) {
+		pthread_barrier_init(&env->start, NULL, threads);
+		pthread_barrier_init(&env->done, NULL, threads);
+		for (uint32_t t = 1; t < threads; t++) {
+			pthread_create(&env->workers[t], NULL, Batch_Worker, &env->slices[t]);
+		}
+	}
+
+	BatchEnv_Reset(env);
+	return env;
+}
+
+void BatchEnv_Destroy(BatchEnv *env) {
+	if (env == NULL) {
+		return;
+	}
+	if (env->threads > 1) {
+		env->stopping = true;
+		pthread_barrier_wait(&env->start);
+		for (uint32_t t = 1; t < env->threads; t++) {
+			pthread_join(env->workers[t], NULL);
+		}
+		pthread_barrier_destroy(&env->start);
+		pthread_barrier_destroy(&env->done);
+	}
+	free(env->buffers.rows);
+	free(env->buffers.pieces);
+	free(env->buffers.rewards);
+	free(env->buffers.dones);
+	free(env->games);
+	free(env->seeds);
+	free(env);
+}
+
+const BatchEnvBuffers* BatchEnv_Buffers(const BatchEnv *env) {
+	return &env->buffers;
+}
+
+// Start every game from its first seed again, rewards and done flags are cleared
+void BatchEnv_Reset(BatchEnv *env) {
+	for (uint32_t i = 0; i < env->buffers.count; i++) {
+		env->seeds[i] = env->baseSeed + i * SEED_STRIDE;
+		env->buffers.rewards[i] = 0;
+		env->buffers.dones[i] = 0;
+		Batch_NewGame(env, i);
+	}
+}
+
+// One placement in every game, actions holds one value below BATCH_ACTIONS per game
+void BatchEnv_Step(BatchEnv *env, const uint16_t *actions) {
+	env->actions = actions;
+	if (env->threads > 1) {
+		pthread_barrier_wait(&env->start);
+	}
+	Batch_StepSlice(env, &env->slices[0]);
+	if (env->threads > 1) {
+		pthread_barrier_wait(&env->done);
+	}
+}
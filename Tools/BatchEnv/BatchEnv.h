@@ -0,0 +1,59 @@
+/*
+ * BatchEnv.h
+ *
+ *  Created on: Dec 19, 2024
+ *      Author: Will Fraser
+ *
+ * Host library stepping many independent games of this exact ruleset at once, for
+ * training placement policies. One call takes an action per game and leaves the
+ * observations, rewards and done flags of every game in flat arrays the library
+ * owns. The arrays are allocated once in BatchEnv_Create and written in place on
+ * every step, one array per field (structure of arrays) so a batch maps straight
+ * onto numpy without copying:
+ *
+ *   rows     uint16_t [count][GRID_ROWS]        stack occupancy, hidden rows first, bit x = column x
+ *   pieces   uint8_t  [count][BATCH_PIECES]     falling block, hold, then the queue
+ *   rewards  float    [count]                   lines cleared by the last step
+ *   dones    uint8_t  [count]                   the last step ended the game
+ *
+ * An action places the falling block: rotation * GRID_WIDTH + column, turned right
+ * rotation times, moved until its leftmost cell is in column (or it is blocked) and
+ * dropped. A game that ends starts again straight away with its next seed, the
+ * observation is then the first one of the new game and dones says so.
+ *
+ * Only plain C types cross the ABI, from Python with ctypes:
+ *   env = lib.BatchEnv_Create(4096, 8, 1)            # restype c_void_p
+ *   buffers = lib.BatchEnv_Buffers(env).contents     # BatchEnvBuffers structure
+ *   rows = np.ctypeslib.as_array(buffers.rows, (4096, 18))
+ *   lib.BatchEnv_Step(env, actions.ctypes.data)      # uint16 array of 4096 actions
+ */
+
+#ifndef TOOLS_BATCHENV_BATCHENV_H_
+#define TOOLS_BATCHENV_BATCHENV_H_
+
+#include <stdint.h>
+
+#include "GameEngine.h"
+
+#define BATCH_PIECES   (2 + PREVIEW_COUNT)		// falling block, hold, next pieces
+#define BATCH_ACTIONS  (4 * GRID_WIDTH)			// rotations times leftmost columns
+#define BATCH_MAX_THREADS 64
+
+typedef struct BatchEnv BatchEnv;
+
+typedef struct {
+	uint16_t *rows;
+	uint8_t *pieces;
+	float *rewards;
+	uint8_t *dones;
+	uint32_t count;				// games in the batch
+} BatchEnvBuffers;
+
+BatchEnv* BatchEnv_Create(uint32_t count, uint32_t threads, uint32_t seed);
+void BatchEnv_Destroy(BatchEnv *env);
+const BatchEnvBuffers* BatchEnv_Buffers(const BatchEnv *env);
+
+void BatchEnv_Reset(BatchEnv *env);
+void BatchEnv_Step(BatchEnv *env, const uint16_t *actions);
+
+#endif /* TOOLS_BATCHENV_BATCHENV_H_ */
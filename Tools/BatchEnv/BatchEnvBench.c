@@ -0,0 +1,119 @@
+/*
+ * BatchEnvBench.c
+ *
+ *  Created on: Dec 19, 2024
+ *      Author: Will Fraser
+ *
+ * Steps per second of the batched environment for batch sizes 1 to 4096, with random
+ * actions, on one thread and on as many threads as the batch can keep busy. The
+ * threaded run is also checked against the single thread one: the games are
+ * independent, so every observation, reward and done flag has to match.
+ *
+ * Build from the repository root:
+ *   gcc -O2 -pthread -ICore/Inc -ITools/BatchEnv Tools/BatchEnv/BatchEnvBench.c
+ *       Tools/BatchEnv/BatchEnv.c Core/Src/GameEngine.c Core/Src/PieceBag.c -o batchenvbench
+ *
+ * Usage: batchenvbench [threads] [seconds per size]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "BatchEnv.h"
+
+#define BENCH_MAX_BATCH  4096
+#define BENCH_CHECK_STEPS 200
+#define GAMES_PER_THREAD 64		// below this a thread costs more in barriers than it steps
+
+static uint16_t actions[BENCH_MAX_BATCH];
+static uint32_t lcg = 12345;
+
+static double Bench_Now(void) {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+static void Bench_Actions(uint32_t count) {
+	for (uint32_t i = 0; i < count; i++) {
+		lcg = lcg * 1103515245u + 12345u;
+		actions[i] = (lcg >> 16) % BATCH_ACTIONS;
+	}
+}
+
+// Steps per second and games ended per step for one batch size
+static double Bench_Run(uint32_t count, uint32_t threads, double seconds, double *doneRate) {
+	BatchEnv *env = BatchEnv_Create(count, threads, 1);
+	const BatchEnvBuffers *buffers = BatchEnv_Buffers(env);
+	uint64_t steps = 0, dones = 0;
+	double start = Bench_Now(), elapsed;
+
+	do {
+		for (uint8_t i = 0; i < 16; i++) {
+			Bench_Actions(count);
+			BatchEnv_Step(env, actions);
+			for (uint32_t g = 0; g < count; g++) {
+				dones += buffers->dones[g];
+			}
+		}
+		steps += 16 * (uint64_t) count;
+		elapsed = Bench_Now() - start;
+	} while (elapsed < seconds);
+
+	BatchEnv_Destroy(env);
+	*doneRate = (double) dones / steps;
+	return steps / elapsed;
+}
+
+// Same seeds and actions on one thread and on threads, returns the differing values
+static uint32_t Bench_Check(uint32_t count, uint32_t threads) {
+	BatchEnv *single = BatchEnv_Create(count, 1, 99);
+	BatchEnv *threaded = BatchEnv_Create(count, threads, 99);
+	const BatchEnvBuffers *a = BatchEnv_Buffers(single);
+	const BatchEnvBuffers *b = BatchEnv_Buffers(threaded);
+	uint32_t differ = 0;
+
+	for (uint32_t s = 0; s < BENCH_CHECK_STEPS; s++) {
+		Bench_Actions(count);
+		BatchEnv_Step(single, actions);
+		BatchEnv_Step(threaded, actions);
+		for (uint32_t g = 0; g < count; g++) {
+			differ += memcmp(&a->rows[g * GRID_ROWS], &b->rows[g * GRID_ROWS],
+					GRID_ROWS * sizeof(uint16_t)) != 0;
+			differ += memcmp(&a->pieces[g * BATCH_PIECES], &b->pieces[g * BATCH_PIECES],
+					BATCH_PIECES) != 0;
+			differ += (a->rewards[g] != b->rewards[g]) || (a->dones[g] != b->dones[g]);
+		}
+	}
+
+	BatchEnv_Destroy(single);
+	BatchEnv_Destroy(threaded);
+	return differ;
+}
+
+int main(int argc, char **argv) {
+	uint32_t cores = (argc > 1) ? atoi(argv[1]) : sysconf(_SC_NPROCESSORS_ONLN);
+	double seconds = (argc > 2) ? atof(argv[2]) : 0.5;
+
+	cores = (cores == 0) ? 1 : cores;
+	cores = (cores > BATCH_MAX_THREADS) ? BATCH_MAX_THREADS : cores;
+
+	printf("%6s %12s %8s %12s %8s %8s\n", "batch", "1 thread", "threads", "steps/s", "done/st",
+			"differ");
+	for (uint32_t count = 1; count <= BENCH_MAX_BATCH; count *= 4) {
+		uint32_t threads = count / GAMES_PER_THREAD + 1;
+		double doneRate;
+
+		threads = (threads > cores) ? cores : threads;
+		double single = Bench_Run(count, 1, seconds, &doneRate);
+		double parallel = Bench_Run(count, threads, seconds, &doneRate);
+		uint32_t differ = Bench_Check(count, threads);
+
+		printf("%6u %12.0f %8u %12.0f %8.4f %8u\n", count, single, threads, parallel, doneRate,
+				differ);
+	}
+	return 0;
+}
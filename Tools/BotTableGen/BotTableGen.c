@@ -0,0 +1,337 @@
+/*
+ * BotTableGen.c
+ *
+ *  Created on: Dec 23, 2024
+ *      Author: Will Fraser
+ *
+ * Host tool, plays games with Bot_Search, keeps the drop it chose most often for every
+ * surface and block that came up, and writes the most frequent of them as the perfect
+ * hash table in Core/Src/BotTable.c. Run it again whenever tetrisBlocks, the grid, the
+ * surface buckets or the score weights in Bot.c change.
+ *
+ * Games are played on row masks with the pieces from a seeded bag, blocks dropped
+ * straight down from where the engine spawns them, and end on a block out or a lock
+ * out as they do in the engine. After the table is written, other seeds are played
+ * with the search only and with tables of several sizes in front of it, and the flash
+ * each table takes, how many blocks it answers, and how long the games last are
+ * printed to stderr, with the time a lookup and a search take. The run fails when the
+ * table written clears under MIN_QUALITY percent of the lines the search alone does,
+ * BOT_TABLE in Bot.h stays off until it passes.
+ *
+ * Build and run from the repository root:
+ *   gcc -O2 -mavx2 -ICore/Inc Tools/BotTableGen/BotTableGen.c Core/Src/Bot.c
+ *       Core/Src/BoardEval.c Core/Src/Placement.c Core/Src/GameEngine.c Core/Src/PieceBag.c
+ *       -o bot_table_gen
+ *   ./bot_table_gen [entries] [games] > Core/Src/BotTable.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "Bot.h"
+
+#define MAX_PIECES     1000		// per game, the search rarely tops out on its own
+#define SEEN_SIZE      (1 << 21)	// surfaces seen in play, open addressing
+#define EVAL_GAMES     100
+#define EVAL_SEED      1000000	// evaluation games never share a seed with the training ones
+#define MIN_SEEN       2		// a surface seen once is not likely to come up again
+#define MIN_AGREE      80		// percent more votes for the choice than against it
+#define MAX_DISPLACE   0xFFFF
+#define BUCKET_KEYS    4		// keys per bucket on average
+#define MAX_ENTRIES    57344	// slots stay under 65536 at the lowest load
+#define MIN_QUALITY    99.0		// percent of the search's lines the written table has to clear
+
+typedef struct {
+	uint32_t key;
+	uint32_t count;
+	uint8_t choice;				// rotation << 4 | x + PLACEMENT_X_BIAS, the majority vote
+	int16_t votes;
+} Seen;
+
+typedef struct {
+	uint32_t pieces;
+	uint32_t lines;
+	uint32_t hits;
+	uint32_t games;
+} PlayStats;
+
+static Seen seen[SEEN_SIZE];
+static uint32_t seenCount;
+static uint32_t rankedCount;
+static Seen *ranked[SEEN_SIZE];
+static uint16_t displace[SEEN_SIZE / BUCKET_KEYS];
+static uint16_t entries[SEEN_SIZE];
+static uint32_t bucketOf[SEEN_SIZE];
+static uint32_t byBucket[SEEN_SIZE];			// key indices, bucket after bucket
+static uint32_t bucketStart[SEEN_SIZE / BUCKET_KEYS + 1];
+static uint32_t order[SEEN_SIZE / BUCKET_KEYS];
+static uint32_t bucketSize[SEEN_SIZE / BUCKET_KEYS];
+static uint32_t taken[SEEN_SIZE / BUCKET_KEYS];		// slots of the bucket being placed
+
+static double Gen_Now(void) {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+// Majority vote per surface: a different drop cancels one vote for the current choice
+static void Gen_Record(uint32_t key, const Placement *placement) {
+	uint8_t choice = placement->rotation << 4 | (placement->x + PLACEMENT_X_BIAS);
+	uint32_t slot = Bot_Hash(key, BOT_SEED_BUCKET) & (SEEN_SIZE - 1);
+
+	while ((seen[slot].count != 0) && (seen[slot].key != key)) {
+		slot = (slot + 1) & (SEEN_SIZE - 1);
+	}
+	Seen *entry = &seen[slot];
+	if (entry->count++ == 0) {
+		entry->key = key;
+		seenCount++;
+	}
+	if (entry->votes == 0) {
+		entry->choice = choice;
+	}
+	entry->votes += (entry->choice == choice) ? 1 : -1;
+}
+
+// One game, searched when table is NULL, the surfaces recorded when record is set
+static void Gen_Play(uint32_t seed, const BotTable *table, bool record, PlayStats *stats) {
+	uint16_t rows[GRID_ROWS] = { 0 };
+	PieceBag bag;
+
+	Bag_InitSeeded(&bag, seed);
+	stats->games++;
+	for (uint32_t p = 0; p < MAX_PIECES; p++) {
+		uint8_t blockNum = Bag_Next(&bag);
+		Placement best;
+		bool hit = false;
+
+		if (!((table != NULL) ? Bot_Choose(table, rows, blockNum, &best, &hit)
+				: Bot_Search(rows, blockNum, &best))) {
+			return;		// block out
+		}
+		if (record && (SEEN_SIZE - seenCount > SEEN_SIZE / 4)) {
+			Gen_Record(Bot_SurfaceKey(rows, blockNum), &best);
+		}
+		stats->pieces++;
+		stats->hits += hit;
+		stats->lines += Bot_Lock(rows, blockNum, &best);
+		for (uint8_t y = 0; y < GRID_HIDDEN_ROWS; y++) {
+			if (rows[y] != 0) {
+				return;	// lock out
+			}
+		}
+	}
+}
+
+static int Gen_ByCount(const void *a, const void *b) {
+	const Seen *left = *(const Seen* const*) a;
+	const Seen *right = *(const Seen* const*) b;
+
+	if (left->count != right->count) {
+		return (left->count < right->count) ? 1 : -1;
+	}
+	return (left->key < right->key) ? -1 : (left->key > right->key);
+}
+
+static int Gen_ByBucketSize(const void *a, const void *b) {
+	uint32_t left = bucketSize[*(const uint32_t*) a], right = bucketSize[*(const uint32_t*) b];
+
+	if (left != right) {
+		return (left < right) ? 1 : -1;
+	}
+	return (*(const uint32_t*) a < *(const uint32_t*) b) ? -1 : 1;
+}
+
+/*
+ * Hash and displace over the keyCount most frequent surfaces: the largest buckets
+ * first, each gets the first displacement that puts all its keys in empty slots.
+ * Slots are added until every bucket finds one.
+ */
+static bool Gen_Build(uint32_t keyCount, BotTable *table) {
+	uint32_t buckets = (keyCount + BUCKET_KEYS - 1) / BUCKET_KEYS;
+	uint32_t slots = keyCount + keyCount / 16 + 1;
+
+	for (; slots <= UINT16_MAX; slots += keyCount / 32 + 1) {
+		bool placed = true;
+
+		memset(bucketSize, 0, buckets * sizeof(bucketSize[0]));
+		for (uint32_t k = 0; k < keyCount; k++) {
+			bucketOf[k] = Bot_Hash(ranked[k]->key, BOT_SEED_BUCKET) % buckets;
+			bucketSize[bucketOf[k]]++;
+		}
+		bucketStart[0] = 0;
+		for (uint32_t b = 0; b < buckets; b++) {
+			order[b] = b;
+			bucketStart[b + 1] = bucketStart[b] + bucketSize[b];
+			bucketSize[b] = 0;
+		}
+		for (uint32_t k = 0; k < keyCount; k++) {
+			byBucket[bucketStart[bucketOf[k]] + bucketSize[bucketOf[k]]++] = k;
+		}
+		qsort(order, buckets, sizeof(order[0]), Gen_ByBucketSize);
+		for (uint32_t s = 0; s < slots; s++) {
+			entries[s] = 0xFFFF;	// box column 12, never a drop
+		}
+
+		for (uint32_t b = 0; (b < buckets) && placed; b++) {
+			uint32_t bucket = order[b];
+			placed = false;
+			for (uint32_t d = 0; (d <= MAX_DISPLACE) && !placed; d++) {
+				bool free = true;
+				for (uint32_t i = 0; (i < bucketSize[bucket]) && free; i++) {
+					const Seen *seenKey = ranked[byBucket[bucketStart[bucket] + i]];
+					taken[i] = Bot_Hash(seenKey->key, BOT_SEED_SLOT + d) % slots;
+					free = (entries[taken[i]] == 0xFFFF);
+					for (uint32_t j = 0; (j < i) && free; j++) {
+						free = (taken[j] != taken[i]);
+					}
+				}
+				if (!free) {
+					continue;
+				}
+				for (uint32_t i = 0; i < bucketSize[bucket]; i++) {
+					const Seen *seenKey = ranked[byBucket[bucketStart[bucket] + i]];
+					entries[taken[i]] = BOT_ENTRY(
+							Bot_Hash(seenKey->key, BOT_SEED_FINGERPRINT) >> 24,
+							seenKey->choice >> 4, (seenKey->choice & 0xF) - PLACEMENT_X_BIAS);
+				}
+				displace[bucket] = d;
+				placed = true;
+			}
+		}
+		if (placed) {
+			table->displace = displace;
+			table->entries = entries;
+			table->buckets = buckets;
+			table->slots = slots;
+			return true;
+		}
+	}
+	return false;
+}
+
+static void Gen_Emit(const BotTable *table) {
+	printf("/*\n * BotTable.c\n *\n * Generated by Tools/BotTableGen, do not edit.\n */\n\n");
+	printf("#include \"Bot.h\"\n\n#ifdef BOT_TABLE\n\n");
+
+	printf("static const uint16_t botDisplace[%u] = {", table->buckets);
+	for (uint32_t b = 0; b < table->buckets; b++) {
+		printf("%s%u,", (b % 12) ? " " : "\n\t\t", table->displace[b]);
+	}
+	printf("\n};\n\n");
+
+	printf("static const uint16_t botEntries[%u] = {", table->slots);
+	for (uint32_t s = 0; s < table->slots; s++) {
+		printf("%s0x%04X,", (s % 10) ? " " : "\n\t\t", table->entries[s]);
+	}
+	printf("\n};\n\n");
+
+	printf("const BotTable botTable = { botDisplace, botEntries, %u, %u };\n", table->buckets,
+			table->slots);
+	printf("\n#endif /* BOT_TABLE */\n");
+}
+
+// Games on the evaluation seeds, with a table of the most frequent keyCount surfaces, lines per game
+static double Gen_Evaluate(uint32_t keyCount) {
+	BotTable table;
+	PlayStats stats = { 0 };
+
+	if ((keyCount != 0) && !Gen_Build(keyCount, &table)) {
+		fprintf(stderr, "%8u no table\n", keyCount);
+		return 0;
+	}
+	for (uint32_t g = 0; g < EVAL_GAMES; g++) {
+		Gen_Play(EVAL_SEED + g, (keyCount != 0) ? &table : NULL, false, &stats);
+	}
+	uint32_t bytes = (keyCount != 0) ? (table.buckets + table.slots) * sizeof(uint16_t) : 0;
+	fprintf(stderr, "%8u %8u %7.1f%% %10.1f %10.1f\n", keyCount, bytes,
+			100.0 * stats.hits / stats.pieces, (double) stats.pieces / stats.games,
+			(double) stats.lines / stats.games);
+	return (double) stats.lines / stats.games;
+}
+
+int main(int argc, char **argv) {
+	uint32_t keyCount = (argc > 1) ? atoi(argv[1]) : 4096;
+	uint32_t games = (argc > 2) ? atoi(argv[2]) : 400;
+	PlayStats stats = { 0 };
+	BotTable table;
+
+	Placement_Init();
+	for (uint32_t g = 0; g < games; g++) {
+		Gen_Play(g + 1, NULL, true, &stats);
+	}
+	// only surfaces the search keeps dropping the same way on, the rest are left to it
+	for (uint32_t s = 0; s < SEEN_SIZE; s++) {
+		if ((seen[s].count >= MIN_SEEN) && (seen[s].votes * 100 >= (int32_t) (seen[s].count * MIN_AGREE))) {
+			ranked[rankedCount++] = &seen[s];
+		}
+	}
+	qsort(ranked, rankedCount, sizeof(ranked[0]), Gen_ByCount);
+
+	keyCount = (keyCount > rankedCount) ? rankedCount : keyCount;
+	keyCount = (keyCount > MAX_ENTRIES) ? MAX_ENTRIES : keyCount;
+	uint32_t covered = 0;
+	for (uint32_t k = 0; k < keyCount; k++) {
+		covered += ranked[k]->count;
+	}
+	if (!Gen_Build(keyCount, &table)) {
+		fprintf(stderr, "no displacement found for %u keys\n", keyCount);
+		return 1;
+	}
+	Gen_Emit(&table);
+
+	fprintf(stderr, "%u games, %u blocks, %u surfaces, %u of them settled, the table holds"
+			" %u (%.1f%% of blocks)\n", games, stats.pieces, seenCount, rankedCount, keyCount,
+			100.0 * covered / stats.pieces);
+	fprintf(stderr, "%8s %8s %8s %10s %10s\n", "entries", "bytes", "hits", "blocks", "lines");
+	uint32_t sizes[] = { 256, 1024, 4096, 16384, MAX_ENTRIES };
+	double searchLines = Gen_Evaluate(0), tableLines = 0;
+	for (uint8_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+		if (sizes[i] <= rankedCount) {
+			double lines = Gen_Evaluate(sizes[i]);
+			tableLines = (sizes[i] == keyCount) ? lines : tableLines;
+		}
+	}
+	if (tableLines == 0) {
+		tableLines = Gen_Evaluate(keyCount);
+	}
+
+	// the table stands in for the search, it has to clear as many lines
+	double quality = 100.0 * tableLines / searchLines;
+	fprintf(stderr, "the table of %u clears %.1f%% of the lines the search does%s\n", keyCount,
+			quality, (quality < MIN_QUALITY) ? ", too few to turn on BOT_TABLE" : "");
+
+	// lookups and searches on the boards of one game
+	uint16_t rows[GRID_ROWS] = { 0 };
+	PieceBag bag;
+	Placement best;
+	double lookupTime = 0, searchTime = 0;
+	uint32_t timed = 0;
+	Gen_Build(keyCount, &table);
+	Bag_InitSeeded(&bag, EVAL_SEED);
+	for (uint32_t p = 0; p < MAX_PIECES; p++, timed++) {
+		uint8_t blockNum = Bag_Next(&bag);
+		double start = Gen_Now();
+		for (uint8_t r = 0; r < 100; r++) {
+			Bot_Lookup(&table, rows, blockNum, &best);
+		}
+		lookupTime += Gen_Now() - start;
+		start = Gen_Now();
+		for (uint8_t r = 0; r < 100; r++) {
+			Bot_Search(rows, blockNum, &best);
+		}
+		searchTime += Gen_Now() - start;
+		if (!Bot_Search(rows, blockNum, &best)) {
+			break;
+		}
+		Bot_Lock(rows, blockNum, &best);
+		if (rows[0] | rows[1]) {
+			break;
+		}
+	}
+	fprintf(stderr, "lookup %.2f us, search %.2f us per block\n", lookupTime * 1e4 / timed,
+			searchTime * 1e4 / timed);
+	return (quality < MIN_QUALITY) ? 1 : 0;
+}
@@ -0,0 +1,166 @@
+/*
+ * EvalBench.c
+ *
+ *  Created on: Dec 24, 2024
+ *      Author: Will Fraser
+ *
+ * Host tool for BoardEval.c. Boards are random stacks, every column to a random
+ * height with some of the cells under its top left empty, plus an empty, a full and
+ * a checkered board. The scalar kernel is checked against features counted cell by
+ * cell, from column heights, and every other kernel against the scalar one. Then each
+ * kernel is timed over all boards.
+ *
+ * The Cortex-M4 kernel runs here with the two DSP instructions written out in C, so
+ * it is checked but its time says nothing about the board; ApplicationCode.c times it
+ * there with EVAL_BENCH.
+ *
+ * Build from the repository root:
+ *   gcc -O2 -mavx2 -DEVAL_DSP_EMULATED -ICore/Inc Tools/EvalBench/EvalBench.c
+ *       Core/Src/BoardEval.c -o eval_bench
+ *
+ * Usage: eval_bench [batches] [seed]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "BoardEval.h"
+
+#define MAX_BATCHES 4096
+#define RUN_SECONDS 0.5
+
+typedef struct {
+	const char *name;
+	void (*evaluate)(const EvalBatch *batch, EvalFeatures *features);
+} Kernel;
+
+static EvalBatch batches[MAX_BATCHES];
+static EvalFeatures expected[MAX_BATCHES];
+
+static double Bench_Now(void) {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+static void Bench_Board(uint16_t *rows, uint32_t index) {
+	memset(rows, 0, GRID_ROWS * sizeof(rows[0]));
+	if (index == 1) {
+		memset(rows, 0xFF, GRID_ROWS * sizeof(rows[0]));
+	}
+	for (uint8_t y = 0; y < GRID_ROWS; y++) {
+		rows[y] &= (1u << GRID_WIDTH) - 1;
+		if (index == 2) {
+			rows[y] = ((y & 1) ? 0x555 : 0xAAA);
+		}
+	}
+	if (index < 3) {
+		return;
+	}
+	for (uint8_t x = 0; x < GRID_WIDTH; x++) {
+		uint8_t top = GRID_ROWS - rand() % (GRID_ROWS - 1);
+		for (uint8_t y = top; y < GRID_ROWS; y++) {
+			if ((y == top) || (rand() % 8 != 0)) {
+				rows[y] |= 1 << x;
+			}
+		}
+	}
+}
+
+// The features the slow way, a column and a row at a time
+static void Bench_Reference(const uint16_t *rows, uint16_t out[4]) {
+	uint8_t heights[GRID_WIDTH] = { 0 };
+
+	memset(out, 0, 4 * sizeof(out[0]));
+	for (uint8_t x = 0; x < GRID_WIDTH; x++) {
+		for (uint8_t y = 0; y < GRID_ROWS; y++) {
+			if (rows[y] & (1 << x)) {
+				if (heights[x] == 0) {
+					heights[x] = GRID_ROWS - y;
+				}
+			} else if (heights[x] != 0) {
+				out[1]++;
+			}
+		}
+		out[0] += heights[x];
+		if (x != 0) {
+			out[2] += abs(heights[x] - heights[x - 1]);
+		}
+	}
+	for (uint8_t y = 0; y < GRID_ROWS; y++) {
+		bool last = true;		// wall
+		for (uint8_t x = 0; x <= GRID_WIDTH; x++) {
+			bool filled = (x == GRID_WIDTH) || (rows[y] & (1 << x));
+			out[3] += filled != last;
+			last = filled;
+		}
+	}
+}
+
+static bool Bench_Same(const EvalFeatures *a, const EvalFeatures *b) {
+	return memcmp(a, b, sizeof(*a)) == 0;
+}
+
+int main(int argc, char **argv) {
+	uint32_t count = (argc > 1) ? atoi(argv[1]) : 1024;
+	uint32_t seed = (argc > 2) ? atoi(argv[2]) : 1;
+	Kernel kernels[] = {
+		{ "scalar", Eval_Scalar },
+#ifdef EVAL_HAS_SSE
+		{ "sse", Eval_Sse },
+#endif
+#ifdef EVAL_HAS_AVX2
+		{ "avx2", Eval_Avx2 },
+#endif
+#ifdef EVAL_HAS_DSP
+		{ "dsp (emulated)", Eval_Dsp },
+#endif
+	};
+	uint32_t wrong = 0;
+
+	count = (count > MAX_BATCHES) ? MAX_BATCHES : (count < 1) ? 1 : count;
+	srand(seed);
+	for (uint32_t i = 0; i < count; i++) {
+		for (uint8_t b = 0; b < EVAL_BATCH; b++) {
+			uint16_t rows[GRID_ROWS];
+			uint16_t reference[4];
+
+			Bench_Board(rows, i * EVAL_BATCH + b);
+			Eval_SetBoard(&batches[i], b, rows);
+			Bench_Reference(rows, reference);
+			expected[i].height[b] = reference[0];
+			expected[i].holes[b] = reference[1];
+			expected[i].bumpiness[b] = reference[2];
+			expected[i].transitions[b] = reference[3];
+		}
+	}
+
+	printf("%u boards\n", count * EVAL_BATCH);
+	for (uint8_t k = 0; k < sizeof(kernels) / sizeof(kernels[0]); k++) {
+		EvalFeatures features;
+		uint32_t differ = 0, runs = 0;
+
+		for (uint32_t i = 0; i < count; i++) {
+			kernels[k].evaluate(&batches[i], &features);
+			differ += !Bench_Same(&features, &expected[i]);
+		}
+		wrong += differ;
+
+		double start = Bench_Now(), elapsed;
+		uint32_t sink = 0;
+		do {
+			for (uint32_t i = 0; i < count; i++) {
+				kernels[k].evaluate(&batches[i], &features);
+				sink += features.holes[i % EVAL_BATCH];
+			}
+			runs++;
+			elapsed = Bench_Now() - start;
+		} while (elapsed < RUN_SECONDS);
+		printf("%-16s %6.1f M boards/s, %u batches differ%s\n", kernels[k].name,
+				(double) runs * count * EVAL_BATCH / elapsed * 1e-6, differ,
+				(sink == 0) ? " " : "");
+	}
+	return wrong ? 1 : 0;
+}
@@ -0,0 +1,194 @@
+/*
+ * FeatureCheck.c
+ *
+ *  Created on: Dec 19, 2024
+ *      Author: Will Fraser
+ *
+ * Host check for the board features the engine keeps up to date (column heights,
+ * row fill, holes, stack height). Random games are played with a mix of greedy
+ * drops that clear lines, random drops, and slides that tuck a block under an
+ * overhang after it lands, and after every placement the engine's values are
+ * compared with a count straight off gameGrid. Any difference fails the run.
+ *
+ * Build from the repository root:
+ *   gcc -O2 -ICore/Inc Tools/FeatureCheck/FeatureCheck.c Core/Src/GameEngine.c
+ *       Core/Src/PieceBag.c -o feature_check
+ *
+ * Usage: feature_check [games] [seed]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "GameEngine.h"
+
+#define MAX_PIECES 600		// per game, greedy play rarely tops out on its own
+#define ACTIONS    (4 * GRID_WIDTH)
+
+static GameState state;
+static GameState trial;
+static uint32_t clears[5];
+static uint32_t tucks;			// placements that filled a hole
+static uint32_t placements;
+
+// Features counted from scratch
+static void Check_Count(const GameState *game, BoardFeatures *features) {
+	memset(features, 0, sizeof(*features));
+	for (uint8_t x = 0; x < GRID_WIDTH; x++) {
+		for (uint8_t y = 0; y < GRID_ROWS; y++) {
+			if (game->gameGrid[y][x] == EMPTY_CELL) {
+				features->holes += (features->columnHeights[x] != 0);
+				continue;
+			}
+			features->rowFill[y]++;
+			if (features->columnHeights[x] == 0) {
+				features->columnHeights[x] = GRID_ROWS - y;
+			}
+		}
+		if (features->columnHeights[x] > features->stackHeight) {
+			features->stackHeight = features->columnHeights[x];
+		}
+	}
+}
+
+static int Check_Compare(const GameState *game, uint32_t gameNum) {
+	const BoardFeatures *kept = Engine_GetFeatures(game);
+	BoardFeatures counted;
+
+	Check_Count(game, &counted);
+	if (memcmp(kept, &counted, sizeof(counted)) == 0) {
+		return 0;
+	}
+
+	printf("game %u piece %u: holes %u/%u height %u/%u\n", gameNum, game->piecesPlaced,
+			kept->holes, counted.holes, kept->stackHeight, counted.stackHeight);
+	for (uint8_t x = 0; x < GRID_WIDTH; x++) {
+		printf(" %u/%u", kept->columnHeights[x], counted.columnHeights[x]);
+	}
+	printf("\n");
+	return 1;
+}
+
+static uint8_t Check_Left(const GameState *game) {
+	for (uint8_t x = 0; x < GRID_WIDTH; x++) {
+		for (uint8_t y = 0; y < GRID_ROWS; y++) {
+			if (game->currentBlock[y][x] != EMPTY_CELL) {
+				return x;
+			}
+		}
+	}
+	return 0;
+}
+
+// Turn, shift to the column and drop, then optionally slide sideways before locking
+static void Check_Place(GameState *game, uint8_t action, int8_t slide) {
+	for (uint8_t r = 0; r < action / GRID_WIDTH; r++) {
+		RotateCurrentBlock(game, ROTATE_RIGHT);
+	}
+	uint8_t column = action % GRID_WIDTH;
+	for (uint8_t i = 0; i < GRID_WIDTH; i++) {
+		uint8_t left = Check_Left(game);
+		if (left != column) {
+			MoveCurrentBlock(game, (left > column) ? MOVE_LEFT : MOVE_RIGHT);
+		}
+	}
+	while (!MoveCurrentBlock(game, MOVE_DOWN)) {
+	}
+
+	// slide after landing and let it fall again, this is how blocks get under overhangs
+	for (int8_t i = 0; i < abs(slide); i++) {
+		MoveCurrentBlock(game, (slide < 0) ? MOVE_LEFT : MOVE_RIGHT);
+		while (!MoveCurrentBlock(game, MOVE_DOWN)) {
+		}
+	}
+
+	PlaceCurrentBlock(game);
+	if (!game->gameOver) {
+		GenerateBlock(game, RANDOM_BLOCK);
+	}
+}
+
+// Lowest, flattest landing with the fewest holes, clears first
+static uint8_t Check_Greedy(const GameState *game) {
+	int32_t bestScore = INT32_MIN;
+	uint8_t best = 0;
+
+	for (uint8_t action = 0; action < ACTIONS; action++) {
+		trial = *game;
+		uint16_t lines = trial.score[0] + trial.score[1] + trial.score[2] + trial.score[3];
+		Check_Place(&trial, action, 0);
+		const BoardFeatures *features = Engine_GetFeatures(&trial);
+		int32_t score = -8 * features->holes - 2 * features->stackHeight - rand() % 3;
+		for (uint8_t x = 0; x < GRID_WIDTH; x++) {
+			score -= features->columnHeights[x];
+		}
+		score += 20 * (trial.score[0] + trial.score[1] + trial.score[2] + trial.score[3] - lines);
+		score -= trial.gameOver ? 1000 : 0;
+		if (score > bestScore) {
+			bestScore = score;
+			best = action;
+		}
+	}
+	return best;
+}
+
+static int Check_Game(uint32_t gameNum, uint32_t seed) {
+	Engine_NewGame(&state, seed);
+	if (Check_Compare(&state, gameNum)) {
+		return 1;
+	}
+
+	while (!state.gameOver && (state.piecesPlaced < MAX_PIECES)) {
+		uint16_t before[4];
+		uint8_t holes = Engine_GetFeatures(&state)->holes;
+		int8_t slide = 0;
+		uint8_t action;
+
+		memcpy(before, state.score, sizeof(before));
+		switch (rand() % 8) {
+		case 0:
+			action = rand() % ACTIONS;
+			break;
+		case 1:
+		case 2:
+			action = rand() % ACTIONS;
+			slide = rand() % 7 - 3;
+			break;
+		default:
+			action = Check_Greedy(&state);
+			break;
+		}
+		Check_Place(&state, action, slide);
+		placements++;
+
+		uint8_t cleared = 0;
+		for (uint8_t i = 0; i < 4; i++) {
+			cleared += (state.score[i] != before[i]) ? i + 1 : 0;
+		}
+		clears[cleared]++;
+		tucks += (cleared == 0) && (Engine_GetFeatures(&state)->holes < holes);
+
+		if (Check_Compare(&state, gameNum)) {
+			return 1;
+		}
+	}
+	return 0;
+}
+
+int main(int argc, char **argv) {
+	uint32_t games = (argc > 1) ? atoi(argv[1]) : 2000;
+	uint32_t seed = (argc > 2) ? atoi(argv[2]) : 1;
+	uint32_t failed = 0;
+
+	srand(seed);
+	for (uint32_t g = 0; g < games; g++) {
+		failed += Check_Game(g, seed * 7919u + g);
+	}
+
+	printf("%u games, %u placements, %u tucks into holes\n", games, placements, tucks);
+	printf("clears: %u single, %u double, %u triple, %u tetris\n", clears[1], clears[2],
+			clears[3], clears[4]);
+	printf("%s: %u games differ\n", failed ? "FAIL" : "PASS", failed);
+	return failed ? 1 : 0;
+}
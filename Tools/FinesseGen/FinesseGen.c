@@ -0,0 +1,268 @@
+/*
+ * FinesseGen.c
+ *
+ *  Created on: Dec 21, 2024
+ *      Author: Will Fraser
+ *
+ * Host tool, finds the fewest touches from the spawn to every rotation and box column
+ * of every block and writes Core/Src/FinesseTables.c. The search is breadth first over
+ * (x, rotation) on an empty board, each step one touch applied with MoveCurrentBlock
+ * or RotateCurrentBlock, so the walls stop turns exactly as they do in a game. Run it
+ * again whenever tetrisBlocks, SPAWN_X, the grid or the touch controls change.
+ *
+ * Every sequence is played back on the engine and has to land the block on the cells
+ * it stands for. The time to run the whole search and to look one placement up in the
+ * tables are printed to stderr.
+ *
+ * Build and run from the repository root:
+ *   gcc -O2 -ICore/Inc Tools/FinesseGen/FinesseGen.c Core/Src/GameEngine.c
+ *       Core/Src/PieceBag.c -o finesse_gen
+ *   ./finesse_gen > Core/Src/FinesseTables.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "Finesse.h"
+
+#define ROUNDS  200			// timing repeats of the search
+#define LOOKUPS 10000000
+#define STATES  (FINESSE_ROTATIONS * FINESSE_COLUMNS)
+
+typedef struct {
+	GameState game;
+	int16_t parent;			// state index, -1 at the spawn
+	uint8_t input;			// touch from the parent
+	uint8_t presses;
+} SearchState;
+
+static SearchState states[STATES];
+static uint16_t boxes[7][FINESSE_ROTATIONS];
+static uint32_t paths[7][FINESSE_ROTATIONS][FINESSE_COLUMNS];
+
+static double Gen_Now(void) {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+static uint16_t Gen_Box(const GameState *game) {
+	uint16_t box = 0;
+
+	for (int8_t y = 0; y < BLOCK_SIZE; y++) {
+		for (int8_t x = 0; x < BLOCK_SIZE; x++) {
+			int8_t gridX = game->currentBlockX + x;
+			if ((gridX >= 0) && (gridX < GRID_WIDTH)
+					&& game->currentBlock[game->currentBlockY + y][gridX] != EMPTY_CELL) {
+				box |= 1 << (y * BLOCK_SIZE + x);
+			}
+		}
+	}
+	return box;
+}
+
+// Cells a straight drop ends on, grid column masks from the top cell row down
+static uint64_t Gen_DropKey(const GameState *game) {
+	uint64_t key = 0;
+	uint8_t rows = 0;
+
+	for (uint8_t y = 0; y < GRID_ROWS; y++) {
+		uint16_t row = 0;
+		for (uint8_t x = 0; x < GRID_WIDTH; x++) {
+			row |= (game->currentBlock[y][x] != EMPTY_CELL) << x;
+		}
+		if (row || rows) {
+			key |= (uint64_t) row << (GRID_WIDTH * rows++);
+		}
+	}
+	return key;
+}
+
+static uint8_t Gen_Index(uint8_t rotation, int8_t x) {
+	return rotation * FINESSE_COLUMNS + x + FINESSE_X_BIAS;
+}
+
+// One touch from a state, false when the engine refuses it
+static bool Gen_Touch(GameState *game, uint8_t input, uint8_t *rotation) {
+	int8_t x = game->currentBlockX;
+
+	switch (input) {
+	case INPUT_MOVE_LEFT:
+		MoveCurrentBlock(game, MOVE_LEFT);
+		return game->currentBlockX != x;
+	case INPUT_MOVE_RIGHT:
+		MoveCurrentBlock(game, MOVE_RIGHT);
+		return game->currentBlockX != x;
+	case INPUT_ROTATE_LEFT:
+		*rotation = (*rotation + FINESSE_ROTATIONS - 1) % FINESSE_ROTATIONS;
+		return !RotateCurrentBlock(game, ROTATE_LEFT);
+	default:
+		*rotation = (*rotation + 1) % FINESSE_ROTATIONS;
+		return !RotateCurrentBlock(game, ROTATE_RIGHT);
+	}
+}
+
+// Breadth first from the spawn, then every state takes the shortest path to its cells
+static void Gen_Search(uint8_t blockNum) {
+	uint8_t queue[STATES];
+	uint8_t head = 0, tail = 0;
+	uint64_t keys[STATES];
+
+	for (uint16_t i = 0; i < STATES; i++) {
+		states[i].presses = FINESSE_UNREACHABLE;
+	}
+
+	GameState *spawn = &states[Gen_Index(0, SPAWN_X)].game;
+	InitGameGrid(spawn);
+	spawn->gameOver = false;
+	GenerateBlock(spawn, blockNum);
+	states[Gen_Index(0, SPAWN_X)].parent = -1;
+	states[Gen_Index(0, SPAWN_X)].presses = 0;
+	queue[tail++] = Gen_Index(0, SPAWN_X);
+
+	while (head != tail) {
+		uint8_t from = queue[head++];
+		for (uint8_t input = INPUT_MOVE_LEFT; input <= INPUT_ROTATE_RIGHT; input++) {
+			GameState next = states[from].game;
+			uint8_t rotation = from / FINESSE_COLUMNS;
+			if (!Gen_Touch(&next, input, &rotation)) {
+				continue;
+			}
+			uint8_t to = Gen_Index(rotation, next.currentBlockX);
+			if (states[to].presses != FINESSE_UNREACHABLE) {
+				continue;
+			}
+			states[to].game = next;
+			states[to].parent = from;
+			states[to].input = input;
+			states[to].presses = states[from].presses + 1;
+			queue[tail++] = to;
+		}
+	}
+
+	for (uint8_t r = 0; r < FINESSE_ROTATIONS; r++) {
+		boxes[blockNum - 1][r] = Gen_Box(&states[Gen_Index(r, SPAWN_X)].game);
+	}
+	for (uint16_t i = 0; i < STATES; i++) {
+		if (states[i].presses != FINESSE_UNREACHABLE) {
+			keys[i] = Gen_DropKey(&states[i].game);
+		}
+	}
+
+	// the shortest of all states that drop onto the same cells, packed last touch first
+	for (uint16_t i = 0; i < STATES; i++) {
+		uint32_t *path = &paths[blockNum - 1][i / FINESSE_COLUMNS][i % FINESSE_COLUMNS];
+		*path = FINESSE_UNREACHABLE;
+		if (states[i].presses == FINESSE_UNREACHABLE) {
+			continue;
+		}
+		int16_t best = i;
+		for (uint16_t j = 0; j < STATES; j++) {
+			if ((states[j].presses < states[best].presses) && (keys[j] == keys[i])) {
+				best = j;
+			}
+		}
+		*path = states[best].presses;
+		for (int16_t s = best; states[s].parent >= 0; s = states[s].parent) {
+			*path |= (uint32_t) states[s].input << (4 + 2 * (states[s].presses - 1));
+		}
+	}
+}
+
+// Every sequence from a fresh spawn has to end on the cells of the state it is for
+static uint32_t Gen_Check(uint8_t blockNum) {
+	uint32_t failed = 0;
+
+	for (uint16_t i = 0; i < STATES; i++) {
+		uint32_t path = paths[blockNum - 1][i / FINESSE_COLUMNS][i % FINESSE_COLUMNS];
+		if (FINESSE_PRESSES(path) == FINESSE_UNREACHABLE) {
+			continue;
+		}
+		GameState game;
+		uint8_t rotation = 0;
+		InitGameGrid(&game);
+		game.gameOver = false;
+		GenerateBlock(&game, blockNum);
+		for (uint8_t p = 0; p < FINESSE_PRESSES(path); p++) {
+			failed += !Gen_Touch(&game, FINESSE_INPUT(path, p), &rotation);
+		}
+		failed += Gen_DropKey(&game) != Gen_DropKey(&states[i].game);
+	}
+	return failed;
+}
+
+static void Gen_Emit(void) {
+	printf("/*\n * FinesseTables.c\n *\n * Generated by Tools/FinesseGen, do not edit.\n */\n\n");
+	printf("#include \"Finesse.h\"\n\n");
+
+	printf("const uint16_t finesseBoxes[7][FINESSE_ROTATIONS] = {");
+	for (uint8_t block = 0; block < 7; block++) {
+		printf("\n\t\t{ 0x%04X, 0x%04X, 0x%04X, 0x%04X },", boxes[block][0], boxes[block][1],
+				boxes[block][2], boxes[block][3]);
+	}
+	printf("\n};\n\n");
+
+	// presses in the low nibble, touches 2 bits each above, 0xF where the box cannot go
+	printf("const uint32_t finessePaths[7][FINESSE_ROTATIONS][FINESSE_COLUMNS] = {");
+	for (uint8_t block = 0; block < 7; block++) {
+		printf("\n\t\t{");
+		for (uint8_t r = 0; r < FINESSE_ROTATIONS; r++) {
+			printf("\n\t\t\t\t{");
+			for (uint8_t x = 0; x < FINESSE_COLUMNS; x++) {
+				printf("%s0x%08X,", (x % 5) ? " " : "\n\t\t\t\t\t\t", paths[block][r][x]);
+			}
+			printf("\n\t\t\t\t},");
+		}
+		printf("\n\t\t},");
+	}
+	printf("\n};\n");
+}
+
+int main(void) {
+	uint32_t failed = 0, placements = 0, longest = 0;
+
+	for (uint8_t block = I_BLOCK; block <= L_BLOCK; block++) {
+		Gen_Search(block);
+		failed += Gen_Check(block);
+		for (uint16_t i = 0; i < STATES; i++) {
+			uint32_t presses = FINESSE_PRESSES(paths[block - 1][i / FINESSE_COLUMNS][i % FINESSE_COLUMNS]);
+			if (presses != FINESSE_UNREACHABLE) {
+				placements++;
+				longest = (presses > longest) ? presses : longest;
+			}
+		}
+	}
+	if (failed || (longest > FINESSE_MAX_PRESSES)) {
+		fprintf(stderr, "%u sequences do not reach their cells, longest %u\n", failed, longest);
+		return 1;
+	}
+	Gen_Emit();
+
+	double start = Gen_Now();
+	for (uint32_t round = 0; round < ROUNDS; round++) {
+		for (uint8_t block = I_BLOCK; block <= L_BLOCK; block++) {
+			Gen_Search(block);
+		}
+	}
+	double search = (Gen_Now() - start) / ROUNDS;
+
+	// lookups at random placements, summed so they are not optimised away
+	volatile uint32_t sum = 0;
+	uint32_t lcg = 1;
+	start = Gen_Now();
+	for (uint32_t i = 0; i < LOOKUPS; i++) {
+		lcg = lcg * 1103515245u + 12345u;
+		uint32_t index = (lcg >> 8) % (7 * STATES);
+		sum += paths[index / STATES][index % STATES / FINESSE_COLUMNS][index % FINESSE_COLUMNS];
+	}
+	double lookup = (Gen_Now() - start) / LOOKUPS;
+
+	fprintf(stderr, "%u rotations and columns reachable, longest %u touches\n", placements,
+			longest);
+	fprintf(stderr, "search all blocks %.1f us, %.2f us per placement, lookup %.1f ns\n",
+			search * 1e6, search * 1e6 / placements, lookup * 1e9);
+	fprintf(stderr, "tables %zu bytes of flash\n", sizeof(boxes) + sizeof(paths));
+	return 0;
+}
@@ -0,0 +1,274 @@
+/*
+ * GlyphBench.c
+ *
+ *  Created on: Dec 11, 2024
+ *      Author: Will Fraser
+ *
+ * Host tool, checks that LCD_Draw_Char in LCD_Graphics.c draws exactly the same
+ * pixels as the original per-pixel version for every glyph of every font at odd
+ * and even positions over a random background, then measures characters per second
+ * for both. LCD_DisplayString and LCD_DisplayNumber are checked the same way,
+ * including strings clipped at every edge of the screen, and timed against drawing
+ * the results screen text the old way with snprintf and one call per character.
+ *
+ * Build from the repository root:
+ *   gcc -O2 -ICore/Inc Tools/GlyphBench/GlyphBench.c Core/Src/LCD_Graphics.c
+ *       Core/Src/GlyphMasks.c Core/Src/fonts.c -o glyph_bench
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "LCD_Graphics.h"
+
+// The original renderer, drawing into its own buffer
+static uint16_t referenceBuffer[LCD_PIXEL_WIDTH * LCD_PIXEL_HEIGHT];
+static FONT_t *referenceFont;
+static uint16_t referenceColor;
+
+static void Reference_Draw_Char(uint16_t Xpos, uint16_t Ypos, const uint16_t *c) {
+	uint32_t index = 0, counter = 0;
+	for (index = 0; index < referenceFont->Height; index++) {
+		for (counter = 0; counter < referenceFont->Width; counter++) {
+			if ((((c[index]
+					& ((0x80 << ((referenceFont->Width / 12) * 8)) >> counter))
+					== 0x00) && (referenceFont->Width <= 12))
+					|| (((c[index] & (0x1 << counter)) == 0x00)
+							&& (referenceFont->Width > 12))) {
+			} else {
+				referenceBuffer[(index + Ypos) * LCD_PIXEL_WIDTH + counter + Xpos] =
+						referenceColor;
+			}
+		}
+	}
+}
+
+// The original renderer, one character at a time with every pixel clipped to the screen
+static void Reference_Draw_String(int Xpos, int Ypos, const char *text) {
+	for (; *text != '\0'; text++, Xpos += referenceFont->Width + LCD_CHAR_SPACING) {
+		const uint16_t *c = &referenceFont->table[(*text - 32) * referenceFont->Height];
+		for (int index = 0; index < referenceFont->Height; index++) {
+			for (int counter = 0; counter < referenceFont->Width; counter++) {
+				int x = Xpos + counter, y = Ypos + index;
+				uint16_t probe = (referenceFont->Width <= 12) ?
+						(0x80 << ((referenceFont->Width / 12) * 8)) >> counter : 0x1 << counter;
+				if ((c[index] & probe) && (x >= 0) && (x < LCD_PIXEL_WIDTH) && (y >= 0)
+						&& (y < LCD_PIXEL_HEIGHT)) {
+					referenceBuffer[y * LCD_PIXEL_WIDTH + x] = referenceColor;
+				}
+			}
+		}
+	}
+}
+
+static void Bench_Font(FONT_t *font) {
+	LCD_SetFont(font);
+	referenceFont = font;
+}
+
+static void Bench_Color(uint16_t color) {
+	LCD_SetTextColor(color);
+	referenceColor = color;
+}
+
+static void Bench_Background(void) {
+	for (uint32_t i = 0; i < LCD_PIXELS; i++) {
+		frameBuffer[i] = (uint16_t) rand();
+	}
+	memcpy(referenceBuffer, frameBuffer, sizeof(referenceBuffer));
+}
+
+// Draw every glyph of a table at every x over a few rows, returns the number of mismatches
+static int Bench_Compare(const char *name, FONT_t *font, const uint16_t *table,
+		unsigned count) {
+	int errors = 0;
+
+	Bench_Font(font);
+	for (unsigned glyph = 0; glyph < count; glyph++) {
+		const uint16_t *c = &table[glyph * font->Height];
+		Bench_Background();
+		Bench_Color((uint16_t) rand());
+		for (uint16_t x = 0; x + font->Width <= LCD_PIXEL_WIDTH; x += 1 + (glyph % 3)) {
+			uint16_t y = (uint16_t) ((x * 7 + glyph * 13) % (LCD_PIXEL_HEIGHT - font->Height));
+			LCD_Draw_Char(x, y, c);
+			Reference_Draw_Char(x, y, c);
+		}
+		if (memcmp(frameBuffer, referenceBuffer, sizeof(referenceBuffer)) != 0) {
+			if (errors++ < 5) {
+				printf("%s: glyph %u differs\n", name, glyph);
+			}
+		}
+	}
+	printf("%-28s %3u glyphs  %s\n", name, count, errors ? "FAILED" : "match");
+	return errors;
+}
+
+// Strings at random positions including off every edge, and numbers against snprintf
+static int Bench_Strings(const char *name, FONT_t *font) {
+	static const char *samples[] = { "TETRIS", "GO", "TIME MS", "SINGLES", "TETRIS!",
+			"BEST", "Hello, world", "0123456789", "~{|}", "A", "" };
+	char text[LCD_NUMBER_DIGITS + 1], expected[16];
+	int errors = 0;
+
+	Bench_Font(font);
+	for (int i = 0; i < 20000; i++) {
+		const char *sample = samples[i % (sizeof(samples) / sizeof(samples[0]))];
+		int x = rand() % (LCD_PIXEL_WIDTH + 300) - 250;
+		int y = rand() % (LCD_PIXEL_HEIGHT + 60) - 30;
+		uint8_t align = (uint8_t) (rand() % 3);
+		int left = x;
+
+		if (i % 5 == 0) {
+			uint32_t value = (i % 10 == 0) ? (uint32_t) rand() * 2u + 1 : (uint32_t) (rand() % 100);
+			snprintf(expected, sizeof(expected), "%lu", (unsigned long) value);
+			if ((LCD_FormatNumber(value, text) != strlen(expected))
+					|| (strcmp(text, expected) != 0)) {
+				printf("%s: %lu formatted as %s\n", name, (unsigned long) value, text);
+				errors++;
+			}
+			sample = expected;
+		}
+
+		if (align == LCD_ALIGN_CENTER) {
+			left -= LCD_StringWidth(sample) / 2;
+		} else if (align == LCD_ALIGN_RIGHT) {
+			left -= LCD_StringWidth(sample);
+		}
+
+		if (i % 64 == 0) {
+			Bench_Background();
+		}
+		Bench_Color((uint16_t) rand());
+		if (i % 5 == 0) {
+			LCD_DisplayNumber(x, y, strtoul(sample, NULL, 10), align);
+		} else {
+			LCD_DisplayString(x, y, sample, align);
+		}
+		Reference_Draw_String(left, y, sample);
+
+		if (memcmp(frameBuffer, referenceBuffer, sizeof(referenceBuffer)) != 0) {
+			if (errors++ < 5) {
+				printf("%s: \"%s\" at %d,%d align %u differs\n", name, sample, x, y, align);
+			}
+			memcpy(referenceBuffer, frameBuffer, sizeof(referenceBuffer));
+		}
+	}
+	printf("%-28s strings    %s\n", name, errors ? "FAILED" : "match");
+	return errors;
+}
+
+static double Bench_Seconds(void) {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+// Fill the screen with text over and over, characters per second for both renderers
+static void Bench_Speed(const char *name, FONT_t *font, unsigned count) {
+	const unsigned chars = 2000000;
+	double start, fast, slow;
+
+	Bench_Font(font);
+	Bench_Color(LCD_COLOR_WHITE);
+
+	start = Bench_Seconds();
+	for (unsigned i = 0; i < chars; i++) {
+		unsigned cell = i % ((LCD_PIXEL_WIDTH / font->Width) * (LCD_PIXEL_HEIGHT / font->Height));
+		LCD_DisplayChar((cell % (LCD_PIXEL_WIDTH / font->Width)) * font->Width + (i & 1),
+				(cell / (LCD_PIXEL_WIDTH / font->Width)) * font->Height, 32 + i % count);
+	}
+	fast = Bench_Seconds() - start;
+
+	start = Bench_Seconds();
+	for (unsigned i = 0; i < chars; i++) {
+		unsigned cell = i % ((LCD_PIXEL_WIDTH / font->Width) * (LCD_PIXEL_HEIGHT / font->Height));
+		Reference_Draw_Char((cell % (LCD_PIXEL_WIDTH / font->Width)) * font->Width + (i & 1),
+				(cell / (LCD_PIXEL_WIDTH / font->Width)) * font->Height,
+				&font->table[(i % count) * font->Height]);
+	}
+	slow = Bench_Seconds() - start;
+
+	printf("%-8s %10.0f chars/s before, %10.0f chars/s after, %.1fx\n", name,
+			chars / slow, chars / fast, slow / fast);
+}
+
+// The text of the results screen, before and after
+static void Bench_Results(void) {
+	static const char *labels[] = { "TOTAL", "TIME MS", "SINGLES", "DOUBLES",
+			"TRIPLES", "TETRIS!", "BEST" };
+	static const uint16_t labelY[] = { 61, 81, 181, 201, 221, 241, 281 };
+	const unsigned screens = 100000;
+	double start, before, after;
+	char buffer[11];
+
+	Bench_Font(&Font16x24);
+	Bench_Color(LCD_COLOR_WHITE);
+
+	start = Bench_Seconds();
+	for (unsigned s = 0; s < screens; s++) {
+		for (unsigned l = 0; l < 7; l++) {
+			uint16_t x = (l < 2) ? 120 - (strlen(labels[l]) * 20 - 4) / 2 : 32;
+			for (const char *c = labels[l]; *c != '\0'; c++, x += 20) {
+				Reference_Draw_Char(x, labelY[l], &Font16x24.table[(*c - 32) * 24]);
+			}
+		}
+		for (unsigned n = 0; n < 6; n++) {
+			snprintf(buffer, sizeof(buffer), "%lu", (unsigned long) (s * 7 + n));
+			uint16_t x = 80;
+			for (const char *c = buffer; *c != '\0'; c++, x += 20) {
+				Reference_Draw_Char(x, 121 + n * 20, &Font16x24.table[(*c - 32) * 24]);
+			}
+		}
+	}
+	before = Bench_Seconds() - start;
+
+	start = Bench_Seconds();
+	for (unsigned s = 0; s < screens; s++) {
+		for (unsigned l = 0; l < 7; l++) {
+			LCD_DisplayString((l < 2) ? 120 : 32, labelY[l], labels[l],
+					(l < 2) ? LCD_ALIGN_CENTER : LCD_ALIGN_LEFT);
+		}
+		for (unsigned n = 0; n < 6; n++) {
+			LCD_DisplayNumber(208, 121 + n * 20, s * 7 + n, LCD_ALIGN_RIGHT);
+		}
+	}
+	after = Bench_Seconds() - start;
+
+	printf("results text  %8.0f screens/s before, %8.0f screens/s after, %.1fx\n",
+			screens / before, screens / after, before / after);
+}
+
+int main(void) {
+	static uint16_t copy16x24[95 * 24], copy12x12[96 * 12], narrow[40 * 12];
+	FONT_t copyFont16x24 = { copy16x24, 16, 24 };
+	FONT_t copyFont12x12 = { copy12x12, 12, 12 };
+	FONT_t narrowFont = { narrow, 8, 12 };
+	int errors = 0;
+
+	srand(1);
+	memcpy(copy16x24, Font16x24.table, sizeof(copy16x24));
+	memcpy(copy12x12, Font12x12.table, sizeof(copy12x12));
+	for (unsigned i = 0; i < sizeof(narrow) / sizeof(narrow[0]); i++) {
+		narrow[i] = (uint16_t) rand();
+	}
+
+	// precomputed masks
+	errors += Bench_Compare("Font16x24", &Font16x24, Font16x24.table, 95);
+	errors += Bench_Compare("Font12x12", &Font12x12, Font12x12.table, 96);
+	// tables without masks go through the fallback
+	errors += Bench_Compare("16x24 copy (fallback)", &copyFont16x24, copy16x24, 95);
+	errors += Bench_Compare("12x12 copy (fallback)", &copyFont12x12, copy12x12, 96);
+	errors += Bench_Compare("8x12 random (fallback)", &narrowFont, narrow, 40);
+
+	errors += Bench_Strings("Font16x24", &Font16x24);
+	errors += Bench_Strings("Font12x12", &Font12x12);
+	errors += Bench_Strings("16x24 copy (fallback)", &copyFont16x24);
+
+	Bench_Speed("16x24", &Font16x24, 95);
+	Bench_Speed("12x12", &Font12x12, 96);
+	Bench_Results();
+
+	return errors ? 1 : 0;
+}
@@ -0,0 +1,73 @@
+/*
+ * GlyphGen.c
+ *
+ *  Created on: Dec 11, 2024
+ *      Author: Will Fraser
+ *
+ * Host tool, converts the font tables in fonts.c into the normalised row masks
+ * used by LCD_Draw_Char and writes Core/Src/GlyphMasks.c. Run it again whenever
+ * fonts.c changes.
+ *
+ * Build and run from the repository root:
+ *   gcc -O2 -ICore/Inc Tools/GlyphGen/GlyphGen.c -o glyph_gen
+ *   ./glyph_gen > Core/Src/GlyphMasks.c
+ */
+
+#include <stdio.h>
+
+// pulled in whole so sizeof gives the table lengths
+#include "../../Core/Src/fonts.c"
+
+// 16x24 rows are LSB first, 12x12 rows are MSB first from bit 15
+static uint16_t Normalise(uint16_t row, uint16_t width) {
+	uint16_t mask = 0;
+
+	for (uint16_t x = 0; x < width; x++) {
+		uint16_t set = (width > 12) ? (row >> x) & 1 : (row >> (15 - x)) & 1;
+		mask |= set << x;
+	}
+	return mask;
+}
+
+static void EmitSet(const char *name, const FONT_t *font, unsigned count) {
+	printf("static const uint16_t %sRows[%u] = {", name, count * font->Height);
+	for (unsigned glyph = 0; glyph < count; glyph++) {
+		for (unsigned y = 0; y < font->Height; y++) {
+			uint16_t row = font->table[glyph * font->Height + y];
+			printf("%s0x%04X,", (y % 12) ? " " : "\n\t\t",
+					Normalise(row, font->Width));
+		}
+	}
+	printf("\n};\n\n");
+
+	// first row with pixels and how many rows down to the last one, 0,0 for blanks
+	printf("static const uint8_t %sExtent[%u] = {", name, count * 2);
+	for (unsigned glyph = 0; glyph < count; glyph++) {
+		int first = -1, last = -1;
+		for (unsigned y = 0; y < font->Height; y++) {
+			if (Normalise(font->table[glyph * font->Height + y], font->Width)) {
+				if (first < 0) {
+					first = (int) y;
+				}
+				last = (int) y;
+			}
+		}
+		printf("%s%d, %d,", (glyph % 8) ? " " : "\n\t\t", first < 0 ? 0 : first,
+				first < 0 ? 0 : last - first + 1);
+	}
+	printf("\n};\n\n");
+
+	printf("const GlyphSet %s = { %sRows, %sExtent, %u, %u };\n\n", name, name,
+			name, count, font->Height);
+}
+
+int main(void) {
+	printf("/*\n * GlyphMasks.c\n *\n * Generated by Tools/GlyphGen from fonts.c, do not edit.\n */\n\n");
+	printf("#include \"GlyphMasks.h\"\n\n");
+
+	EmitSet("Glyphs16x24", &Font16x24,
+			sizeof(ASCII16x24_Table) / sizeof(ASCII16x24_Table[0]) / Font16x24.Height);
+	EmitSet("Glyphs12x12", &Font12x12,
+			sizeof(ASCII12x12_Table) / sizeof(ASCII12x12_Table[0]) / Font12x12.Height);
+	return 0;
+}
@@ -0,0 +1,212 @@
+/*
+ * LineClearBench.c
+ *
+ *  Created on: Dec 13, 2024
+ *      Author: Will Fraser
+ *
+ * Host tool for BoardView.c. Random games almost never clear a line, so the engine
+ * is replaced here by a small board model with the same read functions. Each round
+ * builds a random stack with n full rows (not always next to each other), draws it,
+ * clears the rows the way ClearCompleteLines does and spawns a new piece. The frame
+ * after the clear is drawn through the row shift and compared pixel for pixel with a
+ * full repaint. Both are timed for single, double, triple and Tetris clears.
+ *
+ * Build from the repository root:
+ *   gcc -O2 -ICore/Inc Tools/LineClearBench/LineClearBench.c Core/Src/BoardView.c
+ *       Core/Src/ScanSync.c Core/Src/TileAtlas.c Core/Src/LCD_Graphics.c
+ *       Core/Src/GlyphMasks.c Core/Src/fonts.c -o line_clear_bench
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "BoardView.h"
+
+#define ROUNDS   5000
+#define RESERVED ((1 << 0) | (0x0F << 8))	// hold slot and preview panel in row 0
+
+// Board model standing in for GameEngine.c, the GameState passed in is not used
+static uint8_t grid[GRID_HEIGHT][GRID_WIDTH];
+static uint8_t piece[GRID_HEIGHT][GRID_WIDTH];
+static uint16_t clearedRows;
+
+uint8_t Engine_CellAt(const GameState *game, uint8_t x, uint8_t y) {
+	(void) game;
+	return (grid[y][x] != EMPTY_CELL) ? grid[y][x] : piece[y][x];
+}
+
+uint16_t Engine_TakeClearedRows(GameState *game) {
+	(void) game;
+	uint16_t taken = clearedRows;
+	clearedRows = 0;
+	return taken;
+}
+
+static bool Model_Fits(uint8_t drop) {
+	for (uint8_t y = 0; y < GRID_HEIGHT; y++) {
+		for (uint8_t x = 0; x < GRID_WIDTH; x++) {
+			if ((piece[y][x] != EMPTY_CELL)
+					&& ((y + drop >= GRID_HEIGHT) || (grid[y + drop][x] != EMPTY_CELL))) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+uint8_t Engine_GhostDrop(const GameState *game) {
+	(void) game;
+	uint8_t drop = 0;
+	while ((drop < GRID_HEIGHT) && Model_Fits(drop + 1)) {
+		drop++;
+	}
+	return drop;
+}
+
+uint8_t Engine_GhostAt(const GameState *game, uint8_t x, uint8_t y, uint8_t drop) {
+	(void) game;
+	if ((drop == 0) || (y < drop) || (grid[y][x] != EMPTY_CELL)
+			|| (piece[y][x] != EMPTY_CELL)) {
+		return EMPTY_CELL;
+	}
+	return piece[y - drop][x];
+}
+
+// A few cells of one block in a 4x4 box near the top, clear of the stack
+static void Model_Spawn(void) {
+	uint8_t blockNum = 1 + rand() % 7;
+	uint8_t left = rand() % (GRID_WIDTH - BLOCK_SIZE + 1);
+	uint8_t top = rand() % 3;
+
+	memset(piece, EMPTY_CELL, sizeof(piece));
+	for (uint8_t i = 0; i < 4; i++) {
+		uint8_t x = left + rand() % BLOCK_SIZE, y = top + rand() % BLOCK_SIZE;
+		if (grid[y][x] == EMPTY_CELL) {
+			piece[y][x] = blockNum;
+		}
+	}
+}
+
+// Stack of random height with the given rows full
+static void Model_Build(uint16_t fullRows) {
+	memset(grid, EMPTY_CELL, sizeof(grid));
+	for (uint8_t x = 0; x < GRID_WIDTH; x++) {
+		uint8_t height = 2 + rand() % 9;
+		for (uint8_t y = GRID_HEIGHT - height; y < GRID_HEIGHT; y++) {
+			if (rand() % 5) {
+				grid[y][x] = 1 + rand() % 7;
+			}
+		}
+	}
+	for (uint8_t y = 0; y < GRID_HEIGHT; y++) {
+		uint8_t hole = rand() % GRID_WIDTH;
+		for (uint8_t x = 0; x < GRID_WIDTH; x++) {
+			if (fullRows & (1 << y)) {
+				if (grid[y][x] == EMPTY_CELL) {
+					grid[y][x] = 1 + rand() % 7;
+				}
+			} else if (x == hole) {
+				grid[y][x] = EMPTY_CELL;	// every other row stays incomplete
+			}
+		}
+	}
+}
+
+// Same order of operations as ClearCompleteLines
+static void Model_Clear(uint16_t fullRows) {
+	for (int8_t y = GRID_HEIGHT - 1; y >= 0; y--) {
+		if (!(fullRows & (1 << y))) {
+			continue;
+		}
+		memmove(&grid[1], &grid[0], y * sizeof(grid[0]));
+		memset(&grid[0], EMPTY_CELL, sizeof(grid[0]));
+		fullRows = (uint16_t) (((fullRows & ((1 << y) - 1)) << 1) | (fullRows & ~((2 << y) - 1)));
+		y++;
+	}
+}
+
+static uint16_t Model_PickRows(uint8_t count) {
+	uint16_t rows = 0;
+
+	// mostly next to each other like real clears, sometimes split by a kept row
+	uint8_t bottom = GRID_HEIGHT - 1 - rand() % 6;
+	if (rand() % 3) {
+		for (uint8_t i = 0; i < count; i++) {
+			rows |= 1 << (bottom - i);
+		}
+	} else {
+		while (__builtin_popcount(rows) < count) {
+			rows |= 1 << (bottom - rand() % 7);
+		}
+	}
+	return rows;
+}
+
+static double Bench_Seconds(void) {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+int main(void) {
+	static uint16_t shifted[LCD_PIXELS];
+	static const char *names[] = { "single", "double", "triple", "tetris" };
+	int errors = 0;
+
+	srand(1);
+	Atlas_Init();
+
+	for (uint8_t count = 1; count <= 4; count++) {
+		double shiftTime = 0, repaintTime = 0, start;
+
+		for (int round = 0; round < ROUNDS; round++) {
+			uint16_t rows = Model_PickRows(count);
+
+			// the frame before the clear, with the full rows on screen
+			Model_Build(rows);
+			Model_Spawn();
+			Board_Invalidate();
+			Board_Draw(NULL, RESERVED, true);
+
+			Model_Clear(rows);
+			clearedRows = rows;
+			Model_Spawn();
+
+			start = Bench_Seconds();
+			Board_Draw(NULL, RESERVED, true);
+			shiftTime += Bench_Seconds() - start;
+			memcpy(shifted, frameBuffer, sizeof(shifted));
+
+			start = Bench_Seconds();
+			Board_Invalidate();
+			Board_Draw(NULL, RESERVED, true);
+			repaintTime += Bench_Seconds() - start;
+
+			// the reserved cells are never drawn by either, only compare the board
+			bool same = memcmp(&shifted[ATLAS_TILE_SIZE * LCD_PIXEL_WIDTH],
+					&frameBuffer[ATLAS_TILE_SIZE * LCD_PIXEL_WIDTH],
+					(LCD_PIXELS - ATLAS_TILE_SIZE * LCD_PIXEL_WIDTH) * sizeof(uint16_t)) == 0;
+			for (uint16_t line = 0; line < ATLAS_TILE_SIZE; line++) {
+				for (uint16_t column = 0; column < GRID_WIDTH; column++) {
+					uint32_t at = line * LCD_PIXEL_WIDTH + column * ATLAS_TILE_SIZE;
+					if (!(RESERVED & (1 << column))
+							&& memcmp(&shifted[at], &frameBuffer[at], ATLAS_TILE_SIZE * 2)) {
+						same = false;
+					}
+				}
+			}
+			if (!same && (errors++ < 5)) {
+				printf("%s rows 0x%04X: differs from a full repaint\n", names[count - 1], rows);
+			}
+		}
+
+		printf("%-6s  row shift %6.2f us  full repaint %6.2f us  %.1fx\n",
+				names[count - 1], shiftTime / ROUNDS * 1e6, repaintTime / ROUNDS * 1e6,
+				repaintTime / shiftTime);
+	}
+
+	printf("%s\n", errors ? "FAILED" : "row shift matches full repaint");
+	return errors ? 1 : 0;
+}
@@ -0,0 +1,306 @@
+/*
+ * PcSolverBench.c
+ *
+ *  Created on: Dec 22, 2024
+ *      Author: Will Fraser
+ *
+ * Host tool for PerfectClear.c. Problems are seeded games with a few blocks already
+ * down, each at the lowest of some random placements under PC_MAX_HEIGHT rows, and
+ * the block in play and the preview queue that follow.
+ *
+ * Every first clear the solver returns is played out again here, pieces taken from
+ * the queue and the hold slot the way the engine hands them out and rows cleared as
+ * they fill, and has to leave the board empty. Then every clear of every problem is
+ * counted on one thread, and again with the first placements split over threads; the
+ * counts have to match. Solutions and nodes per second are printed for both.
+ *
+ * Build from the repository root:
+ *   gcc -O2 -pthread -ICore/Inc Tools/PcSolverBench/PcSolverBench.c Core/Src/PerfectClear.c
+ *       Core/Src/Placement.c Core/Src/GameEngine.c Core/Src/PieceBag.c -o pc_solver_bench
+ *
+ * Usage: pc_solver_bench [problems] [threads] [seed]
+ */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "PerfectClear.h"
+
+#define MAX_PROBLEMS 2000
+#define MAX_THREADS  64
+#define TABLE_SIZE   (1 << 16)
+
+typedef struct {
+	pthread_t thread;
+	uint8_t first, stride;
+	uint32_t problemCount;
+	uint64_t nodes;
+	PcSolver solver;
+	uint64_t table[TABLE_SIZE];
+} BenchThread;
+
+static PcProblem problems[MAX_PROBLEMS];
+static uint32_t counted[MAX_PROBLEMS];		// clears per problem on one thread
+static uint32_t split[MAX_PROBLEMS];		// summed over the threads
+static BenchThread workers[MAX_THREADS];
+static PcStep tiling[PC_MAX_HEIGHT * GRID_WIDTH / BLOCK_SIZE];
+
+static double Bench_Now(void) {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+// Rows after a block locks, full ones removed, false when it sticks out of the field
+static bool Bench_Lock(uint16_t *rows, uint8_t blockNum, const Placement *placement,
+		uint8_t height) {
+	uint16_t cells[BLOCK_SIZE];
+
+	Placement_Rows(blockNum, placement, cells);
+	for (uint8_t i = 0; i < BLOCK_SIZE; i++) {
+		if (cells[i] == 0) {
+			continue;
+		}
+		if (placement->y + i < GRID_ROWS - height) {
+			return false;
+		}
+		rows[placement->y + i] |= cells[i];
+	}
+	for (uint8_t y = 0; y < GRID_ROWS; y++) {
+		if (rows[y] == (1u << GRID_WIDTH) - 1) {
+			memmove(&rows[1], &rows[0], y * sizeof(rows[0]));
+			rows[0] = 0;
+		}
+	}
+	return true;
+}
+
+// Cover the lowest, leftmost empty cell of the field and go on, the blocks at random
+static bool Bench_Tile(uint16_t *rows, uint8_t height, uint8_t depth, uint32_t *budget) {
+	int8_t cellY = -1, cellX = 0;
+
+	for (int8_t y = GRID_ROWS - 1; (y >= GRID_ROWS - height) && (cellY < 0); y--) {
+		if (rows[y] != (1u << GRID_WIDTH) - 1) {
+			cellY = y;
+			cellX = __builtin_ctz(~rows[y]);
+		}
+	}
+	if (cellY < 0) {
+		return true;
+	}
+	if (*budget == 0) {
+		return false;
+	}
+	(*budget)--;
+
+	uint8_t firstBlock = rand() % 7, firstRotation = rand() % PLACEMENT_ROTATIONS;
+	for (uint8_t b = 0; b < 7; b++) {
+		uint8_t blockNum = (firstBlock + b) % 7 + 1;
+		for (uint8_t r = 0; r < PLACEMENT_ROTATIONS; r++) {
+			for (int8_t dy = 0; dy < BLOCK_SIZE; dy++) {
+				for (int8_t dx = 0; dx < BLOCK_SIZE; dx++) {
+					Placement at = { (firstRotation + r) % PLACEMENT_ROTATIONS, cellX - dx,
+							cellY - dy };
+					uint16_t cells[BLOCK_SIZE];
+					uint8_t inside = 0;
+
+					Placement_Rows(blockNum, &at, cells);
+					for (uint8_t i = 0; i < BLOCK_SIZE; i++) {
+						if ((cells[i] != 0) && (at.y + i >= GRID_ROWS - height)
+								&& (at.y + i < GRID_ROWS) && !(cells[i] & rows[at.y + i])) {
+							inside += __builtin_popcount(cells[i] & ((1u << GRID_WIDTH) - 1));
+						}
+					}
+					bool fits = (inside == BLOCK_SIZE);
+					if (!fits || !(cells[dy] & (1 << cellX))) {
+						continue;
+					}
+					// the target has to be the block's lowest, leftmost cell
+					bool lowest = (dy == BLOCK_SIZE - 1) || (cells[dy + 1] == 0);
+					if (!lowest || ((cells[dy] & ((1 << cellX) - 1)) != 0)) {
+						continue;
+					}
+
+					uint16_t filled[GRID_ROWS];
+					memcpy(filled, rows, sizeof(filled));
+					for (uint8_t i = 0; i < BLOCK_SIZE; i++) {
+						if (cells[i] != 0) {
+							filled[at.y + i] |= cells[i];
+						}
+					}
+					tiling[depth].blockNum = blockNum;
+					tiling[depth].placement = at;
+					if (Bench_Tile(filled, height, depth + 1, budget)) {
+						return true;
+					}
+				}
+			}
+		}
+	}
+	return false;
+}
+
+/*
+ * A random tiling of the bottom 2 to 4 rows, bottom first. The blocks of it that the
+ * queue cannot hold are put down already and the rest are the queue, so most of the
+ * problems have a clear, though the order or the way in may not allow it.
+ */
+static uint32_t Bench_Problems(uint32_t count, uint32_t seed) {
+	srand(seed);
+	for (uint32_t p = 0; p < count; p++) {
+		PcProblem *problem = &problems[p];
+		uint8_t height = rand() % (PC_MAX_HEIGHT - 1) + 2;
+		uint8_t blocks = height * GRID_WIDTH / BLOCK_SIZE;
+		uint16_t rows[GRID_ROWS] = { 0 };
+		uint32_t budget = 20000;
+
+		if (!Bench_Tile(rows, height, 0, &budget)) {
+			p--;
+			continue;
+		}
+
+		uint8_t queued = rand() % (PREVIEW_COUNT + 1) + 1;
+		queued = (queued > blocks) ? blocks : queued;
+		memset(problem, 0, sizeof(*problem));
+		// the blocks down first and the rows they fill cleared after, the tiling is in field rows
+		for (uint8_t b = 0; b < blocks - queued; b++) {
+			uint16_t cells[BLOCK_SIZE];
+			Placement_Rows(tiling[b].blockNum, &tiling[b].placement, cells);
+			for (uint8_t i = 0; i < BLOCK_SIZE; i++) {
+				if (cells[i] != 0) {
+					problem->rows[tiling[b].placement.y + i] |= cells[i];
+				}
+			}
+		}
+		for (uint8_t y = 0; y < GRID_ROWS; y++) {
+			if (problem->rows[y] == (1u << GRID_WIDTH) - 1) {
+				memmove(&problem->rows[1], &problem->rows[0], y * sizeof(problem->rows[0]));
+				problem->rows[0] = 0;
+			}
+		}
+		for (uint8_t b = blocks - queued; b < blocks; b++) {
+			problem->pieces[problem->pieceCount++] = tiling[b].blockNum;
+		}
+		problem->hold = NO_BLOCK;
+	}
+	return count;
+}
+
+// The clear as the engine would play it: the pieces in queue order through the hold slot
+static bool Bench_Replay(const PcProblem *problem, const PcSolver *solver) {
+	uint16_t rows[GRID_ROWS];
+	uint8_t hold = problem->hold;
+	uint8_t next = 0;
+
+	memcpy(rows, problem->rows, sizeof(rows));
+	for (uint8_t s = 0; s < solver->length; s++) {
+		const PcStep *step = &solver->solution[s];
+		uint8_t blockNum;
+
+		if (!step->hold) {
+			blockNum = problem->pieces[next++];
+		} else if (hold != NO_BLOCK) {
+			blockNum = hold;
+			hold = (next < problem->pieceCount) ? problem->pieces[next++] : NO_BLOCK;
+		} else {
+			hold = problem->pieces[next++];
+			blockNum = problem->pieces[next++];
+		}
+		if ((blockNum != step->blockNum)
+				|| !Bench_Lock(rows, blockNum, &step->placement, solver->height)) {
+			return false;
+		}
+	}
+	for (uint8_t y = 0; y < GRID_ROWS; y++) {
+		if (rows[y] != 0) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static void *Bench_Worker(void *arg) {
+	BenchThread *worker = arg;
+
+	PcSolver_Init(&worker->solver, worker->table, TABLE_SIZE);
+	worker->solver.countAll = true;
+	worker->solver.rootFirst = worker->first;
+	worker->solver.rootStride = worker->stride;
+	worker->nodes = 0;
+	for (uint32_t p = 0; p < worker->problemCount; p++) {
+		PcSolver_Solve(&worker->solver, &problems[p]);
+		worker->nodes += worker->solver.nodes;
+		__atomic_fetch_add(&split[p], worker->solver.solutions, __ATOMIC_RELAXED);
+	}
+	return NULL;
+}
+
+// Every clear of every problem, the first placements dealt out over threads
+static double Bench_CountAll(uint32_t problemCount, uint8_t threads, uint64_t *nodes) {
+	double start = Bench_Now();
+
+	memset(split, 0, sizeof(split));
+	for (uint8_t t = 0; t < threads; t++) {
+		workers[t].first = t;
+		workers[t].stride = threads;
+		workers[t].problemCount = problemCount;
+		pthread_create(&workers[t].thread, NULL, Bench_Worker, &workers[t]);
+	}
+	*nodes = 0;
+	for (uint8_t t = 0; t < threads; t++) {
+		pthread_join(workers[t].thread, NULL);
+		*nodes += workers[t].nodes;
+	}
+	return Bench_Now() - start;
+}
+
+int main(int argc, char **argv) {
+	uint32_t count = (argc > 1) ? atoi(argv[1]) : 400;
+	uint32_t threads = (argc > 2) ? atoi(argv[2]) : sysconf(_SC_NPROCESSORS_ONLN);
+	uint32_t seed = (argc > 3) ? atoi(argv[3]) : 1;
+	uint32_t solved = 0, wrong = 0, differ = 0;
+	uint64_t firstNodes = 0, solutions = 0;
+
+	count = (count > MAX_PROBLEMS) ? MAX_PROBLEMS : count;
+	threads = (threads < 1) ? 1 : (threads > MAX_THREADS) ? MAX_THREADS : threads;
+	Placement_Init();
+	Bench_Problems(count, seed);
+
+	// first clear only, as the board does it
+	PcSolver *solver = &workers[0].solver;
+	PcSolver_Init(solver, workers[0].table, TABLE_SIZE);
+	double start = Bench_Now();
+	for (uint32_t p = 0; p < count; p++) {
+		if (PcSolver_Solve(solver, &problems[p])) {
+			solved++;
+			wrong += !Bench_Replay(&problems[p], solver);
+		}
+		firstNodes += solver->nodes;
+	}
+	double firstTime = Bench_Now() - start;
+	printf("%u problems, %u with a clear, %u replays wrong\n", count, solved, wrong);
+	printf("first clear: %.1f us per problem, %.0f nodes/s\n", firstTime * 1e6 / count,
+			firstNodes / firstTime);
+
+	uint64_t nodes;
+	double single = Bench_CountAll(count, 1, &nodes);
+	memcpy(counted, split, sizeof(counted));
+	for (uint32_t p = 0; p < count; p++) {
+		solutions += counted[p];
+	}
+	printf("all clears, 1 thread: %llu solutions, %.0f solutions/s, %.0f nodes/s\n",
+			(unsigned long long) solutions, solutions / single, nodes / single);
+
+	double parallel = Bench_CountAll(count, threads, &nodes);
+	for (uint32_t p = 0; p < count; p++) {
+		differ += split[p] != counted[p];
+	}
+	printf("all clears, %u threads: %.0f solutions/s, %.0f nodes/s, %u problems differ\n",
+			threads, solutions / parallel, nodes / parallel, differ);
+
+	return (wrong || differ) ? 1 : 0;
+}
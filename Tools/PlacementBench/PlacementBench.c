@@ -0,0 +1,280 @@
+/*
+ * PlacementBench.c
+ *
+ *  Created on: Dec 20, 2024
+ *      Author: Will Fraser
+ *
+ * Host tool for Placement.c. Boards are taken from random games, whose stacks are
+ * full of holes and overhangs, and every block is placed from its spawn on each of
+ * them, along with stacks that reach the spawn rows, where blocks spawn without the
+ * drop or are blocked out. The bit mask generator has to find exactly the placements
+ * of the one position at a time search, and on part of the boards, always on the
+ * spawn ones, both are checked against the engine
+ * itself: a search over GameState copies moved with MoveCurrentBlock and
+ * RotateCurrentBlock, compared by the cells the block rests on. Then both generators
+ * are timed over all boards.
+ *
+ * Build from the repository root:
+ *   gcc -O2 -ICore/Inc Tools/PlacementBench/PlacementBench.c Core/Src/Placement.c
+ *       Core/Src/GameEngine.c Core/Src/PieceBag.c -o placement_bench
+ *
+ * Usage: placement_bench [boards] [seed]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "Placement.h"
+
+#define MAX_BOARDS     20000
+#define ENGINE_EVERY   20			// boards checked against the engine search
+#define SPAWN_BOARDS   3			// stacks up to rows 1, 2 and 3, column 0 left open
+#define MAX_STATES     2048
+#define TIMING_SECONDS 1.0
+
+static uint16_t boards[MAX_BOARDS][GRID_ROWS];
+static GameState state;
+static GameState states[MAX_STATES];	// engine search queue
+static uint64_t seenKeys[MAX_STATES];
+static uint64_t restKeys[MAX_STATES];
+
+static double Bench_Now(void) {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+// Stacks into the spawn rows, then stacks from random play, one board per placed block
+static uint32_t Bench_Boards(uint32_t count, uint32_t seed) {
+	uint32_t boardCount = 0;
+
+	for (; boardCount < SPAWN_BOARDS; boardCount++) {
+		for (uint8_t y = 0; y < GRID_ROWS; y++) {
+			boards[boardCount][y] = (y > boardCount) ? ((1u << GRID_WIDTH) - 2) : 0;
+		}
+	}
+	srand(seed);
+	for (uint32_t g = 0; boardCount < count; g++) {
+		uint32_t time = 0, placed = 0;
+
+		Engine_NewGame(&state, seed + g);
+		while (!Engine_IsOver(&state) && (boardCount < count)) {
+			time += rand() % 400;
+			Engine_Advance(&state, time);
+			Engine_Input(&state, rand() % 7, time);
+			if (Engine_PiecesPlaced(&state) != placed) {
+				placed = Engine_PiecesPlaced(&state);
+				memcpy(boards[boardCount++], state.gridRows, sizeof(state.gridRows));
+			}
+		}
+	}
+	return boardCount;
+}
+
+// Block cells as the four grid row masks from the box row, keyed from the top cell row
+// so rotations with the same cells give the same key
+static uint64_t Bench_CellKey(int8_t boxY, const uint16_t *rows) {
+	uint8_t top = 0;
+
+	while ((top < BLOCK_SIZE - 1) && (rows[top] == 0)) {
+		top++;
+	}
+	uint64_t key = (uint8_t) (boxY + top);
+	for (uint8_t i = top; i < BLOCK_SIZE; i++) {
+		key |= (uint64_t) rows[i] << (8 + 12 * (i - top));
+	}
+	return key;
+}
+
+static void Bench_BlockRows(const GameState *game, uint16_t rows[BLOCK_SIZE]) {
+	for (uint8_t i = 0; i < BLOCK_SIZE; i++) {
+		int8_t y = game->currentBlockY + i;
+		rows[i] = 0;
+		for (uint8_t x = 0; (y < GRID_ROWS) && (x < GRID_WIDTH); x++) {
+			if (game->currentBlock[y][x] != EMPTY_CELL) {
+				rows[i] |= 1 << x;
+			}
+		}
+	}
+}
+
+// Where the block rests
+static uint64_t Bench_RestKey(const GameState *game) {
+	uint16_t rows[BLOCK_SIZE];
+
+	Bench_BlockRows(game, rows);
+	return Bench_CellKey(game->currentBlockY, rows);
+}
+
+// The block and its box, the same cells in another box turn differently
+static uint64_t Bench_StateKey(const GameState *game) {
+	uint16_t rows[BLOCK_SIZE];
+	uint64_t key = (uint64_t) (game->currentBlockX + PLACEMENT_X_BIAS) << 56;
+
+	Bench_BlockRows(game, rows);
+	key |= (uint64_t) game->currentBlockY << 48;
+	for (uint8_t i = 0; i < BLOCK_SIZE; i++) {
+		key |= (uint64_t) rows[i] << (12 * i);
+	}
+	return key;
+}
+
+static bool Bench_Has(const uint64_t *keys, uint32_t count, uint64_t key) {
+	for (uint32_t i = 0; i < count; i++) {
+		if (keys[i] == key) {
+			return true;
+		}
+	}
+	return false;
+}
+
+// Every resting place the engine allows from the spawn, as keys
+static uint32_t Bench_EngineSearch(const uint16_t *rows, uint8_t blockNum) {
+	uint32_t head = 0, tail = 0, seen = 0, rests = 0;
+
+	InitGameGrid(&state);
+	for (uint8_t y = 0; y < GRID_ROWS; y++) {
+		state.gridRows[y] = rows[y];
+		for (uint8_t x = 0; x < GRID_WIDTH; x++) {
+			state.gameGrid[y][x] = (rows[y] & (1 << x)) ? I_BLOCK : EMPTY_CELL;
+		}
+	}
+	state.gameOver = false;
+	GenerateBlock(&state, blockNum);
+	if (state.gameOver) {
+		return 0;
+	}
+
+	states[tail++] = state;
+	seenKeys[seen++] = Bench_StateKey(&state);
+	while (head != tail) {
+		for (uint8_t move = 0; move < 5; move++) {
+			GameState *next = &states[tail];
+			*next = states[head];
+			int8_t x = next->currentBlockX;
+
+			switch (move) {
+			case 0:
+				if (MoveCurrentBlock(next, MOVE_DOWN)) {
+					uint64_t key = Bench_RestKey(next);
+					if (!Bench_Has(restKeys, rests, key)) {
+						restKeys[rests++] = key;
+					}
+					continue;
+				}
+				break;
+			case 1:
+			case 2:
+				MoveCurrentBlock(next, (move == 1) ? MOVE_LEFT : MOVE_RIGHT);
+				if (next->currentBlockX == x) {
+					continue;
+				}
+				break;
+			default:
+				if (RotateCurrentBlock(next, (move == 3) ? ROTATE_LEFT : ROTATE_RIGHT)) {
+					continue;
+				}
+				break;
+			}
+
+			uint64_t key = Bench_StateKey(next);
+			if (!Bench_Has(seenKeys, seen, key)) {
+				seenKeys[seen++] = key;
+				tail++;
+			}
+		}
+		head++;
+	}
+	return rests;
+}
+
+// Placements as the same keys, each has to be one of the engine's and all have to be there
+static int Bench_CheckEngine(const uint16_t *rows, uint8_t blockNum, const PlacementSet *set) {
+	static Placement list[GRID_ROWS * 16 * PLACEMENT_ROTATIONS];
+	uint32_t rests = Bench_EngineSearch(rows, blockNum);
+	uint16_t count = Placement_List(set, list, sizeof(list) / sizeof(list[0]));
+
+	if (count != rests) {
+		return 1;
+	}
+	for (uint16_t i = 0; i < count; i++) {
+		uint16_t cells[BLOCK_SIZE];
+
+		Placement_Rows(blockNum, &list[i], cells);
+		if (!Bench_Has(restKeys, rests, Bench_CellKey(list[i].y, cells))) {
+			return 1;
+		}
+	}
+	return 0;
+}
+
+// Generations per second over all boards and blocks, and placements found per second
+static double Bench_Time(uint16_t (*generate)(const uint16_t*, uint8_t, const Placement*,
+		PlacementSet*), uint32_t boardCount, double *placementsPerSecond) {
+	PlacementSet set;
+	uint64_t runs = 0, found = 0;
+	double start = Bench_Now(), elapsed;
+
+	do {
+		for (uint32_t b = 0; b < boardCount; b++) {
+			for (uint8_t block = I_BLOCK; block <= L_BLOCK; block++) {
+				Placement spawn = { 0, SPAWN_X, 1 };
+				found += generate(boards[b], block, &spawn, &set);
+				runs++;
+			}
+		}
+		elapsed = Bench_Now() - start;
+	} while (elapsed < TIMING_SECONDS);
+
+	*placementsPerSecond = found / elapsed;
+	return runs / elapsed;
+}
+
+int main(int argc, char **argv) {
+	uint32_t count = (argc > 1) ? atoi(argv[1]) : 5000;
+	uint32_t seed = (argc > 2) ? atoi(argv[2]) : 1;
+	uint32_t differ = 0, engineDiffer = 0, engineChecked = 0;
+	uint64_t placements = 0;
+
+	count = (count > MAX_BOARDS) ? MAX_BOARDS : count;
+	Placement_Init();
+	uint32_t boardCount = Bench_Boards(count, seed);
+
+	for (uint32_t b = 0; b < boardCount; b++) {
+		for (uint8_t block = I_BLOCK; block <= L_BLOCK; block++) {
+			PlacementSet fast, naive;
+
+			Placement_FromSpawn(boards[b], block, &fast);
+			Placement start = { 0, SPAWN_X, 0 };
+			if (Placement_GenerateNaive(boards[b], block, &start, &naive)) {
+				PlacementSet dropped;
+				start.y = 1;
+				if (Placement_GenerateNaive(boards[b], block, &start, &dropped)) {
+					naive = dropped;
+				}
+			}
+			differ += memcmp(&fast, &naive, sizeof(fast)) != 0;
+			placements += fast.count;
+
+			if ((b < SPAWN_BOARDS) || (b % ENGINE_EVERY == 0)) {
+				engineDiffer += Bench_CheckEngine(boards[b], block, &fast);
+				engineChecked++;
+			}
+		}
+	}
+	printf("%u boards, %.1f placements per block, %u differ from the naive search\n",
+			boardCount, (double) placements / (boardCount * 7), differ);
+	printf("%u checked against the engine, %u differ\n", engineChecked, engineDiffer);
+
+	double fastPlacements, naivePlacements;
+	double fastRuns = Bench_Time(Placement_Generate, boardCount, &fastPlacements);
+	double naiveRuns = Bench_Time(Placement_GenerateNaive, boardCount, &naivePlacements);
+	printf("%-10s %12s %14s %10s\n", "search", "blocks/s", "placements/s", "us/block");
+	printf("%-10s %12.0f %14.0f %10.2f\n", "bit mask", fastRuns, fastPlacements, 1e6 / fastRuns);
+	printf("%-10s %12.0f %14.0f %10.2f\n", "naive", naiveRuns, naivePlacements, 1e6 / naiveRuns);
+	printf("speedup %.1fx\n", fastRuns / naiveRuns);
+
+	return (differ || engineDiffer) ? 1 : 0;
+}
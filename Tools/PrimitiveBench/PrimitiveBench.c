@@ -0,0 +1,277 @@
+/*
+ * PrimitiveBench.c
+ *
+ *  Created on: Dec 16, 2024
+ *      Author: Will Fraser
+ *
+ * Host tool for the circle and line primitives in LCD_Graphics.c. Random circles
+ * and lines, many of them partly or fully off screen, are drawn with the span and
+ * Bresenham code and with per pixel references: the old bounding square test for
+ * circles, the old pixel loops for straight lines and the Bresenham formula worked
+ * out per step for any line. Both have to give exactly the same pixels. Then the
+ * old code and the new code are timed on shapes that fit on screen.
+ *
+ * Build from the repository root:
+ *   gcc -O2 -ICore/Inc Tools/PrimitiveBench/PrimitiveBench.c Core/Src/LCD_Graphics.c
+ *       Core/Src/GlyphMasks.c Core/Src/fonts.c -o primitive_bench
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "LCD_Graphics.h"
+
+#define CHECKS   20000		// random shapes of each kind
+#define ROUNDS   2000		// timing repeats
+
+static uint16_t referenceBuffer[LCD_PIXELS];
+
+static double Bench_Seconds(void) {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+static int32_t Bench_Random(int32_t low, int32_t high) {
+	return low + rand() % (high - low + 1);
+}
+
+// Only pixels on screen, the old code wrote anywhere
+static void Reference_Pixel(int32_t x, int32_t y, uint16_t color) {
+	if ((x >= 0) && (x < LCD_PIXEL_WIDTH) && (y >= 0) && (y < LCD_PIXEL_HEIGHT)) {
+		referenceBuffer[y * LCD_PIXEL_WIDTH + x] = color;
+	}
+}
+
+// The old LCD_Draw_Circle_Fill, clipped
+static void Reference_Circle(int32_t Xpos, int32_t Ypos, int32_t radius, uint16_t color) {
+	for (int32_t y = -radius; y <= radius; y++) {
+		for (int32_t x = -radius; x <= radius; x++) {
+			if (x * x + y * y <= radius * radius) {
+				Reference_Pixel(x + Xpos, y + Ypos, color);
+			}
+		}
+	}
+}
+
+// Every step of the line from the formula in LCD_Draw_Line, no running error
+static void Reference_Line(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint16_t color) {
+	int64_t dx = llabs((int64_t) x1 - x0), dy = llabs((int64_t) y1 - y0);
+	int32_t sx = (x1 >= x0) ? 1 : -1, sy = (y1 >= y0) ? 1 : -1;
+	int64_t major = (dx >= dy) ? dx : dy, minor = (dx >= dy) ? dy : dx;
+
+	for (int64_t i = 0; i <= major; i++) {
+		int64_t offset = (major == 0) ? 0 : (2 * i * minor + major) / (2 * major);
+		if (dx >= dy) {
+			Reference_Pixel(x0 + sx * i, y0 + sy * offset, color);
+		} else {
+			Reference_Pixel(x0 + sx * offset, y0 + sy * i, color);
+		}
+	}
+}
+
+// The old pixel loops for straight lines, for timing
+static void Old_Vertical(uint16_t x, uint16_t y, uint16_t len, uint16_t color) {
+	for (uint16_t i = 0; i < len; i++) {
+		LCD_Draw_Pixel(x, i + y, color);
+	}
+}
+
+static void Old_Horizontal(uint16_t x, uint16_t y, uint16_t len, uint16_t color) {
+	for (uint16_t i = 0; i < len; i++) {
+		LCD_Draw_Pixel(x + i, y, color);
+	}
+}
+
+static void Old_Circle(uint16_t Xpos, uint16_t Ypos, uint16_t radius, uint16_t color) {
+	for (int16_t y = -radius; y <= radius; y++) {
+		for (int16_t x = -radius; x <= radius; x++) {
+			if (x * x + y * y <= radius * radius) {
+				LCD_Draw_Pixel(x + Xpos, y + Ypos, color);
+			}
+		}
+	}
+}
+
+// Per pixel Bresenham through LCD_Draw_Pixel, what a line would have cost before
+static void Old_Line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+	int32_t dx = abs(x1 - x0), dy = -abs(y1 - y0);
+	int32_t sx = (x0 < x1) ? 1 : -1, sy = (y0 < y1) ? 1 : -1;
+	int32_t error = dx + dy;
+
+	for (;;) {
+		LCD_Draw_Pixel(x0, y0, color);
+		if ((x0 == x1) && (y0 == y1)) {
+			break;
+		}
+		int32_t e2 = 2 * error;
+		if (e2 >= dy) {
+			error += dy;
+			x0 += sx;
+		}
+		if (e2 <= dx) {
+			error += dx;
+			y0 += sy;
+		}
+	}
+}
+
+static int Bench_Compare(const char *what, int32_t a, int32_t b, int32_t c, int32_t d) {
+	if (memcmp(frameBuffer, referenceBuffer, sizeof(referenceBuffer)) == 0) {
+		return 0;
+	}
+	printf("%s %d %d %d %d differs\n", what, a, b, c, d);
+	return 1;
+}
+
+static void Bench_Clear(void) {
+	memset(frameBuffer, 0, sizeof(referenceBuffer));
+	memset(referenceBuffer, 0, sizeof(referenceBuffer));
+}
+
+static int Bench_CheckCircles(void) {
+	int errors = 0;
+
+	for (uint32_t i = 0; i < CHECKS; i++) {
+		int32_t x = Bench_Random(-200, 440), y = Bench_Random(-200, 520);
+		int32_t radius = (i % 4 == 0) ? Bench_Random(0, 4) : Bench_Random(0, 250);
+
+		Bench_Clear();
+		LCD_Draw_Circle_Fill(x, y, radius, 0xFFFF);
+		Reference_Circle(x, y, radius, 0xFFFF);
+		errors += Bench_Compare("circle", x, y, radius, 0);
+	}
+	return errors;
+}
+
+static int Bench_CheckLines(void) {
+	int errors = 0;
+
+	for (uint32_t i = 0; i < CHECKS; i++) {
+		int32_t range = (i % 8 == 0) ? 32000 : 600;
+		int32_t x0 = Bench_Random(-range, range), y0 = Bench_Random(-range, range);
+		int32_t x1 = Bench_Random(-range, range), y1 = Bench_Random(-range, range);
+		if (i % 5 == 0) {
+			x1 = x0 + Bench_Random(-3, 3);	// steep and short ones
+		}
+		if (range > 600) {
+			Bench_Clear();
+			LCD_Draw_Line(x0, y0, x1, y1, 0xFFFF);
+			Reference_Line(x0, y0, x1, y1, 0xFFFF);
+			errors += Bench_Compare("line", x0, y0, x1, y1);
+			continue;
+		}
+
+		Bench_Clear();
+		LCD_Draw_Line(x0, y0, x1, y1, 0xFFFF);
+		Reference_Line(x0, y0, x1, y1, 0xFFFF);
+		errors += Bench_Compare("line", x0, y0, x1, y1);
+
+		// straight lines against the old loops, clipped
+		int32_t len = Bench_Random(0, 400);
+		Bench_Clear();
+		LCD_Draw_Horizontal_Line(x0 / 2, y0 / 2, len, 0xFFFF);
+		for (int32_t p = 0; p < len; p++) {
+			Reference_Pixel(x0 / 2 + p, y0 / 2, 0xFFFF);
+		}
+		errors += Bench_Compare("horizontal", x0 / 2, y0 / 2, len, 0);
+
+		Bench_Clear();
+		LCD_Draw_Vertical_Line(x0 / 2, y0 / 2, len, 0xFFFF);
+		for (int32_t p = 0; p < len; p++) {
+			Reference_Pixel(x0 / 2, y0 / 2 + p, 0xFFFF);
+		}
+		errors += Bench_Compare("vertical", x0 / 2, y0 / 2, len, 0);
+	}
+	return errors;
+}
+
+static void Bench_Circles(void) {
+	static const uint16_t radii[] = { 5, 20, 60, 119 };
+
+	for (uint8_t r = 0; r < sizeof(radii) / sizeof(radii[0]); r++) {
+		double start = Bench_Seconds();
+		for (uint32_t round = 0; round < ROUNDS; round++) {
+			Old_Circle(120, 160, radii[r], round);
+		}
+		double old = Bench_Seconds() - start;
+
+		start = Bench_Seconds();
+		for (uint32_t round = 0; round < ROUNDS; round++) {
+			LCD_Draw_Circle_Fill(120, 160, radii[r], round);
+		}
+		double spans = Bench_Seconds() - start;
+
+		printf("circle r=%-3u  bounding square %8.2f us  spans %7.2f us  %5.1fx\n",
+				radii[r], old * 1e6 / ROUNDS, spans * 1e6 / ROUNDS, old / spans);
+	}
+}
+
+static void Bench_Lines(void) {
+	double start = Bench_Seconds();
+	for (uint32_t round = 0; round < ROUNDS; round++) {
+		for (uint16_t y = 0; y < LCD_PIXEL_HEIGHT; y += 4) {
+			Old_Horizontal(round & 7, y, LCD_PIXEL_WIDTH - 8, round);
+		}
+	}
+	double old = Bench_Seconds() - start;
+	start = Bench_Seconds();
+	for (uint32_t round = 0; round < ROUNDS; round++) {
+		for (uint16_t y = 0; y < LCD_PIXEL_HEIGHT; y += 4) {
+			LCD_Draw_Horizontal_Line(round & 7, y, LCD_PIXEL_WIDTH - 8, round);
+		}
+	}
+	double runs = Bench_Seconds() - start;
+	printf("80 horizontal  per pixel       %8.2f us  runs  %7.2f us  %5.1fx\n",
+			old * 1e6 / ROUNDS, runs * 1e6 / ROUNDS, old / runs);
+
+	start = Bench_Seconds();
+	for (uint32_t round = 0; round < ROUNDS; round++) {
+		for (uint16_t x = 0; x < LCD_PIXEL_WIDTH; x += 4) {
+			Old_Vertical(x, round & 7, LCD_PIXEL_HEIGHT - 8, round);
+		}
+	}
+	old = Bench_Seconds() - start;
+	start = Bench_Seconds();
+	for (uint32_t round = 0; round < ROUNDS; round++) {
+		for (uint16_t x = 0; x < LCD_PIXEL_WIDTH; x += 4) {
+			LCD_Draw_Vertical_Line(x, round & 7, LCD_PIXEL_HEIGHT - 8, round);
+		}
+	}
+	runs = Bench_Seconds() - start;
+	printf("60 vertical    per pixel       %8.2f us  runs  %7.2f us  %5.1fx\n",
+			old * 1e6 / ROUNDS, runs * 1e6 / ROUNDS, old / runs);
+
+	// a fan of diagonals from the middle to every fourth pixel of the border
+	start = Bench_Seconds();
+	for (uint32_t round = 0; round < ROUNDS; round++) {
+		for (uint16_t x = 0; x < LCD_PIXEL_WIDTH; x += 4) {
+			Old_Line(120, 160, x, 0, round);
+			Old_Line(120, 160, x, LCD_PIXEL_HEIGHT - 1, round);
+		}
+	}
+	old = Bench_Seconds() - start;
+	start = Bench_Seconds();
+	for (uint32_t round = 0; round < ROUNDS; round++) {
+		for (uint16_t x = 0; x < LCD_PIXEL_WIDTH; x += 4) {
+			LCD_Draw_Line(120, 160, x, 0, round);
+			LCD_Draw_Line(120, 160, x, LCD_PIXEL_HEIGHT - 1, round);
+		}
+	}
+	runs = Bench_Seconds() - start;
+	printf("120 diagonals  per pixel       %8.2f us  Bresenham %.2f us  %5.1fx\n",
+			old * 1e6 / ROUNDS, runs * 1e6 / ROUNDS, old / runs);
+}
+
+int main(void) {
+	srand(1);
+
+	int errors = Bench_CheckCircles() + Bench_CheckLines();
+	printf("%d circles and %d lines checked, %d differ\n\n", CHECKS, CHECKS, errors);
+
+	Bench_Circles();
+	Bench_Lines();
+	return (errors == 0) ? 0 : 1;
+}
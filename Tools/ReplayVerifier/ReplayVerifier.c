@@ -0,0 +1,359 @@
+/*
+ * ReplayVerifier.c
+ *
+ *  Created on: Dec 9, 2024
+ *      Author: Will Fraser
+ *
+ * Host tool, replays every .trp file in a directory through the game engine
+ * and checks the final board hash, score and end time against the recording.
+ * Run it after any engine change, a single changed outcome fails the run.
+ *
+ * With -c 1 every game is also played a second time through snapshots: after each
+ * input the game is saved and restored into another GameState, which plays on. The
+ * restored game has to save to the same bytes and have the same Zobrist hashes,
+ * worked out from scratch where the original kept them up to date, and the game has
+ * to end as recorded.
+ *
+ * Build from the repository root:
+ *   gcc -O2 -pthread -ICore/Inc Tools/ReplayVerifier/ReplayVerifier.c
+ *       Core/Src/GameEngine.c Core/Src/Replay.c Core/Src/PieceBag.c Core/Src/Snapshot.c
+ *       -o replay_verifier
+ *
+ * Usage:
+ *   replay_verifier <dir> [-j workers] [-c 1] verify all replays in dir
+ *   replay_verifier <dir> -g count [-s seed]  record count random games into dir
+ *
+ * Each worker thread plays its games in its own GameState, the engine shares nothing
+ * between games. The clock is virtual, a game runs as fast as the CPU allows.
+ */
+
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include "Replay.h"
+#include "Snapshot.h"
+
+#define MAX_PATH        1024
+#define MAX_REPLAY_SIZE (1 << 20)
+
+// One line per game, filled in by the worker that played it
+typedef struct {
+	int passed;
+	int snapshotFailed;
+	char name[256];
+	ReplayResult expected;
+	ReplayResult actual;
+} VerifyReport;
+
+// What a worker thread plays, every workers-th replay starting at first
+typedef struct {
+	const char *dir;
+	char **names;
+	VerifyReport *reports;
+	int count;
+	int first;
+	int workers;
+	int snapshots;			// also play every game through snapshots
+	uint64_t saves;
+} VerifyWorker;
+
+static double NowSeconds(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static long ReadFile(const char *path, uint8_t *buffer, long size) {
+	FILE *file = fopen(path, "rb");
+	if (file == NULL) {
+		return -1;
+	}
+	long length = (long) fread(buffer, 1, size, file);
+	fclose(file);
+	return length;
+}
+
+// Collect the names of all .trp files in dir
+static int ListReplays(const char *dir, char ***names) {
+	DIR *handle = opendir(dir);
+	int count = 0, capacity = 64;
+
+	if (handle == NULL) {
+		return -1;
+	}
+
+	*names = malloc(capacity * sizeof(char*));
+	struct dirent *entry;
+	while ((entry = readdir(handle)) != NULL) {
+		size_t length = strlen(entry->d_name);
+		if ((length < 5) || (strcmp(entry->d_name + length - 4, ".trp") != 0)) {
+			continue;
+		}
+		if (count == capacity) {
+			capacity *= 2;
+			*names = realloc(*names, capacity * sizeof(char*));
+		}
+		(*names)[count++] = strdup(entry->d_name);
+	}
+	closedir(handle);
+	return count;
+}
+
+// The replay again, moved to a restored copy of the game after every input
+static bool CheckSnapshots(GameState games[2], const uint8_t *data, uint32_t length,
+		uint64_t *saves) {
+	ReplayPlayer player;
+	ReplayResult expected;
+	Snapshot saved, again;
+	uint8_t input, live = 0;
+	uint32_t time;
+
+	if (!Replay_OpenPlayer(&player, data, length)) {
+		return false;
+	}
+	Engine_NewGame(&games[0], player.seed);
+	while (Replay_NextEvent(&player, &input, &time)) {
+		GameState *from = &games[live], *to = &games[live ^ 1];
+
+		Engine_Input(from, input, time);
+		if (!Snapshot_Save(from, &saved)) {
+			return false;
+		}
+		Snapshot_Restore(to, &saved);
+		(*saves)++;
+		if (!Snapshot_Save(to, &again) || !Snapshot_Equal(&saved, &again)
+				|| (Engine_Zobrist(to) != Engine_Zobrist(from))
+				|| (Engine_PositionHash(to) != Engine_PositionHash(from))
+				|| (to->piecesPlaced != from->piecesPlaced)
+				|| (memcmp(&to->features, &from->features, sizeof(to->features)) != 0)) {
+			return false;
+		}
+		live ^= 1;
+	}
+	if (!Replay_ReadResult(&player, &expected)) {
+		return false;
+	}
+	Engine_Advance(&games[live], expected.endTime);
+	return Engine_IsOver(&games[live]) && (Engine_Elapsed(&games[live]) == expected.endTime)
+			&& (Engine_BoardHash(&games[live]) == expected.boardHash);
+}
+
+// Verify the worker's share of the replays, each game in the worker's own GameState
+static void* RunWorker(void *argument) {
+	VerifyWorker *worker = argument;
+	uint8_t *buffer = malloc(MAX_REPLAY_SIZE);
+	GameState *game = malloc(2 * sizeof(GameState));
+	char path[MAX_PATH];
+
+	for (int i = worker->first; (buffer != NULL) && (game != NULL) && (i < worker->count);
+			i += worker->workers) {
+		VerifyReport *report = &worker->reports[i];
+
+		snprintf(path, sizeof(path), "%s/%s", worker->dir, worker->names[i]);
+		snprintf(report->name, sizeof(report->name), "%s", worker->names[i]);
+
+		long length = ReadFile(path, buffer, MAX_REPLAY_SIZE);
+		if (length > 0) {
+			report->passed = Replay_Run(game, buffer, (uint32_t) length,
+					&report->expected, &report->actual);
+			if (report->passed && worker->snapshots
+					&& !CheckSnapshots(game, buffer, (uint32_t) length, &worker->saves)) {
+				report->passed = 0;
+				report->snapshotFailed = 1;
+			}
+		}
+	}
+	free(game);
+	free(buffer);
+	return NULL;
+}
+
+static int Verify(const char *dir, int workers, int snapshots) {
+	char **names;
+	int count = ListReplays(dir, &names);
+
+	if (count < 0) {
+		fprintf(stderr, "cannot open %s\n", dir);
+		return 2;
+	}
+	if (count == 0) {
+		fprintf(stderr, "no .trp replays in %s\n", dir);
+		return 2;
+	}
+	if (workers > count) {
+		workers = count;
+	}
+
+	VerifyReport *reports = calloc(count, sizeof(VerifyReport));
+	VerifyWorker *shares = calloc(workers, sizeof(VerifyWorker));
+	pthread_t *threads = calloc(workers, sizeof(pthread_t));
+	if ((reports == NULL) || (shares == NULL) || (threads == NULL)) {
+		fprintf(stderr, "out of memory\n");
+		return 2;
+	}
+
+	double start = NowSeconds();
+
+	for (int w = 0; w < workers; w++) {
+		VerifyWorker share = { dir, names, reports, count, w, workers, snapshots, 0 };
+		shares[w] = share;
+		if (pthread_create(&threads[w], NULL, RunWorker, &shares[w]) != 0) {
+			perror("pthread_create");
+			return 2;
+		}
+	}
+	for (int w = 0; w < workers; w++) {
+		pthread_join(threads[w], NULL);
+	}
+
+	double seconds = NowSeconds() - start;
+	int passed = 0, failed = 0;
+	uint64_t gameMs = 0;
+
+	for (int i = 0; i < count; i++) {
+		const VerifyReport *report = &reports[i];
+		if (report->passed) {
+			passed++;
+			gameMs += report->expected.endTime;
+			continue;
+		}
+		failed++;
+		if (report->snapshotFailed) {
+			printf("SNAPSHOT MISMATCH %s\n", report->name);
+			continue;
+		}
+		printf("MISMATCH %s: hash %08x/%08x time %u/%u score %u,%u,%u,%u / %u,%u,%u,%u\n",
+				report->name, report->expected.boardHash, report->actual.boardHash,
+				report->expected.endTime, report->actual.endTime,
+				report->expected.score[0], report->expected.score[1],
+				report->expected.score[2], report->expected.score[3],
+				report->actual.score[0], report->actual.score[1],
+				report->actual.score[2], report->actual.score[3]);
+	}
+
+	printf("%d games, %d passed, %d failed, %d workers\n", passed + failed,
+			passed, failed, workers);
+	printf("%.3f s, %.0f games/s, %.0fx real time\n", seconds,
+			(passed + failed) / seconds, gameMs / 1000.0 / seconds);
+	if (snapshots) {
+		uint64_t saves = 0;
+		for (int w = 0; w < workers; w++) {
+			saves += shares[w].saves;
+		}
+		printf("%llu snapshots of %d bytes restored, a GameState is %d bytes\n",
+				(unsigned long long) saves, SNAPSHOT_SIZE, (int) sizeof(GameState));
+	}
+
+	free(threads);
+	free(shares);
+	free(reports);
+	return (failed == 0) ? 0 : 1;
+}
+
+static uint8_t recordOut[MAX_REPLAY_SIZE];
+static uint32_t recordLength;
+static int recordTooLong;			// the replay would not fit in MAX_REPLAY_SIZE
+
+static void CollectReplay(const uint8_t *data, uint32_t length) {
+	if (recordLength + length > MAX_REPLAY_SIZE) {
+		recordTooLong = 1;
+		return;
+	}
+	memcpy(&recordOut[recordLength], data, length);
+	recordLength += length;
+}
+
+/*
+ * Record count games of random inputs, the same way the firmware records a game,
+ * flushed as it grows. A game the recorder or the verifier cannot hold is not
+ * written, those are counted and fail the run.
+ */
+static int Generate(const char *dir, int count, unsigned seed) {
+	static GameState game;
+	char path[MAX_PATH];
+	int skipped = 0;
+
+	srand(seed);
+	for (int g = 0; g < count; g++) {
+		uint32_t gameSeed = (uint32_t) rand() * 2654435761u + g;
+		uint32_t time = 0;
+
+		Engine_NewGame(&game, gameSeed);
+		Replay_StartRecording(gameSeed);
+		recordLength = 0;
+		recordTooLong = 0;
+
+		while (!Engine_IsOver(&game)) {
+			time += rand() % 600;
+			Engine_Advance(&game, time);
+			if (Engine_IsOver(&game)) {
+				break;
+			}
+			uint8_t input = rand() % 7;
+			Replay_RecordInput(input, time);
+			Engine_Input(&game, input, time);
+			if (Replay_Buffered() >= REPLAY_FLUSH_LEVEL) {
+				Replay_Flush(CollectReplay);
+			}
+		}
+		Replay_StopRecording(&game);
+		Replay_Flush(CollectReplay);
+
+		if (Replay_Overflowed() || recordTooLong) {
+			printf("SKIPPED replay_%08x.trp, %s\n", gameSeed,
+					recordTooLong ? "longer than MAX_REPLAY_SIZE" : "recorder overflowed");
+			skipped++;
+			continue;
+		}
+
+		snprintf(path, sizeof(path), "%s/replay_%08x.trp", dir, gameSeed);
+		FILE *file = fopen(path, "wb");
+		if (file == NULL) {
+			perror(path);
+			return 2;
+		}
+		fwrite(recordOut, 1, recordLength, file);
+		fclose(file);
+	}
+
+	printf("recorded %d games in %s, %d skipped\n", count - skipped, dir, skipped);
+	return (skipped == 0) ? 0 : 1;
+}
+
+int main(int argc, char **argv) {
+	int workers = (int) sysconf(_SC_NPROCESSORS_ONLN);
+	int generate = 0;
+	int snapshots = 0;
+	unsigned seed = 1;
+
+	if (argc < 2) {
+		fprintf(stderr, "usage: %s <dir> [-j workers] [-c 1] [-g count [-s seed]]\n",
+				argv[0]);
+		return 2;
+	}
+
+	for (int i = 2; i + 1 < argc; i += 2) {
+		if (strcmp(argv[i], "-j") == 0) {
+			workers = atoi(argv[i + 1]);
+		} else if (strcmp(argv[i], "-g") == 0) {
+			generate = atoi(argv[i + 1]);
+		} else if (strcmp(argv[i], "-c") == 0) {
+			snapshots = atoi(argv[i + 1]);
+		} else if (strcmp(argv[i], "-s") == 0) {
+			seed = (unsigned) strtoul(argv[i + 1], NULL, 0);
+		}
+	}
+	if (workers < 1) {
+		workers = 1;
+	}
+
+	if (generate > 0) {
+		return Generate(argv[1], generate, seed);
+	}
+	return Verify(argv[1], workers, snapshots);
+}
@@ -0,0 +1,300 @@
+/*
+ * ScanModel.c
+ *
+ *  Created on: Dec 15, 2024
+ *      Author: Will Fraser
+ *
+ * Host timing model of the LTDC scanning out frameBuffer while BoardView draws into
+ * it, for checking ScanSync. Time is kept in scan lines. It only moves when ScanSync
+ * asks for the clock or waits: the bytes of the band announced before are written
+ * in between, taking their size divided by the write speed (-b bytes per line, with
+ * +-25% jitter). The rows of frameBuffer that changed since the last call are the
+ * rows written, and a write tears when the beam is on one of them meanwhile. This is
+ * checked here independently of the late band count ScanSync keeps itself. Writes
+ * announced with Scan_BandPart, the rows line clears move down, are counted apart.
+ *
+ * Games are played through the real engine with a random pause between updates, so
+ * every update starts at a different beam position. Every 40th update is a full
+ * repaint. Half the games get random inputs, which hardly ever complete a row. The
+ * other half are played by the bot with the touches of Finesse_Path, except that each
+ * I block finds a new stack of 8 to 15 rows under it and is dropped down a shaft to
+ * the bottom. Only the bottom row is full but for the shaft, the rows above also have
+ * a covered hole, so the rest of the stack, up to 14 cell rows, moves down one row.
+ * Games run with chasing off and then on, and the tears, waits and render time per
+ * update are printed for both, with the lines cleared and the tears in moved rows.
+ *
+ * Build from the repository root:
+ *   gcc -O2 -ICore/Inc Tools/ScanModel/ScanModel.c Core/Src/ScanSync.c
+ *       Core/Src/BoardView.c Core/Src/TileAtlas.c Core/Src/LCD_Graphics.c
+ *       Core/Src/GlyphMasks.c Core/Src/fonts.c Core/Src/GameEngine.c
+ *       Core/Src/PieceBag.c Core/Src/Bot.c Core/Src/BoardEval.c Core/Src/Placement.c
+ *       Core/Src/Finesse.c Core/Src/FinesseTables.c -o scan_model
+ *
+ *   scan_model [-n games] [-s seed] [-b bytes per line]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "BoardView.h"
+#include "Bot.h"
+#include "Finesse.h"
+
+#define MAX_STEPS       4000	// inputs per game before it is cut short
+#define REPAINT_EVERY   40		// updates between full repaints
+#define STACK_MIN       8		// rows of the stacks I blocks are dropped into
+#define STACK_MAX       15
+#define NO_INPUT        0xFF
+
+typedef struct {
+	uint32_t tornWrites;		// bands the beam went over while they were written
+	uint32_t tornRows;
+	double drawLines;			// modelled drawing time
+	double maxUpdateLines;		// longest update, waits left out
+	uint32_t shiftWrites;		// Scan_BandPart parts written
+	uint32_t tornShiftWrites;
+	uint32_t tornShiftRows;
+	uint32_t lines;				// cleared in all games
+} ModelStats;
+
+static GameState state;
+static double now;				// scan lines since the start
+static double bytesPerLine = 4000;
+static uint16_t shown[LCD_PIXELS];	// frameBuffer as of the last accounting
+static uint32_t accountedBytes;		// band bytes already given their time
+static uint32_t accountedPartBytes;
+static uint8_t botInputs[FINESSE_MAX_PRESSES + 2];	// the touches to the bot's drop
+static uint8_t botInputCount, botInputNext;
+static uint32_t botPlaced;			// blocks placed when the bot last chose
+static uint32_t jitter;				// own generator, rand() plays the games
+static ModelStats model;
+
+static double Model_Random(void) {
+	jitter ^= jitter << 13;
+	jitter ^= jitter >> 17;
+	jitter ^= jitter << 5;
+	return jitter / 4294967296.0;
+}
+
+// Whether the beam is on framebuffer row at some time in [from, to]
+static bool Model_Scanned(uint16_t row, double from, double to) {
+	uint32_t line = row + SCAN_FIRST_LINE;
+
+	for (uint32_t clock = (uint32_t) from; clock <= (uint32_t) to; clock++) {
+		if (clock % SCAN_TOTAL_LINES == line) {
+			return true;
+		}
+	}
+	return false;
+}
+
+// The rows drawn since the last call take their time now, check them against the beam
+static void Model_Account(void) {
+	uint32_t bytes = Scan_GetStats()->bytes - accountedBytes;
+	bool shift = Scan_GetStats()->partBytes != accountedPartBytes;
+
+	accountedBytes += bytes;
+	accountedPartBytes = Scan_GetStats()->partBytes;
+	if (bytes == 0) {
+		return;
+	}
+	model.shiftWrites += shift;
+
+	double start = now;
+	now += bytes / bytesPerLine * (0.75 + 0.5 * Model_Random());
+	model.drawLines += now - start;
+
+	uint32_t torn = 0;
+	for (uint16_t row = 0; row < LCD_PIXEL_HEIGHT; row++) {
+		uint16_t *line = &frameBuffer[row * LCD_PIXEL_WIDTH];
+		uint16_t *copy = &shown[row * LCD_PIXEL_WIDTH];
+		if (memcmp(line, copy, LCD_PIXEL_WIDTH * sizeof(uint16_t)) != 0) {
+			torn += Model_Scanned(row, start, now);
+			memcpy(copy, line, LCD_PIXEL_WIDTH * sizeof(uint16_t));
+		}
+	}
+	if (torn != 0) {
+		model.tornWrites++;
+		model.tornRows += torn;
+		model.tornShiftWrites += shift;
+		model.tornShiftRows += shift ? torn : 0;
+	}
+}
+
+static uint32_t Model_Clock(void) {
+	Model_Account();
+	return (uint32_t) now;
+}
+
+static void Model_Wait(uint32_t clock) {
+	Model_Account();
+	if (now < clock) {
+		now = clock;
+	}
+}
+
+/*
+ * A new board of random colours from the bottom up with a shaft down the returned
+ * column. The rows over the bottom one have a second hole, covered by the top row.
+ */
+static uint8_t Model_Stack(void) {
+	uint8_t height = STACK_MIN + rand() % (STACK_MAX - STACK_MIN + 1);
+	uint8_t open = rand() % GRID_WIDTH;
+	uint8_t covered = (open + 1 + rand() % (GRID_WIDTH - 1)) % GRID_WIDTH;
+
+	memset(state.gameGrid, EMPTY_CELL, sizeof(state.gameGrid));
+	for (uint8_t y = GRID_ROWS - height; y < GRID_ROWS; y++) {
+		for (uint8_t x = 0; x < GRID_WIDTH; x++) {
+			bool hole = (x == open) || ((x == covered) && (y != GRID_ROWS - height)
+					&& (y != GRID_ROWS - 1));
+			state.gameGrid[y][x] = hole ? EMPTY_CELL : I_BLOCK + rand() % 7;
+		}
+	}
+	Engine_Rebuild(&state);
+	state.changes |= ENGINE_CHANGED_GRID;
+	return open;
+}
+
+// The I block along the top, then turned upright over the shaft
+static void Model_ShaftInputs(uint8_t open) {
+	Placement upright = { 1, 0, 0 };
+	uint16_t rows[BLOCK_SIZE];
+
+	for (upright.x = -PLACEMENT_X_BIAS; upright.x < GRID_WIDTH; upright.x++) {
+		Placement_Rows(I_BLOCK, &upright, rows);
+		if (rows[0] == (1u << open)) {
+			break;
+		}
+	}
+	for (int8_t x = state.currentBlockX; x != upright.x; x += (x < upright.x) ? 1 : -1) {
+		botInputs[botInputCount++] = (x < upright.x) ? INPUT_MOVE_RIGHT : INPUT_MOVE_LEFT;
+	}
+	botInputs[botInputCount++] = INPUT_ROTATE_RIGHT;
+}
+
+// The next touch to where the bot drops the block in play, soft drop held until it locks
+static uint8_t Model_BotInput(void) {
+	if (Engine_PiecesPlaced(&state) != botPlaced) {
+		Placement best;
+
+		botPlaced = Engine_PiecesPlaced(&state);
+		botInputCount = 0;
+		botInputNext = 0;
+		botInputs[botInputCount++] = INPUT_DROP_RELEASE;
+		if (state.currentBlockNum == I_BLOCK) {
+			Model_ShaftInputs(Model_Stack());
+		} else if (Bot_Search(state.gridRows, state.currentBlockNum, &best)) {
+			uint32_t path = Finesse_Path(state.currentBlockNum, best.rotation, best.x);
+			for (uint8_t i = 0; (FINESSE_PRESSES(path) != FINESSE_UNREACHABLE)
+					&& (i < FINESSE_PRESSES(path)); i++) {
+				botInputs[botInputCount++] = FINESSE_INPUT(path, i);
+			}
+		}
+		botInputs[botInputCount++] = INPUT_DROP_PRESS;
+	}
+	return (botInputNext < botInputCount) ? botInputs[botInputNext++] : NO_INPUT;
+}
+
+static void Model_Run(bool chase, uint32_t games, uint32_t seed) {
+	uint32_t updates = 0;
+
+	Scan_Init(Model_Clock, Model_Wait);
+	Scan_SetChase(chase);
+	memset(&model, 0, sizeof(model));
+	now = 0;
+	accountedBytes = 0;
+	accountedPartBytes = 0;
+	jitter = seed | 1;
+
+	for (uint32_t game = 0; game < 2 * games; game++) {
+		bool bot = (game >= games);
+		uint32_t time = 0;
+
+		srand(seed + game);
+		Engine_NewGame(&state, seed + game);
+		Board_Invalidate();
+		botPlaced = UINT32_MAX;
+
+		for (uint32_t step = 0; (step < MAX_STEPS) && !Engine_IsOver(&state); step++) {
+			uint8_t input = bot ? Model_BotInput() : rand() % 7;
+
+			time += rand() % (bot ? 100 : 400);
+			Engine_Advance(&state, time);
+			if (input != NO_INPUT) {
+				Engine_Input(&state, input, time);
+			}
+			if (!(Engine_TakeChanges(&state) & ENGINE_CHANGED_GRID)) {
+				continue;
+			}
+
+			if (++updates % REPAINT_EVERY == 0) {
+				Board_Invalidate();
+			}
+
+			// the rest of the main loop, the update starts anywhere in the refresh
+			now += Model_Random() * SCAN_TOTAL_LINES;
+
+			double before = now;
+			uint32_t waited = Scan_GetStats()->waitLines;
+			Board_Draw(&state, 0, true);
+			double lines = now - before - (Scan_GetStats()->waitLines - waited);
+			if (lines > model.maxUpdateLines) {
+				model.maxUpdateLines = lines;
+			}
+		}
+		model.lines += state.score[0] + 2 * state.score[1] + 3 * state.score[2]
+				+ 4 * state.score[3];
+	}
+
+	const ScanStats *scan = Scan_GetStats();
+	printf("chasing %-3s  %6u updates  %7u bands  %5u torn writes (%u rows)  %5u late bands\n",
+			chase ? "on" : "off", scan->updates, scan->bands, model.tornWrites,
+			model.tornRows, scan->lateBands);
+	printf("             %6u waits, %.1f lines each  render %.2f lines per update,"
+			" max %.1f of %u (%.0f%%)\n", scan->waits,
+			scan->waits ? (double) scan->waitLines / scan->waits : 0.0,
+			model.drawLines / scan->updates, model.maxUpdateLines, LCD_PIXEL_HEIGHT,
+			100.0 * model.maxUpdateLines / LCD_PIXEL_HEIGHT);
+	printf("             %6u lines cleared  %7u moved row parts  %5u torn (%u rows)"
+			"  %5u tall bands\n\n", model.lines, model.shiftWrites, model.tornShiftWrites,
+			model.tornShiftRows, scan->tallBands);
+}
+
+int main(int argc, char **argv) {
+	uint32_t games = 50;
+	uint32_t seed = 1;
+
+	for (int i = 1; i < argc; i++) {
+		if ((strcmp(argv[i], "-n") == 0) && (i + 1 < argc)) {
+			games = strtoul(argv[++i], NULL, 0);
+		} else if ((strcmp(argv[i], "-s") == 0) && (i + 1 < argc)) {
+			seed = strtoul(argv[++i], NULL, 0);
+		} else if ((strcmp(argv[i], "-b") == 0) && (i + 1 < argc)) {
+			bytesPerLine = strtod(argv[++i], NULL);
+		} else {
+			fprintf(stderr, "usage: %s [-n games] [-s seed] [-b bytes per line]\n",
+					argv[0]);
+			return 2;
+		}
+	}
+	if (bytesPerLine <= 0) {
+		fprintf(stderr, "bytes per line must be above 0\n");
+		return 2;
+	}
+
+	Atlas_Init();
+	Placement_Init();
+	printf("%.0f bytes per line, renderer assumes %u\n\n", bytesPerLine,
+			SCAN_BYTES_PER_LINE);
+
+	Model_Run(false, games, seed);
+	Model_Run(true, games, seed);
+
+	// chasing has to be tear free whenever the writes are as fast as ScanSync assumes
+	if ((bytesPerLine / 1.25 >= SCAN_BYTES_PER_LINE) && (model.tornWrites != 0)) {
+		printf("FAIL: tearing with chasing on\n");
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,259 @@
+/*
+ * ScoreStoreSim.c
+ *
+ *  Created on: Dec 10, 2024
+ *      Author: Will Fraser
+ *
+ * Host tool, runs ScoreStore.c against a file-backed model of the two flash
+ * sectors. Programming can only clear bits and erase sets a whole sector to
+ * 0xFF, like the real NOR flash. Games are submitted and written, power is
+ * cut at random points (mid record, mid rotation, mid erase), and after every
+ * reboot the RAM index is checked against the games that actually made it to
+ * flash.
+ *
+ * Build from the repository root:
+ *   gcc -O2 -ICore/Inc Tools/ScoreStoreSim/ScoreStoreSim.c Core/Src/ScoreStore.c
+ *       -o score_store_sim
+ *
+ * Usage:
+ *   score_store_sim <flash file> [-n games] [-k sector KB] [-c cut chance %] [-s seed]
+ *
+ * The flash file persists between runs, so the store can also be inspected or
+ * carried over like the real device.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "ScoreStore.h"
+
+#define MAX_GAMES 200000
+
+// File-backed flash model
+static uint8_t *image;
+static uint32_t sectorSize;
+static FILE *imageFile;
+static long programBudget = -1;	// word programs left before the power cut, -1 = no cut
+static uint32_t eraseCount[STORE_SECTORS];
+static uint32_t programCount;
+
+static void Sim_Sync(uint32_t offset, uint32_t length) {
+	fseek(imageFile, offset, SEEK_SET);
+	fwrite(&image[offset], 1, length, imageFile);
+}
+
+static bool Sim_Erase(uint8_t sector) {
+	uint32_t base = sector * sectorSize;
+
+	if (programBudget == 0) {
+		return false;
+	}
+	// a cut during erase leaves the sector half erased
+	if ((programBudget > 0) && (rand() % 8 == 0)) {
+		memset(&image[base], 0xFF, sectorSize / 2);
+		Sim_Sync(base, sectorSize);
+		programBudget = 0;
+		return false;
+	}
+
+	memset(&image[base], 0xFF, sectorSize);
+	Sim_Sync(base, sectorSize);
+	eraseCount[sector]++;
+	return true;
+}
+
+static bool Sim_Program(uint8_t sector, uint32_t offset, uint32_t word) {
+	uint32_t address = sector * sectorSize + offset;
+	uint32_t current;
+
+	if (programBudget == 0) {
+		return false;
+	}
+	if (programBudget > 0) {
+		programBudget--;
+	}
+
+	// NOR flash can only clear bits
+	memcpy(&current, &image[address], 4);
+	current &= word;
+	memcpy(&image[address], &current, 4);
+	Sim_Sync(address, 4);
+	programCount++;
+
+	return current == word;
+}
+
+static FlashPort simFlash;
+
+// Reference model, every game whose record was fully written
+typedef struct {
+	uint32_t points;
+	uint32_t elapsed;
+	uint32_t seed;
+	uint16_t lines[4];
+} SimGame;
+
+static SimGame committed[MAX_GAMES];
+static int committedCount;
+static SimGame pendingGames[64];
+static int pendingCount;
+
+static int Sim_Compare(const void *a, const void *b) {
+	const SimGame *x = a, *y = b;
+	return (x->points < y->points) - (x->points > y->points);
+}
+
+// Check the RAM index built by Store_Init against the reference
+static int Sim_Check(void) {
+	static SimGame sorted[MAX_GAMES];
+	const StoreTotals *totals = Store_GetTotals();
+	StoreTotals expected = { 0 };
+	int errors = 0;
+
+	for (int i = 0; i < committedCount; i++) {
+		expected.games++;
+		expected.timePlayed += committed[i].elapsed;
+		for (int j = 0; j < 4; j++) {
+			expected.lines[j] += committed[i].lines[j];
+		}
+		if (committed[i].elapsed > expected.bestTime) {
+			expected.bestTime = committed[i].elapsed;
+		}
+	}
+	if (memcmp(&expected, totals, sizeof(expected)) != 0) {
+		printf("totals differ: games %u/%u time %u/%u best %u/%u\n", totals->games,
+				expected.games, totals->timePlayed, expected.timePlayed,
+				totals->bestTime, expected.bestTime);
+		errors++;
+	}
+
+	// only points are compared, so the order of equal scores does not matter
+	memcpy(sorted, committed, committedCount * sizeof(SimGame));
+	qsort(sorted, committedCount, sizeof(SimGame), Sim_Compare);
+
+	int count = committedCount < STORE_LEADERBOARD_SIZE ? committedCount :
+			STORE_LEADERBOARD_SIZE;
+	if (Store_LeaderboardCount() != count) {
+		printf("leaderboard has %u entries, expected %d\n", Store_LeaderboardCount(),
+				count);
+		return errors + 1;
+	}
+	for (int i = 0; i < count; i++) {
+		const ScoreRecord *entry = Store_LeaderboardEntry(i);
+		if (entry->points != sorted[i].points) {
+			printf("rank %d: points %u expected %u\n", i, entry->points,
+					sorted[i].points);
+			errors++;
+		}
+	}
+	return errors;
+}
+
+static void Sim_RandomGame(SimGame *game) {
+	memset(game, 0, sizeof(*game));
+	game->elapsed = 20000 + rand() % 600000;
+	game->seed = (uint32_t) rand();
+	for (int j = 0; j < 4; j++) {
+		game->lines[j] = rand() % (12 - 3 * j);
+	}
+	game->points = Store_Points(game->lines);
+}
+
+int main(int argc, char **argv) {
+	int games = 20000, cutChance = 2;
+	unsigned seed = 1;
+	uint32_t sectorKB = 128;
+
+	if (argc < 2) {
+		fprintf(stderr, "usage: %s <flash file> [-n games] [-k sector KB] [-c cut %%] [-s seed]\n",
+				argv[0]);
+		return 2;
+	}
+	for (int i = 2; i + 1 < argc; i += 2) {
+		if (strcmp(argv[i], "-n") == 0) {
+			games = atoi(argv[i + 1]);
+		} else if (strcmp(argv[i], "-k") == 0) {
+			sectorKB = (uint32_t) atoi(argv[i + 1]);
+		} else if (strcmp(argv[i], "-c") == 0) {
+			cutChance = atoi(argv[i + 1]);
+		} else if (strcmp(argv[i], "-s") == 0) {
+			seed = (unsigned) strtoul(argv[i + 1], NULL, 0);
+		}
+	}
+	if (games > MAX_GAMES) {
+		games = MAX_GAMES;
+	}
+	srand(seed);
+
+	// always start from blank flash so the reference model matches
+	sectorSize = sectorKB * 1024;
+	image = malloc(STORE_SECTORS * sectorSize);
+	memset(image, 0xFF, STORE_SECTORS * sectorSize);
+	imageFile = fopen(argv[1], "w+b");
+	if (imageFile == NULL) {
+		perror(argv[1]);
+		return 2;
+	}
+	Sim_Sync(0, STORE_SECTORS * sectorSize);
+
+	for (int s = 0; s < STORE_SECTORS; s++) {
+		simFlash.sector[s] = &image[s * sectorSize];
+	}
+	simFlash.sectorSize = sectorSize;
+	simFlash.erase = Sim_Erase;
+	simFlash.program = Sim_Program;
+
+	Store_Init(&simFlash);
+
+	int reboots = 0, errors = 0;
+	double bootTime = 0;
+
+	for (int g = 0; g < games; g++) {
+		SimGame game;
+		Sim_RandomGame(&game);
+		Store_SubmitGame(game.elapsed, game.lines, game.seed);
+		pendingGames[pendingCount++] = game;
+
+		// idle time comes after most games, sometimes a few games pile up
+		if ((rand() % 4 != 0) || (pendingCount >= 4)) {
+			if ((cutChance > 0) && (rand() % 100 < cutChance)) {
+				programBudget = rand() % 40;
+			}
+			while (Store_Pending()) {
+				if (!Store_Service()) {
+					break;
+				}
+				committed[committedCount++] = pendingGames[0];
+				memmove(&pendingGames[0], &pendingGames[1],
+						--pendingCount * sizeof(SimGame));
+			}
+		}
+
+		// power lost: RAM is gone, rebuild from flash and check
+		if (programBudget == 0) {
+			clock_t start = clock();
+			Store_Init(&simFlash);
+			bootTime += (double) (clock() - start) / CLOCKS_PER_SEC;
+			reboots++;
+			pendingCount = 0;
+			programBudget = -1;
+			errors += Sim_Check();
+		} else {
+			programBudget = -1;
+		}
+	}
+
+	Store_Init(&simFlash);
+	errors += Sim_Check();
+
+	printf("%d games, %d written, %d power cuts, %d errors\n", games,
+			committedCount, reboots, errors);
+	printf("erases per sector %u/%u, %u word programs, %.1f us per index rebuild\n",
+			eraseCount[0], eraseCount[1], programCount,
+			reboots ? bootTime / reboots * 1e6 : 0.0);
+
+	fclose(imageFile);
+	return errors ? 1 : 0;
+}
@@ -0,0 +1,314 @@
+/*
+ * ScreenGen.c
+ *
+ *  Created on: Dec 17, 2024
+ *      Author: Will Fraser
+ *
+ * Host tool, renders the static screens with the real drawing code, compresses them
+ * into the command stream described in ScreenImage.h and writes Core/Src/ScreenImages.c.
+ * Run it again whenever the title, the results labels, the tiles or the fonts change
+ * (with -DATLAS_BEVEL when the board is built with it).
+ *
+ * Every screen is decoded again with Screen_Decode and has to match the render pixel
+ * for pixel. The time to draw each screen the old way and to decode it, and the
+ * compressed sizes, are printed to stderr.
+ *
+ * Build and run from the repository root:
+ *   gcc -O2 -ICore/Inc Tools/ScreenGen/ScreenGen.c Core/Src/ScreenImage.c
+ *       Core/Src/BoardView.c Core/Src/ScanSync.c Core/Src/TileAtlas.c
+ *       Core/Src/LCD_Graphics.c Core/Src/GlyphMasks.c Core/Src/fonts.c
+ *       Core/Src/GameEngine.c Core/Src/PieceBag.c -o screen_gen
+ *   ./screen_gen > Core/Src/ScreenImages.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "BoardView.h"
+#include "ScreenImage.h"
+
+#define ROUNDS        500		// timing repeats
+#define MIN_MATCH     12		// shorter runs and copies stay in literals, fewer commands to decode
+#define HASH_SIZE     65536
+#define CHAIN_DEPTH   1024		// earlier positions tried per pixel
+#define MAX_DISTANCE  0xFFFF
+
+static GameState game;					// the menu board is scripted on it
+static uint16_t rendered[LCD_PIXELS];
+static uint16_t stream[LCD_PIXELS * 2];
+static int32_t hashHead[HASH_SIZE];
+static int32_t hashPrevious[LCD_PIXELS];
+
+static double Gen_Seconds(void) {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+// The scripted menu board, moved here from ApplicationCode.c. Blocks spawn a row into
+// the hidden rows, the first move down of each one brings it to the top visible row
+static void Gen_ArrangeBlocks(void) {
+	// Positions T block
+	GenerateBlock(&game, T_BLOCK);
+	MoveCurrentBlock(&game, MOVE_DOWN);
+	RotateCurrentBlock(&game, ROTATE_LEFT);
+	MoveCurrentBlock(&game, MOVE_RIGHT);
+	MoveCurrentBlock(&game, MOVE_RIGHT);
+	MoveCurrentBlock(&game, MOVE_RIGHT);
+	MoveCurrentBlock(&game, MOVE_RIGHT);
+	MoveCurrentBlock(&game, MOVE_DOWN);
+	MoveCurrentBlock(&game, MOVE_DOWN);
+	MoveCurrentBlock(&game, MOVE_DOWN);
+	MoveCurrentBlock(&game, MOVE_DOWN);
+	MoveCurrentBlock(&game, MOVE_DOWN);
+	MoveCurrentBlock(&game, MOVE_DOWN);
+	MoveCurrentBlock(&game, MOVE_DOWN);
+	PlaceCurrentBlock(&game);
+
+	// Positions S block
+	GenerateBlock(&game, S_BLOCK);
+	MoveCurrentBlock(&game, MOVE_DOWN);
+	RotateCurrentBlock(&game, ROTATE_RIGHT);
+	MoveCurrentBlock(&game, MOVE_LEFT);
+	MoveCurrentBlock(&game, MOVE_LEFT);
+	MoveCurrentBlock(&game, MOVE_LEFT);
+	MoveCurrentBlock(&game, MOVE_LEFT);
+	MoveCurrentBlock(&game, MOVE_LEFT);
+	MoveCurrentBlock(&game, MOVE_DOWN);
+	MoveCurrentBlock(&game, MOVE_DOWN);
+	MoveCurrentBlock(&game, MOVE_DOWN);
+	MoveCurrentBlock(&game, MOVE_DOWN);
+	MoveCurrentBlock(&game, MOVE_DOWN);
+	PlaceCurrentBlock(&game);
+
+	// Positions L block
+	GenerateBlock(&game, L_BLOCK);
+	MoveCurrentBlock(&game, MOVE_DOWN);
+	RotateCurrentBlock(&game, ROTATE_RIGHT);
+	MoveCurrentBlock(&game, MOVE_LEFT);
+	MoveCurrentBlock(&game, MOVE_LEFT);
+	MoveCurrentBlock(&game, MOVE_DOWN);
+	MoveCurrentBlock(&game, MOVE_DOWN);
+	MoveCurrentBlock(&game, MOVE_DOWN);
+	MoveCurrentBlock(&game, MOVE_DOWN);
+	MoveCurrentBlock(&game, MOVE_DOWN);
+	PlaceCurrentBlock(&game);
+
+	// Positions O block
+	GenerateBlock(&game, O_BLOCK);
+	MoveCurrentBlock(&game, MOVE_DOWN);
+	MoveCurrentBlock(&game, MOVE_RIGHT);
+	MoveCurrentBlock(&game, MOVE_DOWN);
+	MoveCurrentBlock(&game, MOVE_DOWN);
+	MoveCurrentBlock(&game, MOVE_DOWN);
+	MoveCurrentBlock(&game, MOVE_DOWN);
+	PlaceCurrentBlock(&game);
+
+	// Positions J block
+	GenerateBlock(&game, J_BLOCK);
+	MoveCurrentBlock(&game, MOVE_DOWN);
+	RotateCurrentBlock(&game, ROTATE_RIGHT);
+	MoveCurrentBlock(&game, MOVE_RIGHT);
+	MoveCurrentBlock(&game, MOVE_RIGHT);
+	MoveCurrentBlock(&game, MOVE_RIGHT);
+	MoveCurrentBlock(&game, MOVE_RIGHT);
+	MoveCurrentBlock(&game, MOVE_DOWN);
+	MoveCurrentBlock(&game, MOVE_DOWN);
+	PlaceCurrentBlock(&game);
+
+	// Positions Z block
+	GenerateBlock(&game, Z_BLOCK);
+	MoveCurrentBlock(&game, MOVE_DOWN);
+	MoveCurrentBlock(&game, MOVE_LEFT);
+	MoveCurrentBlock(&game, MOVE_LEFT);
+	MoveCurrentBlock(&game, MOVE_LEFT);
+	MoveCurrentBlock(&game, MOVE_LEFT);
+	MoveCurrentBlock(&game, MOVE_DOWN);
+	MoveCurrentBlock(&game, MOVE_DOWN);
+	MoveCurrentBlock(&game, MOVE_DOWN);
+	PlaceCurrentBlock(&game);
+
+	// Positions I block
+	GenerateBlock(&game, I_BLOCK);
+	MoveCurrentBlock(&game, MOVE_DOWN);
+	MoveCurrentBlock(&game, MOVE_DOWN);
+	MoveCurrentBlock(&game, MOVE_DOWN);
+	MoveCurrentBlock(&game, MOVE_RIGHT);
+	PlaceCurrentBlock(&game);
+}
+
+// What displayMainMenu drew before the title came from flash
+static void Gen_RenderTitle(void) {
+	InitGameGrid(&game);
+	Gen_ArrangeBlocks();
+	Board_Invalidate();
+	Board_Draw(&game, 0, false);
+
+	LCD_SetFont(&Font16x24);
+	LCD_SetTextColor(LCD_COLOR_WHITE);
+	LCD_DisplayString(LCD_PIXEL_WIDTH / 2, 21, "TETRIS", LCD_ALIGN_CENTER);
+}
+
+// The part of displayResultsScreen that is the same after every game
+static void Gen_RenderResults(void) {
+	static const char *lineNames[4] = { "SINGLES", "DOUBLES", "TRIPLES", "TETRIS!" };
+
+	LCD_Clear(0, LCD_COLOR_BLACK);
+	LCD_SetFont(&Font16x24);
+	LCD_SetTextColor(LCD_COLOR_WHITE);
+
+	LCD_DisplayString(LCD_PIXEL_WIDTH / 2, 61, "TOTAL", LCD_ALIGN_CENTER);
+	LCD_DisplayString(LCD_PIXEL_WIDTH / 2, 81, "TIME MS", LCD_ALIGN_CENTER);
+	for (uint8_t i = 0; i < 4; i++) {
+		LCD_DisplayString(RESULTS_LABEL_X, 181 + i * 20, lineNames[i], LCD_ALIGN_LEFT);
+	}
+	LCD_DisplayString(RESULTS_LABEL_X, 281, "BEST", LCD_ALIGN_LEFT);
+}
+
+static uint32_t Gen_Hash(uint32_t position) {
+	uint32_t key = rendered[position] | (uint32_t) rendered[position + 1] << 16;
+	return (key * 2654435761u) >> 16;
+}
+
+static void Gen_Insert(uint32_t position) {
+	if (position + 1 < LCD_PIXELS) {
+		uint32_t hash = Gen_Hash(position);
+		hashPrevious[position] = hashHead[hash];
+		hashHead[hash] = position;
+	}
+}
+
+// Longest copy from an earlier position starting with the same two pixels
+static uint32_t Gen_LongestCopy(uint32_t position, uint32_t limit, uint32_t *distance) {
+	uint32_t best = 0;
+
+	if (position + 1 >= LCD_PIXELS) {
+		return 0;
+	}
+	int32_t candidate = hashHead[Gen_Hash(position)];
+	for (uint32_t depth = 0; (candidate >= 0) && (depth < CHAIN_DEPTH); depth++) {
+		if (position - candidate > MAX_DISTANCE) {
+			break;
+		}
+		uint32_t length = 0;
+		while ((length < limit) && (rendered[candidate + length] == rendered[position + length])) {
+			length++;
+		}
+		if (length > best) {
+			best = length;
+			*distance = position - candidate;
+		}
+		candidate = hashPrevious[candidate];
+	}
+	return best;
+}
+
+static void Gen_Command(uint32_t *length, uint8_t op, uint32_t count) {
+	stream[(*length)++] = (op << SCREEN_OP_SHIFT) | count;
+}
+
+static void Gen_FlushLiteral(uint32_t *length, uint32_t from, uint32_t to) {
+	while (from < to) {
+		uint32_t count = to - from;
+		if (count > SCREEN_COUNT_MASK) {
+			count = SCREEN_COUNT_MASK;
+		}
+		Gen_Command(length, SCREEN_LITERAL, count);
+		memcpy(&stream[*length], &rendered[from], count * sizeof(uint16_t));
+		*length += count;
+		from += count;
+	}
+}
+
+// Greedy: at every pixel the longer of a run and a copy, pixels with neither are literals
+static uint32_t Gen_Encode(void) {
+	uint32_t length = 0;
+	uint32_t literal = 0;
+	uint32_t position = 0;
+
+	memset(hashHead, 0xFF, sizeof(hashHead));
+	while (position < LCD_PIXELS) {
+		uint32_t limit = LCD_PIXELS - position;
+		if (limit > SCREEN_COUNT_MASK) {
+			limit = SCREEN_COUNT_MASK;
+		}
+
+		uint32_t run = 1;
+		while ((run < limit) && (rendered[position + run] == rendered[position])) {
+			run++;
+		}
+		uint32_t distance = 0;
+		uint32_t copy = Gen_LongestCopy(position, limit, &distance);
+
+		uint32_t count = (run >= copy) ? run : copy;
+		if (count < MIN_MATCH) {
+			Gen_Insert(position++);
+			continue;
+		}
+
+		Gen_FlushLiteral(&length, literal, position);
+		if (run >= copy) {
+			Gen_Command(&length, SCREEN_RUN, run);
+			stream[length++] = rendered[position];
+		} else {
+			Gen_Command(&length, SCREEN_COPY, copy);
+			stream[length++] = distance;
+		}
+		for (uint32_t i = 0; i < count; i++) {
+			Gen_Insert(position++);
+		}
+		literal = position;
+	}
+	Gen_FlushLiteral(&length, literal, position);
+	return length;
+}
+
+static int Gen_Screen(const char *name, void (*render)(void)) {
+	double start = Gen_Seconds();
+	for (uint32_t round = 0; round < ROUNDS; round++) {
+		render();
+	}
+	double renderTime = (Gen_Seconds() - start) / ROUNDS;
+	memcpy(rendered, frameBuffer, sizeof(rendered));
+
+	uint32_t length = Gen_Encode();
+	ScreenImage image = { stream, length };
+
+	memset(frameBuffer, 0x55, sizeof(rendered));
+	bool valid = Screen_Decode(&image);
+	if (!valid || (memcmp(frameBuffer, rendered, sizeof(rendered)) != 0)) {
+		fprintf(stderr, "%s does not decode to the render\n", name);
+		return 1;
+	}
+
+	start = Gen_Seconds();
+	for (uint32_t round = 0; round < ROUNDS; round++) {
+		Screen_Decode(&image);
+	}
+	double decodeTime = (Gen_Seconds() - start) / ROUNDS;
+
+	fprintf(stderr, "%-8s %6u bytes (%4.1f%% of %u)  render %7.2f us  decode %6.2f us  %5.1fx\n",
+			name, length * 2, 100.0 * length * 2 / sizeof(rendered),
+			(unsigned) sizeof(rendered), renderTime * 1e6, decodeTime * 1e6,
+			renderTime / decodeTime);
+
+	printf("static const uint16_t %sWords[%u] = {", name, length);
+	for (uint32_t i = 0; i < length; i++) {
+		printf("%s0x%04X,", (i % 12) ? " " : "\n\t\t", stream[i]);
+	}
+	printf("\n};\n\n");
+	printf("const ScreenImage Screen%s = { %sWords, %u };\n\n", name, name, length);
+	return 0;
+}
+
+int main(void) {
+	Atlas_Init();
+
+	printf("/*\n * ScreenImages.c\n *\n * Generated by Tools/ScreenGen, do not edit.\n */\n\n");
+	printf("#include \"ScreenImage.h\"\n\n");
+
+	int errors = Gen_Screen("Title", Gen_RenderTitle) + Gen_Screen("Results", Gen_RenderResults);
+	return (errors == 0) ? 0 : 1;
+}
@@ -0,0 +1,380 @@
+/*
+ * UiCompositor.c
+ *
+ *  Created on: Dec 14, 2024
+ *      Author: Will Fraser
+ *
+ * Host model of the LTDC blending the UI layer over the playfield: layer 0 widened
+ * from RGB565, layer 1 looked up in the CLUT, UI_KEY_RGB keyed out and the rest
+ * blended with UI_ALPHA. The screens are drawn twice, once with everything in
+ * frameBuffer (single layout, the panel redrawn over every board update) and once
+ * with Overlay.c on layer 1 (layered layout), and the blended output of both has to
+ * be the same on every frame. Games are played with random inputs through the real
+ * engine. The HUD follows the game in both: on layer 1 only its changed digits are
+ * drawn, in frameBuffer the board under it has to be drawn again first. The draw time
+ * per frame and the memory of both layouts are printed at the end.
+ *
+ * Build from the repository root:
+ *   gcc -O2 -ICore/Inc Tools/UiCompositor/UiCompositor.c Core/Src/UiLayer.c
+ *       Core/Src/Overlay.c Core/Src/Widget.c Core/Src/ScreenImage.c Core/Src/ScreenImages.c
+ *       Core/Src/BoardView.c Core/Src/ScanSync.c
+ *       Core/Src/TileAtlas.c Core/Src/LCD_Graphics.c Core/Src/GlyphMasks.c Core/Src/fonts.c
+ *       Core/Src/GameEngine.c Core/Src/PieceBag.c -o ui_compositor
+ *
+ *   ui_compositor [-n games] [-s seed] [-p prefix]
+ *
+ * -p writes the last blended frame of each screen to <prefix>menu.ppm and
+ * <prefix>game.ppm.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "BoardView.h"
+#include "Overlay.h"
+
+#define MAX_STEPS  4000			// inputs per game before it is cut short
+
+#define LAYOUT_SINGLE  0
+#define LAYOUT_LAYERED 1
+
+typedef struct {
+	double board;				// seconds in Board_Draw
+	double panel;				// seconds drawing the hold slot and preview
+	double hud;					// seconds bringing the HUD up to date
+	uint32_t frames;			// frames with anything to draw
+} DrawCost;
+
+static GameState game;
+static uint32_t blended[LCD_PIXELS];
+static uint64_t *frameHashes;
+static uint32_t frameCount;
+static DrawCost costs[2];
+
+static double Compositor_Seconds(void) {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+// Blend one channel the way the LTDC does with factors CA and 1 - CA
+static uint32_t Compositor_Channel(uint32_t top, uint32_t bottom, uint32_t shift) {
+	uint32_t c1 = (top >> shift) & 0xFF, c0 = (bottom >> shift) & 0xFF;
+	return ((c1 * UI_ALPHA + c0 * (255 - UI_ALPHA)) / 255) << shift;
+}
+
+// Output of the LTDC for the current frameBuffer, uiBuffer and uiWindow
+static void Compositor_Blend(void) {
+	for (uint32_t i = 0; i < LCD_PIXELS; i++) {
+		blended[i] = Ui_ExpandRGB565(frameBuffer[i]);
+	}
+	if (!uiWindow.visible) {
+		return;
+	}
+
+	for (uint16_t y = 0; y < uiWindow.height; y++) {
+		const uint8_t *line = &uiBuffer[y * uiWindow.width];
+		uint32_t *out = &blended[(uiWindow.y + y) * LCD_PIXEL_WIDTH + uiWindow.x];
+		for (uint16_t x = 0; x < uiWindow.width; x++) {
+			uint32_t color = Ui_PaletteRGB(line[x]);
+			if (color != UI_KEY_RGB) {
+				out[x] = Compositor_Channel(color, out[x], 16)
+						| Compositor_Channel(color, out[x], 8)
+						| Compositor_Channel(color, out[x], 0);
+			}
+		}
+	}
+}
+
+static uint64_t Compositor_Hash(void) {
+	uint64_t hash = 14695981039346656037ull;
+
+	for (uint32_t i = 0; i < LCD_PIXELS; i++) {
+		hash = (hash ^ blended[i]) * 1099511628211ull;
+	}
+	return hash;
+}
+
+static void Compositor_WritePPM(const char *prefix, const char *screen) {
+	char name[256];
+	snprintf(name, sizeof(name), "%s%s.ppm", prefix, screen);
+
+	FILE *file = fopen(name, "wb");
+	if (file == NULL) {
+		perror(name);
+		return;
+	}
+	fprintf(file, "P6\n%u %u\n255\n", LCD_PIXEL_WIDTH, LCD_PIXEL_HEIGHT);
+	for (uint32_t i = 0; i < LCD_PIXELS; i++) {
+		uint8_t rgb[3] = { blended[i] >> 16, blended[i] >> 8, blended[i] };
+		fwrite(rgb, 1, 3, file);
+	}
+	fclose(file);
+}
+
+// The preview panel as DrawPreviewPanel drew it into frameBuffer before the UI layer
+static void Single_DrawSlot(uint16_t slotX, uint8_t blockNum) {
+	LCD_Draw_Rectangle_Fill(slotX, 0, slotX + PREVIEW_SLOT_W - 1, ATLAS_TILE_SIZE - 1,
+			LCD_COLOR_BLACK);
+
+	if (blockNum == NO_BLOCK) {
+		return;
+	}
+
+	const TetrisBlock *block = &tetrisBlocks[blockNum - 1];
+	uint16_t top = (ATLAS_TILE_SIZE - PREVIEW_SLOT_W) / 2;
+
+	for (uint8_t y = 0; y < BLOCK_SIZE; y++) {
+		for (uint8_t x = 0; x < BLOCK_SIZE; x++) {
+			if (block->shape[y][x] == 1) {
+				Atlas_DrawMini(slotX + x * PREVIEW_CELL_SIZE, top + y * PREVIEW_CELL_SIZE,
+						blockNum);
+			}
+		}
+	}
+}
+
+static void Single_DrawPreview(void) {
+	Single_DrawSlot(HOLD_X, Engine_GetHold(&game));
+	for (uint8_t i = 0; i < PREVIEW_COUNT; i++) {
+		Single_DrawSlot(PREVIEW_X + i * PREVIEW_SLOT_W, Engine_PeekNext(&game, i));
+	}
+}
+
+// The HUD printed into frameBuffer from the values Overlay_SetHud left in gameScreen
+static void Single_DrawHud(void) {
+	const Widget *widgets = gameScreen.widgets;
+	char text[16];
+
+	LCD_SetFont(&Font12x12);
+	for (uint8_t i = 0; i < gameScreen.count; i++) {
+		const Widget *widget = &widgets[i];
+		uint32_t value = widget->value;
+
+		if (widget->type == WIDGET_LABEL) {
+			snprintf(text, sizeof(text), "%s", widget->text);
+		} else if (widget->type == WIDGET_CLOCK) {
+			snprintf(text, sizeof(text), "%u:%02u", value / 60, value % 60);
+		} else if ((widget->type == WIDGET_NUMBER) && (widget->decimals == 2)) {
+			snprintf(text, sizeof(text), "%u.%02u", value / 100, value % 100);
+		} else if (widget->type == WIDGET_NUMBER) {
+			snprintf(text, sizeof(text), "%u", value);
+		} else {
+			continue;
+		}
+		LCD_SetTextColor((widget->color == UI_GREY) ? LCD_COLOR_GREY : LCD_COLOR_WHITE);
+		LCD_DisplayString(widget->x, widget->y, text, widget->align);
+	}
+}
+
+// HUD values of the game so far, returns whether any of them changed
+static bool Compositor_SetHud(uint32_t now) {
+	static uint32_t last[HUD_PPS - HUD_SCORE + 1];
+	const uint16_t *score = Engine_GetScore(&game);
+	uint32_t points = 100 * score[0] + 300 * score[1] + 500 * score[2] + 800 * score[3];
+	bool changed = false;
+
+	Overlay_SetHud(now, score, points, Engine_PiecesPlaced(&game));
+	for (uint8_t field = HUD_SCORE; field <= HUD_PPS; field++) {
+		changed |= (gameScreen.widgets[field].value != last[field - HUD_SCORE]);
+		last[field - HUD_SCORE] = gameScreen.widgets[field].value;
+	}
+	return changed;
+}
+
+// Main menu over the board of a game in progress, returns the blended hash
+static uint64_t Compositor_Menu(uint8_t layout) {
+	Board_Invalidate();
+	Board_Draw(&game, 0, false);
+
+	LCD_SetFont(&Font16x24);
+	LCD_SetTextColor(LCD_COLOR_WHITE);
+	LCD_DisplayString(LCD_PIXEL_WIDTH / 2, 21, "TETRIS", LCD_ALIGN_CENTER);
+
+	if (layout == LAYOUT_SINGLE) {
+		Ui_Hide();
+		LCD_Draw_Rectangle_Fill(MENU_BUTTON_X1, MENU_BUTTON_Y1, MENU_BUTTON_X2,
+				MENU_BUTTON_Y2, LCD_COLOR_BLACK);
+		LCD_SetTextColor(LCD_COLOR_GREEN);
+		LCD_DisplayString(LCD_PIXEL_WIDTH / 2, 241, "GO", LCD_ALIGN_CENTER);
+	} else {
+		Overlay_Menu();
+	}
+
+	Compositor_Blend();
+	return Compositor_Hash();
+}
+
+// Draw whatever the engine changed, timed
+static void Compositor_DrawFrame(uint8_t layout, uint8_t changes, uint32_t now) {
+	DrawCost *cost = &costs[layout];
+	bool hudChanged = Compositor_SetHud(now);
+	double start = Compositor_Seconds();
+
+	// text drawn over the board in frameBuffer can only be taken off by the board
+	if ((layout == LAYOUT_SINGLE) && hudChanged) {
+		Board_Invalidate();
+		changes |= ENGINE_CHANGED_GRID;
+	}
+	if (changes & ENGINE_CHANGED_GRID) {
+		Board_Draw(&game, 0, true);
+	}
+	double middle = Compositor_Seconds();
+
+	// sharing frameBuffer, the panel has to go back on top of every board update
+	if ((changes & ENGINE_CHANGED_QUEUE)
+			|| ((layout == LAYOUT_SINGLE) && (changes & ENGINE_CHANGED_GRID))) {
+		if (layout == LAYOUT_SINGLE) {
+			Single_DrawPreview();
+		} else {
+			Overlay_DrawPreview(&game);
+		}
+	}
+	double end = Compositor_Seconds();
+
+	if (layout == LAYOUT_SINGLE) {
+		if (changes & ENGINE_CHANGED_GRID) {
+			Single_DrawHud();
+		}
+	} else {
+		Widget_Render(&gameScreen);
+	}
+	double hud = Compositor_Seconds();
+
+	cost->board += middle - start;
+	cost->panel += end - middle;
+	cost->hud += hud - end;
+	cost->frames++;
+}
+
+/*
+ * Play one game with random inputs. The single layout records the hash of every
+ * frame, the layered layout replays the same inputs and compares. Returns the
+ * number of frames that differ.
+ */
+static uint32_t Compositor_Game(uint8_t layout, uint32_t seed) {
+	uint32_t mismatches = 0;
+	uint32_t frame = 0;
+	uint32_t now = 0;
+
+	srand(seed);
+	Engine_NewGame(&game, seed);
+	Engine_TakeChanges(&game);
+
+	LCD_Clear(0, LCD_COLOR_BLACK);
+	Board_Invalidate();
+	if (layout == LAYOUT_SINGLE) {
+		Ui_Hide();
+		Compositor_DrawFrame(layout, ENGINE_CHANGED_GRID | ENGINE_CHANGED_QUEUE, now);
+	} else {
+		Overlay_Game(&game);
+		Compositor_DrawFrame(layout, ENGINE_CHANGED_GRID, now);
+	}
+
+	for (uint32_t step = 0; (step < MAX_STEPS) && !Engine_IsOver(&game); step++) {
+		now += rand() % 400;
+		Engine_Advance(&game, now);
+		Engine_Input(&game, rand() % 7, now);
+
+		uint8_t changes = Engine_TakeChanges(&game);
+		if (changes == 0) {
+			continue;
+		}
+		Compositor_DrawFrame(layout, changes, now);
+
+		Compositor_Blend();
+		uint64_t hash = Compositor_Hash();
+		if (layout == LAYOUT_SINGLE) {
+			frameHashes[frameCount + frame] = hash;
+		} else if (frameHashes[frameCount + frame] != hash) {
+			if (mismatches == 0) {
+				printf("seed %08x frame %u: layered output differs\n", seed, frame);
+			}
+			mismatches++;
+		}
+		frame++;
+	}
+
+	if (layout == LAYOUT_LAYERED) {
+		frameCount += frame;
+	}
+	return mismatches;
+}
+
+int main(int argc, char **argv) {
+	uint32_t games = 50;
+	uint32_t seed = 1;
+	const char *prefix = NULL;
+
+	for (int i = 1; i < argc; i++) {
+		if ((strcmp(argv[i], "-n") == 0) && (i + 1 < argc)) {
+			games = strtoul(argv[++i], NULL, 0);
+		} else if ((strcmp(argv[i], "-s") == 0) && (i + 1 < argc)) {
+			seed = strtoul(argv[++i], NULL, 0);
+		} else if ((strcmp(argv[i], "-p") == 0) && (i + 1 < argc)) {
+			prefix = argv[++i];
+		} else {
+			fprintf(stderr, "usage: %s [-n games] [-s seed] [-p prefix]\n", argv[0]);
+			return 2;
+		}
+	}
+
+	Atlas_Init();
+	frameHashes = malloc((size_t) games * MAX_STEPS * sizeof(uint64_t));
+	if (frameHashes == NULL) {
+		fprintf(stderr, "out of memory\n");
+		return 1;
+	}
+
+	// menu over a board partly filled by a game
+	uint32_t errors = 0;
+	Engine_NewGame(&game, seed);
+	for (uint32_t now = 0; now < 20000; now += 50) {
+		Engine_Advance(&game, now);
+		Engine_Input(&game, rand() % 4, now);
+	}
+	uint64_t single = Compositor_Menu(LAYOUT_SINGLE);
+	uint64_t layered = Compositor_Menu(LAYOUT_LAYERED);
+	if (single != layered) {
+		printf("menu: layered output differs\n");
+		errors++;
+	}
+	if (prefix != NULL) {
+		Compositor_WritePPM(prefix, "menu");
+	}
+
+	for (uint32_t game = 0; game < games; game++) {
+		Compositor_Game(LAYOUT_SINGLE, seed + game);
+		errors += Compositor_Game(LAYOUT_LAYERED, seed + game);
+	}
+	if (prefix != NULL) {
+		Compositor_WritePPM(prefix, "game");
+	}
+
+	printf("%u games, %u frames compared, %u differ\n\n", games, frameCount, errors);
+
+	static const char *names[2] = { "single ", "layered" };
+	printf("layout   board us  panel us    hud us  total us per frame\n");
+	for (uint8_t layout = 0; layout < 2; layout++) {
+		DrawCost *cost = &costs[layout];
+		printf("%s  %8.2f  %8.2f  %8.2f  %8.2f\n", names[layout],
+				cost->board * 1e6 / cost->frames, cost->panel * 1e6 / cost->frames,
+				cost->hud * 1e6 / cost->frames,
+				(cost->board + cost->panel + cost->hud) * 1e6 / cost->frames);
+	}
+
+	uint32_t frameBytes = sizeof(frameBuffer);
+	uint32_t menuWindow = (MENU_BUTTON_X2 - MENU_BUTTON_X1 + 1)
+			* (MENU_BUTTON_Y2 - MENU_BUTTON_Y1 + 1);
+	uint32_t gameWindow = GRID_WIDTH * ATLAS_TILE_SIZE * HUD_HEIGHT;
+	printf("\nlayout   SRAM bytes  LTDC bytes read per refresh (menu / game)\n");
+	printf("single   %10u  %u / %u\n", frameBytes, frameBytes, frameBytes);
+	printf("layered  %10u  %u / %u  (L8 buffer %u, CLUT %u entries in the LTDC)\n",
+			frameBytes + (uint32_t) sizeof(uiBuffer), frameBytes + menuWindow,
+			frameBytes + gameWindow, (uint32_t) sizeof(uiBuffer), UI_PALETTE_SIZE);
+
+	free(frameHashes);
+	return (errors == 0) ? 0 : 1;
+}
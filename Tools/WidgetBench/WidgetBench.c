@@ -0,0 +1,311 @@
+/*
+ * WidgetBench.c
+ *
+ *  Created on: Dec 18, 2024
+ *      Author: Will Fraser
+ *
+ * Host tool for the retained screens in Overlay.c. The results screen is drawn with
+ * random numbers and compared with the old immediate drawing (clear, labels,
+ * LCD_DisplayNumber). Then its numbers are changed at random many times over and
+ * after every Widget_Render the frame has to match the immediate draw of the same numbers,
+ * so nothing a redraw leaves behind or misses goes unnoticed. The HUD is run through
+ * a simulated game the same way, each per digit update of the UI window against the
+ * HUD cleared and printed again with snprintf. Every touch point is looked up in the
+ * game and menu screens and compared with the bounds HandleTouch used to test.
+ *
+ * Prints the pixels redrawn per change against a full redraw, the cost of a HUD
+ * update, and what keeping a static screen up to date costs.
+ *
+ * Build from the repository root:
+ *   gcc -O2 -ICore/Inc Tools/WidgetBench/WidgetBench.c Core/Src/Widget.c
+ *       Core/Src/Overlay.c Core/Src/UiLayer.c Core/Src/ScreenImage.c
+ *       Core/Src/ScreenImages.c Core/Src/ScanSync.c Core/Src/LCD_Graphics.c
+ *       Core/Src/GlyphMasks.c Core/Src/fonts.c Core/Src/GameEngine.c
+ *       Core/Src/PieceBag.c -o widget_bench
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "Overlay.h"
+
+#define CHECKS    5000		// random screens and changes
+#define HUD_STEPS 200000	// main loop passes of the simulated game
+#define ROUNDS    1000000	// renders of an unchanged screen
+
+static GameState game;				// never started, the preview slots stay empty
+static uint16_t referenceBuffer[LCD_PIXELS];
+static uint8_t uiReference[UI_LAYER_BYTES];
+
+static double Bench_Seconds(void) {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+// Mostly short numbers, some long enough to run into the labels
+static uint32_t Bench_Value(void) {
+	switch (rand() % 4) {
+	case 0:
+		return rand() % 10;
+	case 1:
+		return rand() % 1000;
+	case 2:
+		return rand() % 100000;
+	default:
+		return (uint32_t) rand() * 7u;
+	}
+}
+
+// displayResultsScreen before the widgets, into referenceBuffer
+static void Bench_Immediate(uint32_t elapsed, const uint16_t *score, uint32_t best) {
+	static const char *lineNames[4] = { "SINGLES", "DOUBLES", "TRIPLES", "TETRIS!" };
+
+	LCD_Clear(0, LCD_COLOR_BLACK);
+	LCD_SetFont(&Font16x24);
+	LCD_SetTextColor(LCD_COLOR_WHITE);
+
+	LCD_DisplayString(LCD_PIXEL_WIDTH / 2, 61, "TOTAL", LCD_ALIGN_CENTER);
+	LCD_DisplayString(LCD_PIXEL_WIDTH / 2, 81, "TIME MS", LCD_ALIGN_CENTER);
+	LCD_DisplayNumber(LCD_PIXEL_WIDTH / 2, 121, elapsed, LCD_ALIGN_CENTER);
+	for (uint8_t i = 0; i < 4; i++) {
+		LCD_DisplayString(RESULTS_LABEL_X, 181 + i * 20, lineNames[i], LCD_ALIGN_LEFT);
+		LCD_DisplayNumber(RESULTS_VALUE_X, 181 + i * 20, score[i], LCD_ALIGN_RIGHT);
+	}
+	LCD_DisplayString(RESULTS_LABEL_X, 281, "BEST", LCD_ALIGN_LEFT);
+	LCD_DisplayNumber(RESULTS_VALUE_X, 281, best, LCD_ALIGN_RIGHT);
+
+	memcpy(referenceBuffer, frameBuffer, sizeof(referenceBuffer));
+}
+
+// The immediate draw of whatever numbers the results widgets hold
+static void Bench_Fresh(void) {
+	const Widget *widgets = resultsScreen.widgets;
+	uint16_t score[4];
+	uint16_t saved[LCD_PIXELS];
+
+	for (uint8_t line = 0; line < 4; line++) {
+		score[line] = widgets[RESULTS_LINES + line].value;
+	}
+	memcpy(saved, frameBuffer, sizeof(saved));
+	Bench_Immediate(widgets[RESULTS_TIME].value, score, widgets[RESULTS_BEST].value);
+	memcpy(frameBuffer, saved, sizeof(saved));
+}
+
+static int Bench_CheckResults(void) {
+	int errors = 0;
+
+	for (uint32_t i = 0; i < CHECKS; i++) {
+		uint32_t elapsed = Bench_Value(), best = Bench_Value();
+		uint16_t score[4];
+		for (uint8_t line = 0; line < 4; line++) {
+			score[line] = Bench_Value();
+		}
+
+		Bench_Immediate(elapsed, score, best);
+		Overlay_Results(elapsed, score, best);
+		if (memcmp(frameBuffer, referenceBuffer, sizeof(referenceBuffer)) != 0) {
+			printf("results %u %u differ from the immediate draw\n", elapsed, best);
+			errors++;
+		}
+	}
+	return errors;
+}
+
+// Random changes to one or more numbers, every render against a full draw
+static int Bench_CheckChanges(uint32_t *changes, uint32_t *pixels) {
+	int errors = 0;
+	uint16_t score[4] = { 0, 0, 0, 0 };
+
+	Overlay_Results(0, score, 0);
+	Widget_ResetStats(&resultsScreen);
+	for (uint32_t i = 0; i < CHECKS; i++) {
+		uint8_t count = 1 + rand() % 3;
+		for (uint8_t c = 0; c < count; c++) {
+			uint8_t field = rand() % (RESULTS_BEST + 1);
+			uint32_t value = Bench_Value();
+			if (field != RESULTS_TIME && field != RESULTS_BEST) {
+				value &= 0xFFFF;		// line counts are uint16_t
+			}
+			Widget_SetNumber(&resultsScreen, field, value);
+		}
+
+		Widget_Render(&resultsScreen);
+		Bench_Fresh();
+		if (memcmp(frameBuffer, referenceBuffer, sizeof(referenceBuffer)) != 0) {
+			printf("change %u leaves the screen different from a full draw\n", i);
+			errors++;
+			Overlay_Results(0, score, 0);
+		}
+	}
+	*changes = resultsScreen.renders;
+	*pixels = resultsScreen.damagePixels;
+	return errors;
+}
+
+// The HUD cleared and printed again from scratch, into uiReference
+static void Bench_HudFresh(void) {
+	static const struct {
+		int16_t x, y;
+		const char *text;
+	} labels[] = { { 20, 4, "PTS" }, { 4, 24, "L" }, { 88, 24, "LV" }, { 4, 44, "T" },
+			{ 112, 44, "PPS" } };
+	const Widget *hud = gameScreen.widgets;
+	uint8_t saved[UI_LAYER_BYTES];
+	char text[16];
+
+	memcpy(saved, uiBuffer, sizeof(saved));
+	Ui_Fill(PREVIEW_SLOT_W, 0, PREVIEW_X - PREVIEW_SLOT_W, ATLAS_TILE_SIZE, UI_CLEAR);
+	Ui_Fill(0, ATLAS_TILE_SIZE, LCD_PIXEL_WIDTH, HUD_HEIGHT - ATLAS_TILE_SIZE, UI_CLEAR);
+	Ui_SetFont(&Font12x12);
+
+	Ui_SetTextColor(UI_GREY);
+	for (uint8_t i = 0; i < sizeof(labels) / sizeof(labels[0]); i++) {
+		Ui_DisplayString(labels[i].x, labels[i].y, labels[i].text, LCD_ALIGN_LEFT);
+	}
+
+	Ui_SetTextColor(UI_WHITE);
+	for (uint8_t field = HUD_SCORE; field <= HUD_PPS; field++) {
+		uint32_t value = hud[field].value;
+		if (field == HUD_TIME) {
+			snprintf(text, sizeof(text), "%u:%02u", value / 60, value % 60);
+		} else if (field == HUD_PPS) {
+			snprintf(text, sizeof(text), "%u.%02u", value / 100, value % 100);
+		} else {
+			snprintf(text, sizeof(text), "%u", value);
+		}
+		Ui_DisplayString(hud[field].x, hud[field].y, text, LCD_ALIGN_RIGHT);
+	}
+
+	memcpy(uiReference, uiBuffer, sizeof(uiReference));
+	memcpy(uiBuffer, saved, sizeof(saved));
+}
+
+/*
+ * A game as the main loop sees it: time moving on a few ms a pass, pieces locking
+ * and lines clearing now and then, and every so often values far from the last ones.
+ */
+static int Bench_CheckHud(uint32_t *updates, uint32_t *pixels, double *seconds) {
+	uint16_t score[4] = { 0, 0, 0, 0 };
+	uint32_t elapsed = 0, pieces = 0;
+	int errors = 0;
+
+	Overlay_Game(&game);
+	Widget_ResetStats(&gameScreen);
+	*seconds = 0;
+	for (uint32_t step = 0; step < HUD_STEPS; step++) {
+		elapsed += 1 + rand() % 40;
+		if (rand() % 50 == 0) {
+			pieces++;
+			if (rand() % 3 == 0) {
+				score[rand() % 4]++;
+			}
+		}
+		if (rand() % 5000 == 0) {
+			elapsed = Bench_Value();
+			pieces = rand() % 50000;
+			for (uint8_t line = 0; line < 4; line++) {
+				score[line] = rand() % 3000;
+			}
+		}
+		uint32_t points = 100 * score[0] + 300 * score[1] + 500 * score[2] + 800 * score[3];
+
+		double start = Bench_Seconds();
+		Overlay_SetHud(elapsed, score, points, pieces);
+		Widget_Render(&gameScreen);
+		*seconds += Bench_Seconds() - start;
+
+		Bench_HudFresh();
+		if (memcmp(uiBuffer, uiReference, (uint32_t) uiWindow.width * uiWindow.height) != 0) {
+			printf("hud step %u leaves the window different from a full draw\n", step);
+			errors++;
+			Overlay_Game(&game);
+		}
+	}
+	*updates = gameScreen.renders;
+	*pixels = gameScreen.damagePixels;
+	return errors;
+}
+
+// HandleTouch before the widgets, touch y grows upwards
+static uint8_t Bench_OldGameTouch(int16_t touchX, int16_t touchY) {
+	if ((touchX <= 39) && (touchY >= 280)) {
+		return INPUT_HOLD;
+	} else if (touchX <= 119) {
+		return (touchY > 159) ? INPUT_ROTATE_LEFT : INPUT_MOVE_LEFT;
+	}
+	return (touchY > 159) ? INPUT_ROTATE_RIGHT : INPUT_MOVE_RIGHT;
+}
+
+static int Bench_CheckTouch(void) {
+	int errors = 0;
+	uint32_t menuHits = 0;
+
+	for (int16_t touchY = 0; touchY < LCD_PIXEL_HEIGHT; touchY++) {
+		for (int16_t touchX = 0; touchX < LCD_PIXEL_WIDTH; touchX++) {
+			int16_t y = LCD_PIXEL_HEIGHT - 1 - touchY;
+			uint8_t input = Widget_HitTest(&gameScreen, touchX, y);
+			if (input != Bench_OldGameTouch(touchX, touchY)) {
+				errors++;
+			}
+
+			// the start button is now exactly what is drawn
+			bool inButton = (touchX >= MENU_BUTTON_X1) && (touchX <= MENU_BUTTON_X2)
+					&& (y >= MENU_BUTTON_Y1) && (y <= MENU_BUTTON_Y2);
+			uint8_t action = Widget_HitTest(&menuScreen, touchX, y);
+			menuHits += (action == MENU_START);
+			if ((action == MENU_START) != inButton) {
+				errors++;
+			}
+		}
+	}
+	printf("touch: %u points, %u on the start button, %d differ\n",
+			(unsigned) LCD_PIXELS, menuHits, errors);
+	return errors;
+}
+
+int main(void) {
+	srand(1);
+
+	int errors = Bench_CheckResults();
+	printf("results: %u screens against the immediate draw, %d differ\n", CHECKS, errors);
+
+	uint32_t changes, pixels;
+	int changeErrors = Bench_CheckChanges(&changes, &pixels);
+	printf("changes: %u renders against full draws, %d differ, %.0f pixels redrawn each"
+			" (full screen %u)\n", changes, changeErrors, (double) pixels / changes,
+			(unsigned) LCD_PIXELS);
+	errors += changeErrors + Bench_CheckTouch();
+
+	double hudSeconds;
+	int hudErrors = Bench_CheckHud(&changes, &pixels, &hudSeconds);
+	printf("hud: %u passes, %u updates against full draws, %d differ, %.0f pixels"
+			" redrawn each (window %u), %.2f us a pass\n", HUD_STEPS, changes, hudErrors,
+			(double) pixels / changes, (unsigned) (uiWindow.width * uiWindow.height),
+			hudSeconds * 1e6 / HUD_STEPS);
+	errors += hudErrors;
+
+	// nothing changed, the cost of keeping a shown screen up to date
+	double start = Bench_Seconds();
+	uint32_t drawn = 0;
+	for (uint32_t round = 0; round < ROUNDS; round++) {
+		Widget_SetNumber(&resultsScreen, RESULTS_BEST,
+				resultsScreen.widgets[RESULTS_BEST].value);
+		drawn += Widget_Render(&resultsScreen);
+	}
+	double idle = Bench_Seconds() - start;
+
+	start = Bench_Seconds();
+	for (uint32_t round = 0; round < ROUNDS / 1000; round++) {
+		Screen_Decode(&ScreenResults);
+		Widget_InvalidateAll(&resultsScreen);
+		Widget_Render(&resultsScreen);
+	}
+	double full = (Bench_Seconds() - start) / (ROUNDS / 1000);
+
+	printf("static screen: %.1f ns per loop, %u redraws  (full redraw %.2f us)\n",
+			idle * 1e9 / ROUNDS, drawn, full * 1e6);
+	return (errors == 0) ? 0 : 1;
+}